@@ -22,6 +22,7 @@
 
 #include "MathLib/InterpolationAlgorithms/PiecewiseLinearInterpolation.h"
 #include "MeshLib/Mesh.h"
+#include "MeshLib/MeshInformation.h"
 
 #include "NumLib/ODESolver/TimeDiscretizationBuilder.h"
 
@@ -45,6 +46,17 @@ static void readGeometry(std::string const& fname,
     GeoLib::IO::BoostXmlGmlInterface gml_reader(geo_objects);
     gml_reader.readFile(fname);
 }
+
+static BaseLib::AccountedMemory accountMeshMemory(MeshLib::Mesh const& mesh)
+{
+    auto const usage = MeshLib::MeshInformation::getMemoryUsage(mesh);
+    BaseLib::AccountedMemory memory;
+    memory.add("mesh/nodes", usage.nodes);
+    memory.add("mesh/elements", usage.elements);
+    memory.add("mesh/connectivity", usage.connectivity);
+    memory.add("mesh/properties", usage.properties);
+    return memory;
+}
 }
 
 ProjectData::ProjectData() = default;
@@ -70,6 +82,7 @@ ProjectData::ProjectData(BaseLib::ConfigTree const& project_config,
         OGS_FATAL("Could not read mesh from \'%s\' file. No mesh added.",
                   mesh_file.c_str());
     }
+    _mesh_memory.emplace(mesh, detail::accountMeshMemory(*mesh));
     _mesh_vec.push_back(mesh);
 
     //! \ogs_file_param{prj__curves}
@@ -110,6 +123,7 @@ void ProjectData::addMesh(MeshLib::Mesh* mesh)
     std::string name = mesh->getName();
     isMeshNameUniqueAndProvideUniqueName(name);
     mesh->setName(name);
+    _mesh_memory.emplace(mesh, detail::accountMeshMemory(*mesh));
     _mesh_vec.push_back(mesh);
 }
 
@@ -140,6 +154,7 @@ bool ProjectData::removeMesh(const std::string& name)
     std::vector<MeshLib::Mesh*>::iterator it = findMeshByName(name);
     while (it != _mesh_vec.end())
     {
+        _mesh_memory.erase(*it);
         delete *it;
         *it = nullptr;
         it = findMeshByName(name);
@@ -325,8 +340,6 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config)
 void ProjectData::parseOutput(BaseLib::ConfigTree const& output_config,
                               std::string const& output_directory)
 {
-    //! \ogs_file_param{prj__output__type}
-    output_config.checkConfigParameter("type", "VTK");
     DBUG("Parse output configuration:");
 
     _output = ProcessLib::Output::newInstance(output_config, output_directory);
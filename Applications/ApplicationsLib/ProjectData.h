@@ -19,6 +19,7 @@
 #include <boost/optional/optional.hpp>
 
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/MemoryAccounting.h"
 
 #include "GeoLib/GEOObjects.h"
 
@@ -180,6 +181,8 @@ private:
 private:
     GeoLib::GEOObjects* _geoObjects = new GeoLib::GEOObjects();
     std::vector<MeshLib::Mesh*> _mesh_vec;
+    /// Memory of each mesh attributed to the BaseLib::MemoryAccounting.
+    std::map<MeshLib::Mesh const*, BaseLib::AccountedMemory> _mesh_memory;
     std::vector<std::unique_ptr<ProcessLib::Process>> _processes;
     std::vector<ProcessLib::ProcessVariable> _process_variables;
 
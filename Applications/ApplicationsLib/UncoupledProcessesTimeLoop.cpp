@@ -8,7 +8,7 @@
  */
 
 #include "UncoupledProcessesTimeLoop.h"
-#include "BaseLib/RunTime.h"
+#include "BaseLib/Profiler.h"
 
 namespace ApplicationsLib
 {
@@ -178,8 +178,7 @@ bool UncoupledProcessesTimeLoop::loop(ProjectData& project)
 
     while (_timestepper->next())
     {
-        BaseLib::RunTime time_timestep;
-        time_timestep.start();
+        OGS_PROFILE_SCOPE("time step");
 
         auto const ts = _timestepper->getTimeStep();
         auto const delta_t = ts.dt();
@@ -194,17 +193,15 @@ bool UncoupledProcessesTimeLoop::loop(ProjectData& project)
         for (auto p = project.processesBegin(); p != project.processesEnd();
              ++p, ++pcs_idx)
         {
-            BaseLib::RunTime time_timestep_process;
-            time_timestep_process.start();
-
             auto& x = *_process_solutions[pcs_idx];
 
-            nonlinear_solver_succeeded = solveOneTimeStepOneProcess(
-                x, timestep, t, delta_t, per_process_data[pcs_idx], **p,
-                out_ctrl);
+            {
+                OGS_PROFILE_SCOPE("process solve");
 
-            INFO("[time] Solving process #%u took %g s in timestep #%u.",
-                 timestep, time_timestep.elapsed(), pcs_idx);
+                nonlinear_solver_succeeded = solveOneTimeStepOneProcess(
+                    x, timestep, t, delta_t, per_process_data[pcs_idx], **p,
+                    out_ctrl);
+            }
 
             if (!nonlinear_solver_succeeded)
             {
@@ -223,9 +220,6 @@ bool UncoupledProcessesTimeLoop::loop(ProjectData& project)
             }
         }
 
-        INFO("[time] Timestep #%u took %g s.", timestep,
-             time_timestep.elapsed());
-
         if (!nonlinear_solver_succeeded)
             break;
     }
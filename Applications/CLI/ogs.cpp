@@ -18,6 +18,9 @@
 #include "BaseLib/ConfigTreeUtil.h"
 #include "BaseLib/DateTools.h"
 #include "BaseLib/FileTools.h"
+#include "BaseLib/MemoryAccounting.h"
+#include "BaseLib/Profiler.h"
+#include "BaseLib/Report.h"
 #include "BaseLib/RunTime.h"
 
 #include "Applications/ApplicationsLib/LinearSolverLibrarySetup.h"
@@ -70,6 +73,27 @@ int main(int argc, char *argv[])
         "warnings from parsing the configuration file will not trigger program abortion");
     cmd.add(nonfatal_arg);
 
+    TCLAP::ValueArg<std::string> profile_arg(
+        "", "profile",
+        "write a report of the accumulated timings to the given file; "
+        "CSV if the file name ends with .csv, JSON otherwise; "
+        "in parallel runs the MPI rank is inserted before the extension",
+        false,
+        "",
+        "report file");
+    cmd.add(profile_arg);
+
+    TCLAP::ValueArg<std::string> memory_report_arg(
+        "", "memory-report",
+        "write a report of the memory used by the main data structures and "
+        "the peak memory of each phase to the given file; "
+        "CSV if the file name ends with .csv, JSON otherwise; "
+        "in parallel runs the MPI rank is inserted before the extension",
+        false,
+        "",
+        "report file");
+    cmd.add(memory_report_arg);
+
     cmd.parse(argc, argv);
 
     ApplicationsLib::LogogSetup logog_setup;
@@ -88,6 +112,8 @@ int main(int argc, char *argv[])
     }
 
     auto ogs_status = EXIT_SUCCESS;
+    std::string profile_file = profile_arg.getValue();
+    std::string memory_report_file = memory_report_arg.getValue();
 
     try
     {
@@ -96,6 +122,22 @@ int main(int argc, char *argv[])
             ApplicationsLib::LinearSolverLibrarySetup
                 linear_solver_library_setup(argc, argv);
 
+#ifdef USE_PETSC
+            // Every process writes its own reports.
+            {
+                int rank;
+                MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+                if (!profile_file.empty())
+                    profile_file = BaseLib::getRankFileName(profile_file, rank);
+                if (!memory_report_file.empty())
+                    memory_report_file =
+                        BaseLib::getRankFileName(memory_report_file, rank);
+            }
+#endif
+
+            auto& memory_accounting = BaseLib::MemoryAccounting::instance();
+            memory_accounting.beginPhase("read input");
+
             auto project_config = BaseLib::makeConfigTree(
                 project_arg.getValue(), !nonfatal_arg.getValue(),
                 "OpenGeoSysProject");
@@ -108,6 +150,8 @@ int main(int argc, char *argv[])
             project_config.checkAndInvalidate();
             BaseLib::ConfigTree::assertNoSwallowedErrors();
 
+            memory_accounting.beginPhase("initialize");
+
             // Create processes.
             project.buildProcesses();
 
@@ -124,8 +168,12 @@ int main(int argc, char *argv[])
 
             INFO("Solve processes.");
 
+            memory_accounting.beginPhase("time loop");
+
             auto& time_loop = project.getTimeLoop();
             solver_succeeded = time_loop.loop(project);
+
+            memory_accounting.endPhase();
         }  // This nested scope ensures that everything that could possibly
            // possess a ConfigTree is destructed before the final check below is
            // done.
@@ -146,5 +194,27 @@ int main(int argc, char *argv[])
 
     INFO("[time] Execution took %g s.", run_time.elapsed());
 
+    if (!profile_file.empty())
+    {
+        try
+        {
+            BaseLib::Profiler::instance().writeReport(profile_file);
+        } catch (std::exception& e) {
+            ERR(e.what());
+        }
+    }
+
+    if (!memory_report_file.empty())
+    {
+        try
+        {
+            auto& memory_accounting = BaseLib::MemoryAccounting::instance();
+            memory_accounting.endPhase();
+            memory_accounting.writeReport(memory_report_file);
+        } catch (std::exception& e) {
+            ERR(e.what());
+        }
+    }
+
     return ogs_status;
 }
@@ -0,0 +1,55 @@
+/**
+ * @file BinaryMeshConverter.cpp
+ * @brief Converts meshes from and to the binary mesh format.
+ *
+ * @copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/LICENSE.txt
+ */
+
+#include <string>
+#include <memory>
+
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+
+#include "BaseLib/RunTime.h"
+
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/IO/writeMeshToFile.h"
+#include "MeshLib/Mesh.h"
+
+int main (int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Converts meshes from and to the binary mesh format (*.bmsh). The "
+        "formats are determined by the file extensions (vtu, msh, bmsh).",
+        ' ', "0.1");
+    TCLAP::ValueArg<std::string> mesh_in("i", "mesh-input-file",
+                                         "the name of the file containing the input mesh", true,
+                                         "", "file name of input mesh");
+    cmd.add(mesh_in);
+    TCLAP::ValueArg<std::string> mesh_out("o", "mesh-output-file",
+                                          "the name of the file the mesh will be written to", true,
+                                          "", "file name of output mesh");
+    cmd.add(mesh_out);
+    cmd.parse(argc, argv);
+
+    BaseLib::RunTime timer;
+    timer.start();
+    std::unique_ptr<MeshLib::Mesh const> mesh(
+        MeshLib::IO::readMeshFromFileSerial(mesh_in.getValue()));
+    if (!mesh)
+        return EXIT_FAILURE;
+    INFO("Mesh read: %d nodes, %d elements in %g s.", mesh->getNumberOfNodes(),
+         mesh->getNumberOfElements(), timer.elapsed());
+
+    MeshLib::IO::writeMeshToFile(*mesh, mesh_out.getValue());
+
+    return EXIT_SUCCESS;
+}
@@ -29,6 +29,7 @@
 #include "MeshLib/IO/Legacy/MeshIO.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 #include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/MeshRevision.h"
 
 int main (int argc, char* argv[])
 {
@@ -54,6 +55,13 @@ int main (int argc, char* argv[])
         "filename as string");
     cmd.add(feflow_mesh_arg);
 
+    TCLAP::ValueArg<double> collapse_eps_arg("c", "collapse-eps",
+        "if set, nodes with a distance smaller than the given value are merged",
+        false,
+        0.0,
+        "distance as floating point number");
+    cmd.add(collapse_eps_arg);
+
     cmd.parse(argc, argv);
 
     // *** read mesh
@@ -65,7 +73,7 @@ int main (int argc, char* argv[])
     BaseLib::RunTime run_time;
     run_time.start();
     FileIO::FEFLOWMeshInterface feflowIO;
-    std::unique_ptr<MeshLib::Mesh const> mesh(
+    std::unique_ptr<MeshLib::Mesh> mesh(
         feflowIO.readFEFLOWFile(feflow_mesh_arg.getValue()));
 
     if (mesh == nullptr) {
@@ -79,6 +87,14 @@ int main (int argc, char* argv[])
     INFO("Time for reading: %f seconds.", run_time.elapsed());
     INFO("Read %d nodes and %d elements.", mesh->getNumberOfNodes(), mesh->getNumberOfElements());
 
+    if (collapse_eps_arg.isSet()) {
+        MeshLib::MeshRevision rev(*mesh);
+        std::unique_ptr<MeshLib::Mesh> collapsed(
+            rev.collapseNodes(mesh->getName(), collapse_eps_arg.getValue()));
+        INFO("Merged %d nodes.", mesh->getNumberOfNodes() - collapsed->getNumberOfNodes());
+        mesh = std::move(collapsed);
+    }
+
     std::string ogs_mesh_fname(ogs_mesh_arg.getValue());
     INFO("Writing %s.", ogs_mesh_fname.c_str());
     MeshLib::IO::writeMeshToFile(*mesh, ogs_mesh_fname);
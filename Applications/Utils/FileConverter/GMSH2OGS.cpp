@@ -33,6 +33,7 @@
 #include "MeshLib/IO/writeMeshToFile.h"
 #include "MeshLib/MeshSearch/ElementSearch.h"
 #include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/MeshRevision.h"
 #include "MeshLib/MeshEditing/RemoveMeshComponents.h"
 
 int main (int argc, char* argv[])
@@ -63,6 +64,13 @@ int main (int argc, char* argv[])
         "if set, lines will not be written to the ogs mesh");
     cmd.add(exclude_lines_arg);
 
+    TCLAP::ValueArg<double> collapse_eps_arg("c", "collapse-eps",
+        "if set, nodes with a distance smaller than the given value are merged",
+        false,
+        0.0,
+        "distance as floating point number");
+    cmd.add(collapse_eps_arg);
+
     cmd.parse(argc, argv);
 
     // *** read mesh
@@ -102,6 +110,15 @@ int main (int argc, char* argv[])
         }
     }
 
+    // *** merge duplicate nodes on request
+    if (collapse_eps_arg.isSet()) {
+        MeshLib::MeshRevision rev(*mesh);
+        auto m = rev.collapseNodes(mesh->getName(), collapse_eps_arg.getValue());
+        INFO("Merged %d nodes.", mesh->getNumberOfNodes() - m->getNumberOfNodes());
+        std::swap(m, mesh);
+        delete m;
+    }
+
     // *** write mesh in new format
     MeshLib::IO::writeMeshToFile(*mesh, ogs_mesh_arg.getValue());
 
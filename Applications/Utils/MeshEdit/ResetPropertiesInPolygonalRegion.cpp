@@ -23,6 +23,7 @@
 #include "GeoLib/AnalyticalGeometry.h"
 #include "GeoLib/GEOObjects.h"
 #include "GeoLib/Polygon.h"
+#include "GeoLib/PreparedPolygon.h"
 #include "GeoLib/IO/readGeometryFromFile.h"
 
 #include "MathLib/Vector3.h"
@@ -55,11 +56,10 @@ static std::vector<bool> markNodesOutSideOfPolygon(
 
     // *** mark rotated nodes
     std::vector<bool> outside(rotated_nodes.size(), true);
-    for (std::size_t k(0); k<rotated_nodes.size(); k++) {
-        if (rot_polygon.isPntInPolygon(*(rotated_nodes[k]))) {
-            outside[k] = false;
-        }
-    }
+    GeoLib::PreparedPolygon const prepared_polygon(rot_polygon);
+    for (auto const k :
+         prepared_polygon.getIndicesOfPointsInPolygon(rotated_nodes))
+        outside[k] = false;
 
     for (auto & rotated_node : rotated_nodes)
         delete rotated_node;
@@ -80,7 +80,7 @@ void resetMeshElementProperty(MeshLib::Mesh &mesh, GeoLib::Polygon const& polygo
     std::string const& property_name, PT new_property_value)
 {
     boost::optional<MeshLib::PropertyVector<PT> &> opt_pv(
-        mesh.getProperties().getPropertyVector<PT>(property_name)
+        mesh.getProperties().getMutablePropertyVector<PT>(property_name)
     );
     if (!opt_pv) {
         WARN("Did not find a PropertyVector with name \"%s\".",
@@ -207,7 +207,7 @@ int main (int argc, char* argv[])
 
         // check if PropertyVector exists
         boost::optional<MeshLib::PropertyVector<char> &> opt_pv(
-            mesh->getProperties().getPropertyVector<char>(property_name)
+            mesh->getProperties().getMutablePropertyVector<char>(property_name)
         );
         if (!opt_pv) {
             opt_pv = mesh->getProperties().createNewPropertyVector<char>(
@@ -223,7 +223,7 @@ int main (int argc, char* argv[])
 
         // check if PropertyVector exists
         boost::optional<MeshLib::PropertyVector<int> &> opt_pv(
-            mesh->getProperties().getPropertyVector<int>(property_name)
+            mesh->getProperties().getMutablePropertyVector<int>(property_name)
         );
         if (!opt_pv) {
             opt_pv = mesh->getProperties().createNewPropertyVector<int>(
@@ -7,6 +7,7 @@
  */
 
 #include <array>
+#include <sstream>
 #include <string>
 
 #include <tclap/CmdLine.h>
@@ -25,6 +26,7 @@
 #include "MeshLib/Elements/Element.h"
 #include "MeshLib/Mesh.h"
 #include "MeshLib/MeshInformation.h"
+#include "MeshLib/MeshQuality/MeshQualitySummary.h"
 #include "MeshLib/MeshQuality/MeshValidation.h"
 
 #include "MeshLib/IO/readMeshFromFile.h"
@@ -40,6 +42,8 @@ int main(int argc, char *argv[])
     cmd.add( valid_arg );
     TCLAP::SwitchArg print_properties_arg("p","print_properties","print properties stored in the mesh");
     cmd.add( print_properties_arg );
+    TCLAP::SwitchArg quality_arg("q","quality","compute all element quality metrics and print their histograms");
+    cmd.add( quality_arg );
 
     cmd.parse( argc, argv );
 
@@ -111,4 +115,23 @@ int main(int argc, char *argv[])
         else
             INFO ("No holes found within the mesh.");
     }
+
+    if (quality_arg.isSet()) {
+        run_time.start();
+        MeshLib::MeshQualitySummary const quality(*mesh);
+        INFO("Time for computing the element quality: %g s", run_time.elapsed());
+
+        for (auto const t : {MeshLib::MeshQualityType::ELEMENTSIZE,
+                             MeshLib::MeshQualityType::SIZEDIFFERENCE,
+                             MeshLib::MeshQualityType::EDGERATIO,
+                             MeshLib::MeshQualityType::EQUIANGLESKEW,
+                             MeshLib::MeshQualityType::RADIUSEDGERATIO})
+        {
+            BaseLib::Histogram<double> const histogram(quality.getHistogram(t));
+            std::ostringstream os;
+            histogram.prettyPrint(os);
+            INFO("%s in [%g, %g]:\n%s", MeshLib::MeshQualityType2String(t).c_str(),
+                 histogram.getMinimum(), histogram.getMaximum(), os.str().c_str());
+        }
+    }
 }
@@ -0,0 +1,78 @@
+/**
+ * @brief Renumbers the nodes and elements of a mesh for memory locality.
+ *
+ * @copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/LICENSE.txt
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/IO/writeMeshToFile.h"
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/ReorderMesh.h"
+
+int main (int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Renumbers the nodes of a mesh to improve the memory locality of the "
+        "assembly and of the linear solver. The elements are sorted according "
+        "to the new node numbers. Method 'rcm' applies the Reverse "
+        "Cuthill-McKee algorithm to the node graph, which reduces the matrix "
+        "bandwidth. Method 'hilbert' sorts the nodes along a Hilbert curve "
+        "through their bounding box.",
+        ' ', "0.1");
+    TCLAP::ValueArg<std::string> mesh_in("i", "input-mesh-file",
+        "the name of the file containing the input mesh", true,
+        "", "file name of input mesh");
+    cmd.add(mesh_in);
+    TCLAP::ValueArg<std::string> mesh_out("o", "output-mesh-file",
+        "the name of the file the renumbered mesh will be written to", true,
+        "", "file name of output mesh");
+    cmd.add(mesh_out);
+    std::vector<std::string> allowed_methods{"rcm", "hilbert"};
+    TCLAP::ValuesConstraint<std::string> allowed_methods_constraint(
+        allowed_methods);
+    TCLAP::ValueArg<std::string> method_arg("m", "method",
+        "the renumbering method", false, "rcm", &allowed_methods_constraint);
+    cmd.add(method_arg);
+    cmd.parse(argc, argv);
+
+    std::unique_ptr<MeshLib::Mesh const> const mesh(
+        MeshLib::IO::readMeshFromFile(mesh_in.getValue()));
+    if (!mesh)
+        return EXIT_FAILURE;
+
+    INFO("Bandwidth of the input mesh: %d.",
+         MeshLib::computeNodeBandwidth(*mesh));
+
+    INFO("Renumbering nodes using method '%s'.", method_arg.getValue().c_str());
+    std::vector<std::size_t> const node_order(
+        method_arg.getValue() == "hilbert"
+            ? MeshLib::computeHilbertCurveOrder(mesh->getNodes())
+            : MeshLib::computeReverseCuthillMcKeeOrder(*mesh));
+
+    std::unique_ptr<MeshLib::Mesh const> const new_mesh(
+        MeshLib::reorderMesh(*mesh, node_order, mesh->getName()));
+    if (!new_mesh)
+        return EXIT_FAILURE;
+
+    INFO("Bandwidth of the renumbered mesh: %d.",
+         MeshLib::computeNodeBandwidth(*new_mesh));
+
+    MeshLib::IO::writeMeshToFile(*new_mesh, mesh_out.getValue());
+
+    return EXIT_SUCCESS;
+}
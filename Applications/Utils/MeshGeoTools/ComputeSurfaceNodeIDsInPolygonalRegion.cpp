@@ -25,6 +25,7 @@
 
 #include "GeoLib/GEOObjects.h"
 #include "GeoLib/Polygon.h"
+#include "GeoLib/PreparedPolygon.h"
 #include "GeoLib/IO/readGeometryFromFile.h"
 
 #include "MathLib/Vector3.h"
@@ -133,14 +134,13 @@ int main (int argc, char* argv[])
             polygon_name = "Polygon-" + std::to_string(j);
         // create Polygon from Polyline
         GeoLib::Polygon const& polygon(*(plys[j]));
+        GeoLib::PreparedPolygon const prepared_polygon(polygon);
         // ids of mesh nodes on surface that are within the given polygon
         std::vector<std::pair<std::size_t, double>> ids_and_areas;
-        for (std::size_t k(0); k<all_sfc_nodes.size(); k++) {
-            MeshLib::Node const& pnt(*(all_sfc_nodes[k]));
-            if (polygon.isPntInPolygon(pnt[0], pnt[1], pnt[2])) {
-                ids_and_areas.push_back(std::make_pair(pnt.getID(), areas[k]));
-            }
-        }
+        for (auto const k :
+             prepared_polygon.getIndicesOfPointsInPolygon(all_sfc_nodes))
+            ids_and_areas.push_back(
+                std::make_pair(all_sfc_nodes[k]->getID(), areas[k]));
         if (ids_and_areas.empty()) {
             ERR("Polygonal part of surface \"%s\" doesn't contains nodes. No "
                 "output will be generated.", polygon_name.c_str());
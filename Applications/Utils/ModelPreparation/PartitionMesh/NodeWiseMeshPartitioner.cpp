@@ -14,11 +14,16 @@
 
 #include "NodeWiseMeshPartitioner.h"
 
+#include <algorithm>
+#include <array>
 #include <limits>
 #include <iomanip>
+#include <numeric>
+#include <sstream>
 #include <cstdio>  // for binary output
 
 #include <logog/include/logog.hpp>
+#include <metis.h>
 
 #include "BaseLib/Error.h"
 
@@ -84,103 +89,224 @@ void NodeWiseMeshPartitioner::readMetisData(const std::string& file_name_base)
     std::remove(fname_eparts.c_str());
 }
 
+void NodeWiseMeshPartitioner::partitionNodesByMETIS()
+{
+    const std::size_t nnodes = _mesh->getNumberOfNodes();
+    if (_npartitions < 2)
+    {
+        std::fill(_nodes_partition_ids.begin(), _nodes_partition_ids.end(), 0);
+        return;
+    }
+
+    // Element node connectivity in the compressed format of METIS, i.e. the
+    // same data as written by writeMETIS() with zero based indices.
+    std::vector<MeshLib::Element*> const& elements = _mesh->getElements();
+    std::vector<idx_t> eptr;
+    eptr.reserve(elements.size() + 1);
+    eptr.push_back(0);
+    for (const auto* elem : elements)
+        eptr.push_back(eptr.back() + elem->getNumberOfNodes());
+
+    std::vector<idx_t> eind(eptr.back());
+    for (std::size_t i = 0; i < elements.size(); i++)
+    {
+        const auto* elem = elements[i];
+        for (unsigned j = 0; j < elem->getNumberOfNodes(); j++)
+            eind[eptr[i] + j] = static_cast<idx_t>(elem->getNodeIndex(j));
+    }
+
+    idx_t ne = static_cast<idx_t>(elements.size());
+    idx_t nn = static_cast<idx_t>(nnodes);
+    idx_t nparts = static_cast<idx_t>(_npartitions);
+    idx_t options[METIS_NOPTIONS];
+    METIS_SetDefaultOptions(options);
+    options[METIS_OPTION_NUMBERING] = 0;
+
+    idx_t objval = 0;
+    std::vector<idx_t> epart(elements.size());
+    std::vector<idx_t> npart(nnodes);
+    const int status = METIS_PartMeshNodal(
+        &ne, &nn, eptr.data(), eind.data(), nullptr, nullptr, &nparts,
+        nullptr, options, &objval, epart.data(), npart.data());
+    if (status != METIS_OK)
+    {
+        OGS_FATAL("METIS_PartMeshNodal failed with return value %d.", status);
+    }
+    INFO("METIS: %ld edges are cut.", static_cast<long>(objval));
+
+    std::copy(npart.begin(), npart.end(), _nodes_partition_ids.begin());
+}
+
+/// Splits the nodes in [begin, end) into \c nparts parts with consecutive
+/// partition IDs starting at \c first_part_id.
+static void bisectNodes(std::vector<MeshLib::Node*> const& nodes,
+                        std::vector<std::size_t>::iterator const begin,
+                        std::vector<std::size_t>::iterator const end,
+                        std::size_t const nparts,
+                        std::size_t const first_part_id,
+                        std::vector<std::size_t>& nodes_partition_ids)
+{
+    if (nparts == 1)
+    {
+        for (auto it = begin; it != end; ++it)
+            nodes_partition_ids[*it] = first_part_id;
+        return;
+    }
+
+    // Longest axis of the bounding box of the node subset.
+    std::array<double, 3> min_pnt = {{std::numeric_limits<double>::max(),
+                                      std::numeric_limits<double>::max(),
+                                      std::numeric_limits<double>::max()}};
+    std::array<double, 3> max_pnt = {{std::numeric_limits<double>::lowest(),
+                                      std::numeric_limits<double>::lowest(),
+                                      std::numeric_limits<double>::lowest()}};
+    for (auto it = begin; it != end; ++it)
+    {
+        MeshLib::Node const& node = *nodes[*it];
+        for (unsigned d = 0; d < 3; d++)
+        {
+            min_pnt[d] = std::min(min_pnt[d], node[d]);
+            max_pnt[d] = std::max(max_pnt[d], node[d]);
+        }
+    }
+    unsigned axis = 0;
+    for (unsigned d = 1; d < 3; d++)
+    {
+        if (max_pnt[d] - min_pnt[d] > max_pnt[axis] - min_pnt[axis])
+            axis = d;
+    }
+
+    // The node ID breaks ties, which keeps the result deterministic for
+    // nodes with the same coordinate.
+    const std::size_t nparts_left = nparts / 2;
+    const auto middle = begin + (end - begin) * nparts_left / nparts;
+    std::nth_element(begin, middle, end,
+                     [&nodes, axis](std::size_t a, std::size_t b)
+                     {
+                         return (*nodes[a])[axis] < (*nodes[b])[axis] ||
+                                ((*nodes[a])[axis] == (*nodes[b])[axis] &&
+                                 a < b);
+                     });
+
+    bisectNodes(nodes, begin, middle, nparts_left, first_part_id,
+                nodes_partition_ids);
+    bisectNodes(nodes, middle, end, nparts - nparts_left,
+                first_part_id + nparts_left, nodes_partition_ids);
+}
+
+void NodeWiseMeshPartitioner::partitionNodesByCoordinateBisection()
+{
+    std::vector<std::size_t> node_ids(_mesh->getNumberOfNodes());
+    std::iota(node_ids.begin(), node_ids.end(), 0);
+    bisectNodes(_mesh->getNodes(), node_ids.begin(), node_ids.end(),
+                std::max(_npartitions, IntegerType(1)), 0,
+                _nodes_partition_ids);
+}
+
 void NodeWiseMeshPartitioner
          ::partitionByMETIS(const bool is_mixed_high_order_linear_elems)
 {
     std::vector<MeshLib::Node*> const& nodes = _mesh->getNodes();
-    for (std::size_t part_id = 0; part_id < _partitions.size(); part_id++)
-    {
-        auto& partition = _partitions[part_id];
-
-        INFO("Processing partition: %d", part_id);
+    const std::size_t npartitions = _partitions.size();
 
-        // Find non-ghost nodes in this partition
-        // -- Extra nodes for high order elements
-        std::vector<MeshLib::Node*> extra_nodes;
-        for (std::size_t i = 0; i < _mesh->getNumberOfNodes(); i++)
+    // Find the non-ghost nodes of all partitions in one sweep over the nodes.
+    // -- Extra nodes for high order elements
+    std::vector<std::vector<MeshLib::Node*>> extra_nodes(npartitions);
+    for (std::size_t i = 0; i < nodes.size(); i++)
+    {
+        const std::size_t part_id = _nodes_partition_ids[i];
+        if (part_id >= npartitions)
         {
-            if (_nodes_partition_ids[i] == part_id)
-            {
-                if (is_mixed_high_order_linear_elems)
-                { // TODO: Test it once there is a case
-                    if (i < _mesh->getNumberOfBaseNodes())
-                        partition.nodes.push_back(nodes[i]);
-                    else
-                        extra_nodes.push_back(nodes[i]);
-                }
-                else
-                {
-                    partition.nodes.push_back(nodes[i]);
-                }
-            }
+            OGS_FATAL("Node %d has the invalid partition ID %d.", i, part_id);
         }
+        // TODO: Test the mixed case once there is one.
+        if (is_mixed_high_order_linear_elems &&
+            i >= _mesh->getNumberOfBaseNodes())
+            extra_nodes[part_id].push_back(nodes[i]);
+        else
+            _partitions[part_id].nodes.push_back(nodes[i]);
+    }
+    for (std::size_t part_id = 0; part_id < npartitions; part_id++)
+    {
+        auto& partition = _partitions[part_id];
         partition.number_of_non_ghost_base_nodes = partition.nodes.size();
         partition.number_of_non_ghost_nodes =
-            partition.number_of_non_ghost_base_nodes + extra_nodes.size();
+            partition.number_of_non_ghost_base_nodes +
+            extra_nodes[part_id].size();
+    }
 
-        // Find elements that belong to this partition
-        std::vector<MeshLib::Element*> const& elements = _mesh->getElements();
-        for (std::size_t elem_id = 0; elem_id < elements.size(); elem_id++)
+    // Find the elements of all partitions in one sweep over the elements.
+    // An element is a regular element of a partition if all its nodes
+    // belong to the partition, otherwise it is a ghost element of every
+    // partition that owns at least one of its nodes.
+    std::vector<std::size_t> elem_partition_ids;
+    for (const auto* elem : _mesh->getElements())
+    {
+        elem_partition_ids.clear();
+        for (unsigned i = 0; i < elem->getNumberOfNodes(); i++)
         {
-            const auto* elem = elements[elem_id];
-            if (_elements_status[elem_id])
-                continue;
-
-            std::size_t non_ghost_node_number = 0;
-            for (unsigned i = 0; i < elem->getNumberOfNodes(); i++)
-            {
-                if (_nodes_partition_ids[elem->getNodeIndex(i)] == part_id)
-                {
-                    non_ghost_node_number++;
-                }
-            }
-
-            if (non_ghost_node_number == 0)
-                continue;
+            elem_partition_ids.push_back(
+                _nodes_partition_ids[elem->getNodeIndex(i)]);
+        }
+        std::sort(elem_partition_ids.begin(), elem_partition_ids.end());
+        elem_partition_ids.erase(std::unique(elem_partition_ids.begin(),
+                                             elem_partition_ids.end()),
+                                 elem_partition_ids.end());
 
-            if (non_ghost_node_number == elem->getNumberOfNodes())
-            {
-                partition.regular_elements.push_back(elem);
-                _elements_status[elem_id] = true;
-            }
-            else
-            {
-                partition.ghost_elements.push_back(elem);
-            }
+        if (elem_partition_ids.size() == 1)
+        {
+            _partitions[elem_partition_ids[0]].regular_elements.push_back(
+                elem);
+            continue;
         }
+        for (auto const part_id : elem_partition_ids)
+            _partitions[part_id].ghost_elements.push_back(elem);
+    }
 
-        // Find the ghost nodes of this partition
-        std::vector<bool> nodes_reserved(_mesh->getNumberOfNodes(), false);
-        for (const auto* ghost_elem : partition.ghost_elements)
+    // Find the ghost nodes of each partition. The partitions only read
+    // shared data, s.t. they can be processed in parallel.
+#ifdef _OPENMP
+    #pragma omp parallel
+#endif
+    {
+        // Marks the nodes that are already added to the current partition.
+        // Storing the partition ID avoids resetting the vector for each
+        // partition.
+        std::vector<std::size_t> nodes_reserved(
+            nodes.size(), std::numeric_limits<std::size_t>::max());
+#ifdef _OPENMP
+        #pragma omp for schedule(dynamic)
+        for (OPENMP_LOOP_TYPE i = 0; i < npartitions; i++)
+#else
+        for (std::size_t i = 0; i < npartitions; i++)
+#endif
         {
-            for (unsigned i = 0; i < ghost_elem->getNumberOfNodes(); i++)
+            const std::size_t part_id = i;
+            auto& partition = _partitions[part_id];
+            for (const auto* ghost_elem : partition.ghost_elements)
             {
-                const unsigned node_id = ghost_elem->getNodeIndex(i);
-                if (nodes_reserved[node_id])
-                    continue;
-
-                if (_nodes_partition_ids[node_id] != part_id)
+                for (unsigned j = 0; j < ghost_elem->getNumberOfNodes(); j++)
                 {
-                    if (is_mixed_high_order_linear_elems)
-                    {
-                        if (node_id < _mesh->getNumberOfBaseNodes())
-                            partition.nodes.push_back(nodes[node_id]);
-                        else
-                            extra_nodes.push_back(nodes[node_id]);
-                    }
+                    const std::size_t node_id = ghost_elem->getNodeIndex(j);
+                    if (_nodes_partition_ids[node_id] == part_id ||
+                        nodes_reserved[node_id] == part_id)
+                        continue;
+
+                    if (is_mixed_high_order_linear_elems &&
+                        node_id >= _mesh->getNumberOfBaseNodes())
+                        extra_nodes[part_id].push_back(nodes[node_id]);
                     else
-                    {
                         partition.nodes.push_back(nodes[node_id]);
-                    }
-                    nodes_reserved[node_id] = true;
+                    nodes_reserved[node_id] = part_id;
                 }
             }
-        }
-        partition.number_of_base_nodes = partition.nodes.size();
+            partition.number_of_base_nodes = partition.nodes.size();
 
-        if (is_mixed_high_order_linear_elems)
-            partition.nodes.insert(partition.nodes.end(), extra_nodes.begin(),
-                                   extra_nodes.end());
+            if (is_mixed_high_order_linear_elems)
+                partition.nodes.insert(partition.nodes.end(),
+                                       extra_nodes[part_id].begin(),
+                                       extra_nodes[part_id].end());
+        }
     }
 
     renumberNodeIndices(is_mixed_high_order_linear_elems);
@@ -334,52 +460,82 @@ void NodeWiseMeshPartitioner::writeElementsBinary
     fname =
         file_name_base + "_partitioned_msh_ele_g" + npartitions_str + ".bin";
     FILE* of_bin_ele_g = fopen(fname.c_str(), "wb");
-    for (std::size_t i = 0; i < _partitions.size(); i++)
-    {
-        const auto& partition = _partitions[i];
 
-        // Set the local node indices of the current partition.
-        IntegerType node_local_id_offset = 0;
-        std::vector<IntegerType> nodes_local_ids(_mesh->getNumberOfNodes(), -1);
-        for (const auto* node : partition.nodes)
+    // The element data of the partitions are assembled in parallel and
+    // written in the order of the partitions.
+    const std::size_t npartitions = _partitions.size();
+#ifdef _OPENMP
+    #pragma omp parallel
+#endif
+    {
+        // Local node indices of the current partition. Only the entries of
+        // the partition nodes are set, and reset afterwards.
+        std::vector<IntegerType> nodes_local_ids(_mesh->getNumberOfNodes(),
+                                                 -1);
+        std::vector<IntegerType> ele_info;
+        std::vector<IntegerType> ghost_ele_info;
+#ifdef _OPENMP
+        #pragma omp for ordered schedule(static, 1)
+        for (OPENMP_LOOP_TYPE k = 0; k < npartitions; k++)
+#else
+        for (std::size_t k = 0; k < npartitions; k++)
+#endif
         {
-            nodes_local_ids[node->getID()] = node_local_id_offset;
-            node_local_id_offset++;
-        }
+            const std::size_t i = k;
+            const auto& partition = _partitions[i];
 
-        // A vector contians all element integer variales of
-        // the non-ghost elements of this partition
-        std::vector<IntegerType> ele_info(num_elem_integers[i]);
+            // Set the local node indices of the current partition.
+            IntegerType node_local_id_offset = 0;
+            for (const auto* node : partition.nodes)
+            {
+                nodes_local_ids[node->getID()] = node_local_id_offset;
+                node_local_id_offset++;
+            }
 
-        // Non-ghost elements.
-        IntegerType counter = partition.regular_elements.size();
+            // A vector contians all element integer variales of
+            // the non-ghost elements of this partition
+            ele_info.resize(num_elem_integers[i]);
 
-        for (std::size_t j = 0; j < partition.regular_elements.size(); j++)
-        {
-            const auto* elem = partition.regular_elements[j];
-            ele_info[j] = counter;
-            getElementIntegerVariables(*elem, nodes_local_ids, ele_info,
-                                       counter);
-        }
-        // Write vector data of non-ghost elements
-        fwrite(ele_info.data(), 1, (num_elem_integers[i]) * sizeof(IntegerType),
-               of_bin_ele);
+            // Non-ghost elements.
+            IntegerType counter = partition.regular_elements.size();
 
-        // Ghost elements
-        ele_info.resize(num_g_elem_integers[i]);
+            for (std::size_t j = 0; j < partition.regular_elements.size(); j++)
+            {
+                const auto* elem = partition.regular_elements[j];
+                ele_info[j] = counter;
+                getElementIntegerVariables(*elem, nodes_local_ids, ele_info,
+                                           counter);
+            }
 
-        counter = partition.ghost_elements.size();
+            // Ghost elements
+            ghost_ele_info.resize(num_g_elem_integers[i]);
 
-        for (std::size_t j = 0; j < partition.ghost_elements.size(); j++)
-        {
-            const auto* elem = partition.ghost_elements[j];
-            ele_info[j] = counter;
-            getElementIntegerVariables(*elem, nodes_local_ids, ele_info,
-                                       counter);
+            counter = partition.ghost_elements.size();
+
+            for (std::size_t j = 0; j < partition.ghost_elements.size(); j++)
+            {
+                const auto* elem = partition.ghost_elements[j];
+                ghost_ele_info[j] = counter;
+                getElementIntegerVariables(*elem, nodes_local_ids,
+                                           ghost_ele_info, counter);
+            }
+
+            for (const auto* node : partition.nodes)
+                nodes_local_ids[node->getID()] = -1;
+
+#ifdef _OPENMP
+            #pragma omp ordered
+#endif
+            {
+                // Write vector data of non-ghost and ghost elements
+                fwrite(ele_info.data(), 1,
+                       (num_elem_integers[i]) * sizeof(IntegerType),
+                       of_bin_ele);
+                fwrite(ghost_ele_info.data(), 1,
+                       (num_g_elem_integers[i]) * sizeof(IntegerType),
+                       of_bin_ele_g);
+            }
         }
-        // Write vector data of ghost elements
-        fwrite(ele_info.data(), 1, (num_g_elem_integers[i]) * sizeof(IntegerType),
-               of_bin_ele_g);
     }
 
     fclose(of_bin_ele);
@@ -424,6 +580,135 @@ void NodeWiseMeshPartitioner::writeBinary(const std::string& file_name_base)
                         num_g_elem_integers);
 
     writeNodesBinary(file_name_base);
+
+    writePropertiesBinary(file_name_base);
+}
+
+/// Checks if the property vector exists with type T and is defined for all
+/// nodes or for all cells of the mesh.
+template <typename T>
+static bool isPartitionableProperty(MeshLib::Mesh const& mesh,
+                                    std::string const& name)
+{
+    auto const pv = mesh.getProperties().getPropertyVector<T>(name);
+    if (!pv)
+        return false;
+
+    return (pv->getMeshItemType() == MeshLib::MeshItemType::Node &&
+            pv->getNumberOfTuples() == mesh.getNumberOfNodes()) ||
+           (pv->getMeshItemType() == MeshLib::MeshItemType::Cell &&
+            pv->getNumberOfTuples() == mesh.getNumberOfElements());
+}
+
+/// Writes the configuration record and the values of a property vector of
+/// type T for all partitions.
+/// \return false if the property vector is not of type T.
+template <typename T>
+static bool writePropertyVectorBinary(
+    MeshLib::Mesh const& mesh, std::vector<Partition> const& partitions,
+    std::string const& name, NodeWiseMeshPartitioner::IntegerType data_type,
+    FILE* of_bin_cfg, FILE* of_bin_val,
+    NodeWiseMeshPartitioner::IntegerType& offset)
+{
+    using IntegerType = NodeWiseMeshPartitioner::IntegerType;
+
+    if (!isPartitionableProperty<T>(mesh, name))
+        return false;
+    auto const pv = mesh.getProperties().getPropertyVector<T>(name);
+    const std::size_t n_components = pv->getNumberOfComponents();
+    const bool is_node_property =
+        pv->getMeshItemType() == MeshLib::MeshItemType::Node;
+
+    const IntegerType name_length = name.size();
+    fwrite(&name_length, sizeof(IntegerType), 1, of_bin_cfg);
+    fwrite(name.data(), 1, name.size(), of_bin_cfg);
+    const IntegerType header[3] = {
+        static_cast<IntegerType>(pv->getMeshItemType()), data_type,
+        static_cast<IntegerType>(n_components)};
+    fwrite(header, sizeof(IntegerType), 3, of_bin_cfg);
+    for (const auto& partition : partitions)
+    {
+        fwrite(&offset, sizeof(IntegerType), 1, of_bin_cfg);
+        const std::size_t n_items =
+            is_node_property ? partition.nodes.size()
+                             : partition.regular_elements.size() +
+                                   partition.ghost_elements.size();
+        offset += n_items * n_components * sizeof(T);
+    }
+
+    std::vector<T> values;
+    for (const auto& partition : partitions)
+    {
+        values.clear();
+        auto const add_values = [&](std::size_t const item_id)
+        {
+            values.insert(values.end(),
+                          pv->begin() + item_id * n_components,
+                          pv->begin() + (item_id + 1) * n_components);
+        };
+
+        if (is_node_property)
+        {
+            for (const auto* node : partition.nodes)
+                add_values(node->getID());
+        }
+        else
+        {
+            for (const auto* elem : partition.regular_elements)
+                add_values(elem->getID());
+            for (const auto* elem : partition.ghost_elements)
+                add_values(elem->getID());
+        }
+        fwrite(values.data(), sizeof(T), values.size(), of_bin_val);
+    }
+    return true;
+}
+
+void NodeWiseMeshPartitioner::writePropertiesBinary(
+    const std::string& file_name_base)
+{
+    std::vector<std::string> property_names;
+    for (auto const& name : _mesh->getProperties().getPropertyVectorNames())
+    {
+        if (isPartitionableProperty<double>(*_mesh, name) ||
+            isPartitionableProperty<int>(*_mesh, name))
+        {
+            property_names.push_back(name);
+        }
+        else
+        {
+            WARN(
+                "Property '%s' is not written to the partitioned mesh; only "
+                "node and cell properties of type double or int are "
+                "supported.",
+                name.c_str());
+        }
+    }
+    if (property_names.empty())
+        return;
+
+    const std::string npartitions_str = std::to_string(_npartitions);
+    std::string fname = file_name_base + "_partitioned_msh_props_cfg" +
+                        npartitions_str + ".bin";
+    FILE* of_bin_cfg = fopen(fname.c_str(), "wb");
+    fname = file_name_base + "_partitioned_msh_props_val" + npartitions_str +
+            ".bin";
+    FILE* of_bin_val = fopen(fname.c_str(), "wb");
+
+    const IntegerType number_of_properties = property_names.size();
+    fwrite(&number_of_properties, sizeof(IntegerType), 1, of_bin_cfg);
+
+    IntegerType offset = 0;
+    for (auto const& name : property_names)
+    {
+        if (!writePropertyVectorBinary<double>(*_mesh, _partitions, name, 0,
+                                               of_bin_cfg, of_bin_val, offset))
+            writePropertyVectorBinary<int>(*_mesh, _partitions, name, 1,
+                                           of_bin_cfg, of_bin_val, offset);
+    }
+
+    fclose(of_bin_cfg);
+    fclose(of_bin_val);
 }
 
 void NodeWiseMeshPartitioner::writeConfigDataASCII
@@ -468,26 +753,55 @@ void NodeWiseMeshPartitioner::writeElementsASCII(const std::string& file_name_ba
     const std::string fname = file_name_base + "_partitioned_elems_"
                               + std::to_string(_npartitions) + ".msh";
     std::fstream os_subd(fname, std::ios::out | std::ios::trunc);
-    for (const auto& partition : _partitions)
+
+    // The element data of the partitions are formatted in parallel and
+    // written in the order of the partitions.
+    const std::size_t npartitions = _partitions.size();
+#ifdef _OPENMP
+    #pragma omp parallel
+#endif
     {
-        // Set the local node indices of the current partition.
-        IntegerType node_local_id_offset = 0;
-        std::vector<IntegerType> nodes_local_ids(_mesh->getNumberOfNodes(), -1);
-        for (const auto* node : partition.nodes)
+        // Local node indices of the current partition. Only the entries of
+        // the partition nodes are set, and reset afterwards.
+        std::vector<IntegerType> nodes_local_ids(_mesh->getNumberOfNodes(),
+                                                 -1);
+#ifdef _OPENMP
+        #pragma omp for ordered schedule(static, 1)
+        for (OPENMP_LOOP_TYPE k = 0; k < npartitions; k++)
+#else
+        for (std::size_t k = 0; k < npartitions; k++)
+#endif
         {
-            nodes_local_ids[node->getID()] = node_local_id_offset;
-            node_local_id_offset++;
-        }
+            const auto& partition = _partitions[k];
 
-        for (const auto* elem : partition.regular_elements)
-        {
-            writeLocalElementNodeIndices(os_subd, *elem, nodes_local_ids);
-        }
-        for (const auto* elem : partition.ghost_elements)
-        {
-            writeLocalElementNodeIndices(os_subd, *elem, nodes_local_ids);
+            // Set the local node indices of the current partition.
+            IntegerType node_local_id_offset = 0;
+            for (const auto* node : partition.nodes)
+            {
+                nodes_local_ids[node->getID()] = node_local_id_offset;
+                node_local_id_offset++;
+            }
+
+            std::ostringstream os_partition;
+            for (const auto* elem : partition.regular_elements)
+            {
+                writeLocalElementNodeIndices(os_partition, *elem,
+                                             nodes_local_ids);
+            }
+            for (const auto* elem : partition.ghost_elements)
+            {
+                writeLocalElementNodeIndices(os_partition, *elem,
+                                             nodes_local_ids);
+            }
+
+            for (const auto* node : partition.nodes)
+                nodes_local_ids[node->getID()] = -1;
+
+#ifdef _OPENMP
+            #pragma omp ordered
+#endif
+            os_subd << os_partition.str() << std::endl;
         }
-        os_subd << std::endl;
     }
 }
 
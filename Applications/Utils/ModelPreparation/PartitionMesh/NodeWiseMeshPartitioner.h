@@ -55,12 +55,14 @@ public:
           _partitions(num_partitions),
           _mesh(std::move(mesh)),
           _nodes_global_ids(_mesh->getNumberOfNodes()),
-          _nodes_partition_ids(_mesh->getNumberOfNodes()),
-          _elements_status(_mesh->getNumberOfElements(), false)
+          _nodes_partition_ids(_mesh->getNumberOfNodes())
     {
     }
 
-    /// Partition by node.
+    /// Partition by node, i.e. collect the nodes, the regular elements and
+    /// the ghost elements of all partitions according to the partition IDs
+    /// of the nodes. The nodes and elements are each visited once, and the
+    /// ghost nodes of the partitions are collected in parallel.
     /// \param is_mixed_hl_elem Flag to indicate whether the elements of
     /// a mesh can be used for both linear and high order interpolation
     void partitionByMETIS(const bool is_mixed_high_order_linear_elems);
@@ -71,6 +73,26 @@ public:
     /// \param file_name_base The prefix of the file name.
     void readMetisData(const std::string& file_name_base);
 
+    /// Compute the partition IDs of the nodes by calling
+    /// METIS_PartMeshNodal directly, i.e. without the METIS input and output
+    /// files used by readMetisData().
+    void partitionNodesByMETIS();
+
+    /// Compute the partition IDs of the nodes by recursive coordinate
+    /// bisection: the node set is split recursively at the median of its
+    /// longest bounding box axis into parts with sizes proportional to the
+    /// number of partitions assigned to them. This needs no external tool,
+    /// but the partition interfaces are generally larger than the ones
+    /// computed by METIS.
+    void partitionNodesByCoordinateBisection();
+
+    /// Partition IDs of the nodes as read by readMetisData() or computed by
+    /// partitionNodesByMETIS() or partitionNodesByCoordinateBisection().
+    std::vector<std::size_t> const& getNodesPartitionIDs() const
+    {
+        return _nodes_partition_ids;
+    }
+
     /// Write mesh to METIS input file
     /// \param file_name File name with an extension of mesh.
     void writeMETIS(const std::string& file_name);
@@ -103,9 +125,6 @@ private:
     /// Partition IDs of each nodes.
     std::vector<std::size_t> _nodes_partition_ids;
 
-    /// Flags to indicate that whether elements are processed or not.
-    std::vector<bool> _elements_status;
-
     // Renumber the global indices of nodes,
     /// \param is_mixed_hl_elem Flag to indicate whether the elements of
     /// a mesh can be used for both linear and high order interpolation
@@ -165,6 +184,23 @@ private:
     ///  \param file_name_base The prefix of the file name.
     void writeNodesBinary(const std::string& file_name_base);
 
+    /*!
+         \brief Write the node and cell properties of type double or int of
+                all partitions into two binary files:
+                file_name_base+_partitioned_msh_props_cfg[number of partitions].bin
+                file_name_base+_partitioned_msh_props_val[number of partitions].bin
+                The first file contains the number of properties followed by
+                a record for each property: the length of the name, the name,
+                the mesh item type, the data type (0: double, 1: int), the
+                number of components, and the byte offsets of the values of
+                each partition in the second file.
+                The values of a partition are given for the partition nodes,
+                or for the regular elements followed by the ghost elements.
+                No files are written if there are no such properties.
+         \param file_name_base The prefix of the file name.
+    */
+    void writePropertiesBinary(const std::string& file_name_base);
+
 
     /// Write the configuration data of the partition data in ASCII files.
     /// \param file_name_base The prefix of the file name.
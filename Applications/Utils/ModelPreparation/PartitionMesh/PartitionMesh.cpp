@@ -37,7 +37,8 @@ int main(int argc, char* argv[])
         "Partition a mesh for parallel computing."
         "The tasks of this tool are in twofold:\n"
         "1. Convert mesh file to the input file of the partitioning tool,\n"
-        "2. Partition a mesh using the partitioning tool,\n"
+        "2. Partition a mesh using the METIS library, a recursive\n"
+        "\tcoordinate bisection, or the output of mpmetis,\n"
         "\tcreate the mesh data of each partition,\n"
         "\trenumber the node indices of each partition,\n"
         "\tand output the results for parallel computing.\n"
@@ -64,11 +65,27 @@ int main(int argc, char* argv[])
         false);
     cmd.add(exe_metis_flag);
 
+    std::vector<std::string> partitioners{"metis", "rcb"};
+    TCLAP::ValuesConstraint<std::string> allowed_partitioners(partitioners);
+    TCLAP::ValueArg<std::string> partitioner_arg(
+        "p", "partitioner",
+        "Partition the mesh inside this tool instead of reading the output "
+        "files of mpmetis: 'metis' calls the METIS library, 'rcb' uses a "
+        "recursive coordinate bisection of the nodes. Without this option "
+        "the partitioning is read from the mpmetis output files, which is "
+        "the previous behaviour. Cannot be combined with -m.",
+        false, "metis", &allowed_partitioners);
+    cmd.add(partitioner_arg);
+
     TCLAP::SwitchArg lh_elems_flag(
         "q", "lh_elements", "Mixed linear and high order elements.", false);
     cmd.add(lh_elems_flag);
 
-    TCLAP::SwitchArg ascii_flag("a", "ascii", "Enable ASCII output.", false);
+    TCLAP::SwitchArg ascii_flag(
+        "a", "ascii",
+        "Enable ASCII output. The mesh properties are only written to the "
+        "binary output, which is the default.",
+        false);
     cmd.add(ascii_flag);
 
     cmd.parse(argc, argv);
@@ -99,6 +116,12 @@ int main(int argc, char* argv[])
     {
         const int num_partitions = nparts.getValue();
 
+        if (exe_metis_flag.getValue() && partitioner_arg.isSet())
+        {
+            ERR("The options -m and -p are mutually exclusive.");
+            return EXIT_FAILURE;
+        }
+
         // Execute mpmetis via system(...)
         if (num_partitions > 1 && exe_metis_flag.getValue())
         {
@@ -120,13 +143,27 @@ int main(int argc, char* argv[])
             }
         }
 
-        mesh_partitioner.readMetisData(file_name_base);
+        if (!partitioner_arg.isSet())
+        {
+            mesh_partitioner.readMetisData(file_name_base);
+        }
+        else if (partitioner_arg.getValue() == "rcb")
+        {
+            INFO("Recursive coordinate bisection is running ...");
+            mesh_partitioner.partitionNodesByCoordinateBisection();
+        }
+        else
+        {
+            INFO("METIS is running ...");
+            mesh_partitioner.partitionNodesByMETIS();
+        }
 
         INFO("Partitioning the mesh in the node wise way ...");
         mesh_partitioner.partitionByMETIS(lh_elems_flag.getValue());
         if (ascii_flag.getValue())
         {
             INFO("Write the data of partitions into ASCII files ...");
+            WARN("Mesh properties are only written in the binary format.");
             mesh_partitioner.writeASCII(file_name_base);
         }
         else
@@ -85,5 +85,37 @@ unsigned long MemWatch::getCodeMemUsage () {
         return _cmem_size;
 }
 
+unsigned long MemWatch::getPeakResMemUsage ()
+{
+#if !defined(WIN32) && !defined(__APPLE__) && !defined(__MINGW32__)
+        std::ifstream in ("/proc/self/status", std::ios::in);
+        std::string line;
+        while (std::getline(in, line))
+        {
+                if (line.compare(0, 6, "VmHWM:") != 0)
+                        continue;
+                std::stringstream ss(line.substr(6));
+                unsigned long kb = 0;
+                ss >> kb;
+                return kb * 1024ul;
+        }
+#endif
+        return 0;
+}
+
+bool MemWatch::resetPeakResMemUsage ()
+{
+#if !defined(WIN32) && !defined(__APPLE__) && !defined(__MINGW32__)
+        // Writing "5" resets the high water mark, cf. proc(5).
+        std::ofstream out ("/proc/self/clear_refs", std::ios::out);
+        if (!out.is_open())
+                return false;
+        out << "5";
+        return static_cast<bool>(out.flush());
+#else
+        return false;
+#endif
+}
+
 } // end namespace BaseLib
 
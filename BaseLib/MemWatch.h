@@ -25,6 +25,12 @@ public:
     unsigned long getShrMemUsage ();
     unsigned long getCodeMemUsage ();
 
+    /// Peak resident set size (VmHWM) in bytes, 0 if not available.
+    unsigned long getPeakResMemUsage ();
+    /// Resets the peak resident set size to the current one. Returns false if
+    /// this is not supported by the operating system.
+    bool resetPeakResMemUsage ();
+
 private:
     unsigned updateMemUsage ();
     unsigned long _vmem_size = 0;
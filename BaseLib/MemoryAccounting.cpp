@@ -0,0 +1,206 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "MemoryAccounting.h"
+
+#include <algorithm>
+#include <ostream>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+
+namespace BaseLib
+{
+
+MemoryAccounting& MemoryAccounting::instance()
+{
+    static MemoryAccounting accounting;
+    return accounting;
+}
+
+void MemoryAccounting::add(std::string const& category,
+                           std::size_t const bytes)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto& r = _records[category];
+    r.current += bytes;
+    r.peak = std::max(r.peak, r.current);
+
+    _total += bytes;
+    if (_phase_active)
+    {
+        auto& phase = _phases.back();
+        phase.peak_accounted = std::max(phase.peak_accounted, _total);
+    }
+}
+
+void MemoryAccounting::subtract(std::string const& category,
+                                std::size_t const bytes)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto const it = _records.find(category);
+    if (it == _records.end() || it->second.current < bytes)
+    {
+        OGS_FATAL("Cannot release %lu bytes from memory category `%s'.",
+                  static_cast<unsigned long>(bytes), category.c_str());
+    }
+    it->second.current -= bytes;
+    _total -= bytes;
+}
+
+void MemoryAccounting::beginPhase(std::string const& name)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    endPhaseLocked();
+
+    _phases.emplace_back();
+    _phases.back().name = name;
+    _phases.back().peak_accounted = _total;
+    _phase_active = true;
+
+    if (!_mem_watch.resetPeakResMemUsage())
+        DBUG("Resetting the peak resident memory is not supported.");
+}
+
+void MemoryAccounting::endPhase()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    endPhaseLocked();
+}
+
+void MemoryAccounting::endPhaseLocked()
+{
+    if (!_phase_active)
+        return;
+
+    auto& phase = _phases.back();
+    phase.peak_resident = _mem_watch.getPeakResMemUsage();
+    _phase_active = false;
+
+    INFO("[memory] Phase `%s': peak accounted %g MiB, peak resident %g MiB.",
+         phase.name.c_str(), phase.peak_accounted / 1048576.0,
+         phase.peak_resident / 1048576.0);
+}
+
+std::size_t MemoryAccounting::getTotal() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _total;
+}
+
+std::map<std::string, MemoryRecord> MemoryAccounting::getRecords() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _records;
+}
+
+std::vector<MemoryPhase> MemoryAccounting::getPhases() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _phases;
+}
+
+void MemoryAccounting::writeJSON(std::ostream& os) const
+{
+    auto const records = getRecords();
+    auto const phases = getPhases();
+
+    os << "{\n  \"categories\": [";
+    bool first = true;
+    for (auto const& r : records)
+    {
+        os << (first ? "\n" : ",\n");
+        first = false;
+        os << "    {\"category\": \"" << escapeJSON(r.first) << "\""
+           << ", \"current\": " << r.second.current
+           << ", \"peak\": " << r.second.peak << "}";
+    }
+    os << "\n  ],\n  \"phases\": [";
+    first = true;
+    for (auto const& p : phases)
+    {
+        os << (first ? "\n" : ",\n");
+        first = false;
+        os << "    {\"phase\": \"" << escapeJSON(p.name) << "\""
+           << ", \"peak_accounted\": " << p.peak_accounted
+           << ", \"peak_resident\": " << p.peak_resident << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+void MemoryAccounting::writeCSV(std::ostream& os) const
+{
+    auto const records = getRecords();
+    auto const phases = getPhases();
+
+    os << "kind,name,current,peak,peak_resident\n";
+    for (auto const& r : records)
+        os << "category," << escapeCSV(r.first) << ',' << r.second.current
+           << ',' << r.second.peak << ",\n";
+    for (auto const& p : phases)
+        os << "phase," << escapeCSV(p.name) << ",," << p.peak_accounted << ','
+           << p.peak_resident << '\n';
+}
+
+void MemoryAccounting::reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _records.clear();
+    _phases.clear();
+    _total = 0;
+    _phase_active = false;
+}
+
+AccountedMemory::AccountedMemory(AccountedMemory&& other)
+    : _entries(std::move(other._entries))
+{
+    other._entries.clear();
+}
+
+AccountedMemory& AccountedMemory::operator=(AccountedMemory&& other)
+{
+    if (this != &other)
+    {
+        release();
+        _entries = std::move(other._entries);
+        other._entries.clear();
+    }
+    return *this;
+}
+
+void AccountedMemory::add(std::string const& category, std::size_t const bytes)
+{
+    MemoryAccounting::instance().add(category, bytes);
+    _entries.emplace_back(category, bytes);
+}
+
+void AccountedMemory::release()
+{
+    auto& accounting = MemoryAccounting::instance();
+    for (auto const& entry : _entries)
+    {
+        // Called from the destructor; the accounting might have been reset
+        // in the meantime.
+        try
+        {
+            accounting.subtract(entry.first, entry.second);
+        }
+        catch (std::exception const& e)
+        {
+            WARN("%s", e.what());
+        }
+    }
+    _entries.clear();
+}
+
+}  // namespace BaseLib
@@ -0,0 +1,124 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef BASELIB_MEMORYACCOUNTING_H_
+#define BASELIB_MEMORYACCOUNTING_H_
+
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "MemWatch.h"
+#include "Report.h"
+
+namespace BaseLib
+{
+
+/// Bytes currently attributed to a category and the maximum ever attributed.
+struct MemoryRecord
+{
+    std::size_t current = 0;
+    std::size_t peak = 0;
+};
+
+/// Peak memory consumption observed during a named phase of the run.
+struct MemoryPhase
+{
+    std::string name;
+    /// Maximum of the sum over all categories.
+    std::size_t peak_accounted = 0;
+    /// Peak resident set size as reported by the operating system.
+    unsigned long peak_resident = 0;
+};
+
+/// Registry attributing the memory of the large data structures (mesh,
+/// properties, DOF tables, global matrices, ...) to named categories.
+///
+/// The categories are free-form strings; a '/' can be used to group them,
+/// e.g. "mesh/nodes". Phases (e.g. "initialize", "time loop") partition the
+/// run, for each of them the peak of the accounted memory and of the resident
+/// set size are recorded.
+class MemoryAccounting final : public Report
+{
+public:
+    static MemoryAccounting& instance();
+
+    void add(std::string const& category, std::size_t const bytes);
+    void subtract(std::string const& category, std::size_t const bytes);
+
+    /// Finishes the current phase, if any, and starts a new one.
+    void beginPhase(std::string const& name);
+
+    /// Finishes the current phase.
+    void endPhase();
+
+    /// Sum of the current bytes of all categories.
+    std::size_t getTotal() const;
+
+    std::map<std::string, MemoryRecord> getRecords() const;
+
+    std::vector<MemoryPhase> getPhases() const;
+
+    void writeJSON(std::ostream& os) const override;
+    void writeCSV(std::ostream& os) const override;
+
+    /// Clears all categories and phases.
+    void reset();
+
+private:
+    MemoryAccounting() : Report("memory report") {}
+
+    /// Closes the current phase. The mutex must be held by the caller.
+    void endPhaseLocked();
+
+    mutable std::mutex _mutex;
+    std::map<std::string, MemoryRecord> _records;
+    std::size_t _total = 0;
+    std::vector<MemoryPhase> _phases;
+    bool _phase_active = false;
+    MemWatch _mem_watch;
+};
+
+/// Attributes memory to categories of the MemoryAccounting for the lifetime
+/// of the object, i.e. the added bytes are subtracted again on destruction.
+/// Owners of accounted data structures keep such an object as member.
+class AccountedMemory
+{
+public:
+    AccountedMemory() = default;
+    AccountedMemory(AccountedMemory const&) = delete;
+    AccountedMemory& operator=(AccountedMemory const&) = delete;
+    AccountedMemory(AccountedMemory&& other);
+    AccountedMemory& operator=(AccountedMemory&& other);
+
+    ~AccountedMemory() { release(); }
+
+    void add(std::string const& category, std::size_t const bytes);
+
+    /// Subtracts all bytes added to this object from the MemoryAccounting.
+    void release();
+
+private:
+    std::vector<std::pair<std::string, std::size_t>> _entries;
+};
+
+/// Heap memory held by the given vector.
+template <typename T>
+std::size_t getMemoryUsage(std::vector<T> const& v)
+{
+    return v.capacity() * sizeof(T);
+}
+
+}  // namespace BaseLib
+
+#endif  // BASELIB_MEMORYACCOUNTING_H_
@@ -0,0 +1,78 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "MemoryMappedFile.h"
+
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define OGS_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "BaseLib/Error.h"
+
+namespace BaseLib
+{
+MemoryMappedFile::MemoryMappedFile(std::string const& file_name)
+{
+#ifdef OGS_HAVE_MMAP
+    int const fd = open(file_name.c_str(), O_RDONLY);
+    if (fd == -1)
+        OGS_FATAL("Could not open file `%s'.", file_name.c_str());
+
+    struct stat file_status;
+    if (fstat(fd, &file_status) == -1)
+    {
+        close(fd);
+        OGS_FATAL("Could not determine the size of file `%s'.",
+                  file_name.c_str());
+    }
+    _size = static_cast<std::size_t>(file_status.st_size);
+
+    if (_size > 0)
+    {
+        void* const address =
+            mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address != MAP_FAILED)
+        {
+            _data = static_cast<char const*>(address);
+            _mapped = true;
+        }
+    }
+    close(fd);
+    if (_mapped || _size == 0)
+        return;
+#endif
+
+    // Fallback: read the whole file.
+    std::ifstream is(file_name, std::ios::binary | std::ios::ate);
+    if (!is)
+        OGS_FATAL("Could not open file `%s'.", file_name.c_str());
+    _size = static_cast<std::size_t>(is.tellg());
+    is.seekg(0);
+    _buffer.resize((_size + sizeof(double) - 1) / sizeof(double));
+    auto* const buffer = reinterpret_cast<char*>(_buffer.data());
+    if (!is.read(buffer, _size))
+        OGS_FATAL("Could not read file `%s'.", file_name.c_str());
+    _data = buffer;
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+#ifdef OGS_HAVE_MMAP
+    if (_mapped)
+        munmap(const_cast<char*>(_data), _size);
+#endif
+}
+
+}  // namespace BaseLib
@@ -0,0 +1,52 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef BASELIB_MEMORYMAPPEDFILE_H_
+#define BASELIB_MEMORYMAPPEDFILE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace BaseLib
+{
+/// Read-only view of the contents of a file.
+///
+/// On POSIX systems the file is mapped into memory, i.e. its pages are read
+/// on first access and shared with the page cache. On other systems the whole
+/// file is read into a buffer.
+/// The data is aligned at least to 8 bytes.
+class MemoryMappedFile final
+{
+public:
+    explicit MemoryMappedFile(std::string const& file_name);
+    ~MemoryMappedFile();
+
+    MemoryMappedFile(MemoryMappedFile const&) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile const&) = delete;
+
+    char const* data() const { return _data; }
+    std::size_t size() const { return _size; }
+
+    /// True if the file is memory mapped, false if it has been read into a
+    /// buffer.
+    bool isMapped() const { return _mapped; }
+
+private:
+    char const* _data = nullptr;
+    std::size_t _size = 0;
+    bool _mapped = false;
+
+    /// Fallback storage; uses double as value type for the alignment.
+    std::vector<double> _buffer;
+};
+
+}  // namespace BaseLib
+
+#endif  // BASELIB_MEMORYMAPPEDFILE_H_
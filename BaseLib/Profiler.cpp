@@ -0,0 +1,247 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "Profiler.h"
+
+#include <algorithm>
+#include <ostream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace BaseLib
+{
+
+void ProfilerRecord::merge(ProfilerRecord const& other)
+{
+    if (other.count == 0)
+        return;
+
+    count += other.count;
+    total += other.total;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    threads += other.threads;
+}
+
+Profiler::ThreadData::ThreadData()
+{
+    nodes.push_back(Node{0, 0, {}, {}});
+}
+
+Profiler& Profiler::instance()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::ThreadData& Profiler::getThreadData()
+{
+    // Each thread registers its data once.
+    thread_local ThreadData* data = nullptr;
+    if (!data)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _thread_data.emplace_back(new ThreadData);
+        data = _thread_data.back().get();
+    }
+    return *data;
+}
+
+std::size_t Profiler::getScopeId(std::string const& name)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto const it = _scope_ids.find(name);
+    if (it != _scope_ids.end())
+        return it->second;
+
+    _scope_names.push_back(name);
+    _scope_ids.emplace(name, _scope_names.size() - 1);
+    return _scope_names.size() - 1;
+}
+
+std::size_t Profiler::getChild(ThreadData& data, std::size_t const node,
+                               std::size_t const scope_id)
+{
+    for (auto const& child : data.nodes[node].children)
+        if (child.first == scope_id)
+            return child.second;
+
+    std::size_t const child = data.nodes.size();
+    data.nodes[node].children.emplace_back(scope_id, child);
+    // Note: references to the nodes are invalidated by the push_back.
+    data.nodes.push_back(Node{scope_id, node, {}, {}});
+    return child;
+}
+
+void Profiler::attachToSerialScope(ThreadData& data)
+{
+    ThreadData* const serial = _serial_data.load();
+    if (!serial)
+    {
+        data.current = 0;
+        return;
+    }
+
+    if (serial == data.inherited_from &&
+        serial->serial_version.load() == data.inherited_version)
+    {
+        data.current = data.inherited_node;
+        return;
+    }
+
+    std::vector<std::size_t> path;
+    std::size_t version;
+    {
+        std::lock_guard<std::mutex> lock(serial->mutex);
+        path = serial->serial_path;
+        version = serial->serial_version.load();
+    }
+
+    std::lock_guard<std::mutex> lock(data.mutex);
+    std::size_t node = 0;
+    for (auto const scope_id : path)
+        node = getChild(data, node, scope_id);
+
+    data.current = node;
+    data.inherited_from = serial;
+    data.inherited_version = version;
+    data.inherited_node = node;
+}
+
+std::size_t Profiler::enter(std::size_t const scope_id)
+{
+    auto& data = getThreadData();
+#ifdef _OPENMP
+    bool const in_parallel = omp_in_parallel();
+    if (in_parallel && data.depth == 0)
+        attachToSerialScope(data);
+#else
+    bool const in_parallel = false;
+#endif
+    if (!in_parallel && data.depth == 0)
+        data.current = 0;
+
+    std::lock_guard<std::mutex> lock(data.mutex);
+    data.current = getChild(data, data.current, scope_id);
+    ++data.depth;
+
+    if (!in_parallel)
+    {
+        data.serial_path.push_back(scope_id);
+        ++data.serial_version;
+        if (_serial_data.load(std::memory_order_relaxed) != &data)
+            _serial_data.store(&data);
+    }
+    return data.current;
+}
+
+void Profiler::leave(std::size_t const node, double const seconds)
+{
+    auto& data = getThreadData();
+#ifdef _OPENMP
+    bool const in_parallel = omp_in_parallel();
+#else
+    bool const in_parallel = false;
+#endif
+
+    std::lock_guard<std::mutex> lock(data.mutex);
+    auto& n = data.nodes[node];
+    n.record.add(seconds);
+    data.current = n.parent;
+    --data.depth;
+
+    if (!in_parallel && !data.serial_path.empty())
+    {
+        data.serial_path.pop_back();
+        ++data.serial_version;
+    }
+}
+
+std::string Profiler::getPath(ThreadData const& data, std::size_t node) const
+{
+    std::string path = _scope_names[data.nodes[node].scope_id];
+    for (node = data.nodes[node].parent; node != 0;
+         node = data.nodes[node].parent)
+        path = _scope_names[data.nodes[node].scope_id] + "/" + path;
+    return path;
+}
+
+std::map<std::string, ProfilerRecord> Profiler::getRecords() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    std::map<std::string, ProfilerRecord> records;
+    for (auto const& data : _thread_data)
+    {
+        std::lock_guard<std::mutex> data_lock(data->mutex);
+        for (std::size_t i = 1; i < data->nodes.size(); ++i)
+        {
+            auto record = data->nodes[i].record;
+            if (record.count == 0)
+                continue;
+            record.threads = 1;
+            records[getPath(*data, i)].merge(record);
+        }
+    }
+    return records;
+}
+
+void Profiler::writeJSON(std::ostream& os) const
+{
+    auto const records = getRecords();
+
+    os << "[\n";
+    bool first = true;
+    for (auto const& r : records)
+    {
+        if (!first)
+            os << ",\n";
+        first = false;
+
+        auto const& rec = r.second;
+        os << "  {\"scope\": \"" << escapeJSON(r.first) << "\""
+           << ", \"count\": " << rec.count
+           << ", \"total\": " << rec.total
+           << ", \"mean\": " << rec.total / rec.count
+           << ", \"min\": " << rec.min
+           << ", \"max\": " << rec.max
+           << ", \"threads\": " << rec.threads << "}";
+    }
+    os << "\n]\n";
+}
+
+void Profiler::writeCSV(std::ostream& os) const
+{
+    auto const records = getRecords();
+
+    os << "scope,count,total,mean,min,max,threads\n";
+    for (auto const& r : records)
+    {
+        auto const& rec = r.second;
+        os << escapeCSV(r.first) << ',' << rec.count << ',' << rec.total << ','
+           << rec.total / rec.count << ',' << rec.min << ',' << rec.max << ','
+           << rec.threads << '\n';
+    }
+}
+
+void Profiler::reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& data : _thread_data)
+    {
+        std::lock_guard<std::mutex> data_lock(data->mutex);
+        for (auto& node : data->nodes)
+            node.record = ProfilerRecord{};
+    }
+}
+
+}  // namespace BaseLib
@@ -0,0 +1,208 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef BASELIB_PROFILER_H_
+#define BASELIB_PROFILER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Report.h"
+
+namespace BaseLib
+{
+
+/// Accumulated timings of one profiled scope.
+struct ProfilerRecord
+{
+    std::size_t count = 0;
+    double total = 0.0;
+    double min = std::numeric_limits<double>::max();
+    double max = 0.0;
+    /// Number of threads that entered the scope at least once.
+    std::size_t threads = 0;
+
+    void add(double const t)
+    {
+        ++count;
+        total += t;
+        if (t < min) min = t;
+        if (t > max) max = t;
+    }
+
+    void merge(ProfilerRecord const& other);
+};
+
+/// Registry of hierarchical, per-thread accumulated timings.
+///
+/// Scopes are entered and left via ScopedTimer. Nested scopes are recorded
+/// under the path of their enclosing scopes, e.g.
+/// "time step/nonlinear iteration/assembly". The scope names are interned
+/// once by getScopeId(), entering a scope then only searches the few children
+/// of the current scope for the id.
+///
+/// Every thread accumulates into its own tree of records guarded by its own,
+/// practically uncontended mutex; the trees are merged only when a report is
+/// requested. Scopes entered by an OpenMP worker thread outside of any of its
+/// own scopes are attached below the scopes which were active in the thread
+/// that started the parallel region, e.g. a scope opened in a parallel loop
+/// over the elements during the assembly is recorded as
+/// ".../assembly/<scope>" for all threads. Other threads, e.g. std::threads,
+/// start their own hierarchy at the root.
+class Profiler final : public Report
+{
+public:
+    static Profiler& instance();
+
+    /// Returns the id of the scope name \c name, which is registered on the
+    /// first call. The id should be obtained once per call site, e.g. in a
+    /// function-local static variable.
+    std::size_t getScopeId(std::string const& name);
+
+    /// Enters the scope \c scope_id below the currently active scope of the
+    /// calling thread and returns an opaque handle for leave().
+    std::size_t enter(std::size_t const scope_id);
+
+    /// Leaves the scope identified by \c node and accumulates \c seconds.
+    void leave(std::size_t const node, double const seconds);
+
+    /// Returns the records of all threads merged by their scope paths.
+    std::map<std::string, ProfilerRecord> getRecords() const;
+
+    /// Writes the merged records as a JSON array to \c os.
+    void writeJSON(std::ostream& os) const override;
+
+    /// Writes the merged records as CSV table to \c os.
+    void writeCSV(std::ostream& os) const override;
+
+    /// Clears all recorded timings. Must not be called while any
+    /// ScopedTimer is alive.
+    void reset();
+
+private:
+    struct Node
+    {
+        std::size_t scope_id;
+        std::size_t parent;
+        /// Pairs of scope id and node index.
+        std::vector<std::pair<std::size_t, std::size_t>> children;
+        ProfilerRecord record;
+    };
+
+    struct ThreadData
+    {
+        ThreadData();
+
+        /// Guards the nodes against concurrent getRecords() and reset().
+        std::mutex mutex;
+        std::vector<Node> nodes;  ///< nodes[0] is the root.
+        std::size_t current = 0;
+        /// Number of scopes entered and not yet left by this thread.
+        std::size_t depth = 0;
+
+        /// Scope ids of the active scopes entered outside of parallel regions
+        /// and a counter of their modifications.
+        std::vector<std::size_t> serial_path;
+        std::atomic<std::size_t> serial_version{0};
+
+        /// The serial data and version the node inherited_node was created
+        /// for, cf. attachToSerialScope().
+        ThreadData const* inherited_from = nullptr;
+        std::size_t inherited_version = 0;
+        std::size_t inherited_node = 0;
+    };
+
+    Profiler() : Report("profiling report") {}
+
+    ThreadData& getThreadData();
+
+    /// Returns the index of the child \c scope_id of \c node, which is
+    /// created if it doesn't exist.
+    static std::size_t getChild(ThreadData& data, std::size_t const node,
+                                std::size_t const scope_id);
+
+    /// Sets the current node of the worker thread \c data to the node
+    /// corresponding to the active scopes of the thread which entered a
+    /// scope outside of any parallel region last.
+    void attachToSerialScope(ThreadData& data);
+
+    std::string getPath(ThreadData const& data, std::size_t node) const;
+
+    /// Guards the scope names and the list of thread data.
+    mutable std::mutex _mutex;
+    std::vector<std::string> _scope_names;
+    std::unordered_map<std::string, std::size_t> _scope_ids;
+    std::vector<std::unique_ptr<ThreadData>> _thread_data;
+    std::atomic<ThreadData*> _serial_data{nullptr};
+};
+
+/// Measures the time between construction and destruction and accumulates it
+/// in the Profiler under the given scope.
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(std::size_t const scope_id)
+        : _node(Profiler::instance().enter(scope_id)),
+          _start(std::chrono::steady_clock::now())
+    {
+    }
+
+    /// Convenience constructor for rarely entered scopes; the name is looked
+    /// up on every construction.
+    explicit ScopedTimer(std::string const& name)
+        : ScopedTimer(Profiler::instance().getScopeId(name))
+    {
+    }
+
+    ScopedTimer(ScopedTimer const&) = delete;
+    ScopedTimer& operator=(ScopedTimer const&) = delete;
+
+    ~ScopedTimer()
+    {
+        Profiler::instance().leave(_node, elapsed());
+    }
+
+    /// Seconds since construction.
+    double elapsed() const
+    {
+        return std::chrono::duration<double>(
+                   std::chrono::steady_clock::now() - _start).count();
+    }
+
+private:
+    std::size_t const _node;
+    std::chrono::steady_clock::time_point const _start;
+};
+
+}  // namespace BaseLib
+
+#define OGS_PROFILE_CONCAT_(a, b) a##b
+#define OGS_PROFILE_CONCAT(a, b) OGS_PROFILE_CONCAT_(a, b)
+
+/// Measures the rest of the enclosing block under the scope \c name. The name
+/// is registered once per call site in a function-local static variable.
+#define OGS_PROFILE_SCOPE(name)                                             \
+    static std::size_t const OGS_PROFILE_CONCAT(ogs_profile_scope_,        \
+                                                __LINE__) =                \
+        ::BaseLib::Profiler::instance().getScopeId(name);                  \
+    ::BaseLib::ScopedTimer const OGS_PROFILE_CONCAT(ogs_profile_timer_,    \
+                                                    __LINE__)(             \
+        OGS_PROFILE_CONCAT(ogs_profile_scope_, __LINE__))
+
+#endif  // BASELIB_PROFILER_H_
@@ -0,0 +1,100 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "Report.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
+
+namespace BaseLib
+{
+
+void Report::writeReport(std::string const& file_name) const
+{
+    std::ofstream os(file_name);
+    if (!os)
+        OGS_FATAL("Could not open file `%s' for writing the %s.",
+                  file_name.c_str(), _description.c_str());
+
+    os.precision(9);
+
+    if (hasFileExtension("csv", file_name))
+        writeCSV(os);
+    else
+        writeJSON(os);
+
+    INFO("Wrote %s to `%s'.", _description.c_str(), file_name.c_str());
+}
+
+std::string escapeJSON(std::string const& s)
+{
+    std::string escaped;
+    escaped.reserve(s.size());
+    for (char const c : s)
+    {
+        switch (c)
+        {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char buffer[7];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04x",
+                                  static_cast<unsigned>(c));
+                    escaped += buffer;
+                }
+                else
+                    escaped.push_back(c);
+        }
+    }
+    return escaped;
+}
+
+std::string escapeCSV(std::string const& s)
+{
+    if (s.find_first_of(",\"\r\n") == std::string::npos)
+        return s;
+
+    std::string escaped = "\"";
+    for (char const c : s)
+    {
+        if (c == '"')
+            escaped.push_back('"');
+        escaped.push_back(c);
+    }
+    escaped.push_back('"');
+    return escaped;
+}
+
+std::string getRankFileName(std::string const& file_name, int const rank)
+{
+    std::string const extension = getFileExtension(file_name);
+    std::string const suffix = "_" + std::to_string(rank);
+    if (extension.empty())
+        return file_name + suffix;
+    return dropFileExtension(file_name) + suffix + "." + extension;
+}
+
+}  // namespace BaseLib
@@ -0,0 +1,56 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef BASELIB_REPORT_H_
+#define BASELIB_REPORT_H_
+
+#include <iosfwd>
+#include <string>
+
+namespace BaseLib
+{
+
+/// Base of the run-time reports, e.g. of the Profiler and of the
+/// MemoryAccounting, which are written either as JSON or as CSV table.
+class Report
+{
+public:
+    virtual ~Report() = default;
+
+    virtual void writeJSON(std::ostream& os) const = 0;
+    virtual void writeCSV(std::ostream& os) const = 0;
+
+    /// Writes the report to \c file_name. If the file extension is "csv" a
+    /// CSV table is written, JSON otherwise.
+    void writeReport(std::string const& file_name) const;
+
+protected:
+    /// \param description is used in messages, e.g. "profiling report".
+    explicit Report(std::string description)
+        : _description(std::move(description))
+    {
+    }
+
+private:
+    std::string const _description;
+};
+
+/// Escapes quotes, backslashes and control characters for a JSON string.
+std::string escapeJSON(std::string const& s);
+
+/// Quotes the CSV field if it contains a separator, a quote or a line break.
+std::string escapeCSV(std::string const& s);
+
+/// Inserts the \c rank before the file extension, e.g. "profile.csv" becomes
+/// "profile_1.csv", such that every MPI process writes its own report.
+std::string getRankFileName(std::string const& file_name, int const rank);
+
+}  // namespace BaseLib
+
+#endif  // BASELIB_REPORT_H_
@@ -15,6 +15,7 @@
 #ifndef GRID_H_
 #define GRID_H_
 
+#include <algorithm>
 #include <bitset>
 #include <vector>
 
@@ -382,9 +383,10 @@ std::array<std::size_t,3> Grid<POINT>::getGridCoords(T const& pnt) const
             if (pnt[k] > _max_pnt[k]) {
                 coords[k] = _n_steps[k]-1;
             } else {
-                coords[k] = static_cast<std::size_t>(
-                    std::floor((pnt[k] - _min_pnt[k])) *
-                    _inverse_step_sizes[k]);
+                coords[k] = std::min(
+                    static_cast<std::size_t>(std::floor(
+                        (pnt[k] - _min_pnt[k]) * _inverse_step_sizes[k])),
+                    _n_steps[k] - 1);
             }
         }
     }
@@ -252,7 +252,7 @@ bool Polygon::getNextIntersectionPointPolygonLine(
     return false;
 }
 
-const std::list<Polygon*>& Polygon::getListOfSimplePolygons()
+const std::list<Polygon*>& Polygon::getListOfSimplePolygons() const
 {
     return _simple_polygon_list;
 }
@@ -110,7 +110,7 @@ public:
                                              std::size_t& seg_num) const;
 
     void computeListOfSimplePolygons ();
-    const std::list<Polygon*>& getListOfSimplePolygons ();
+    const std::list<Polygon*>& getListOfSimplePolygons () const;
 
     friend bool operator==(Polygon const& lhs, Polygon const& rhs);
 private:
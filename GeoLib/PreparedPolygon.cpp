@@ -0,0 +1,188 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "PreparedPolygon.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "AABB.h"
+#include "Polygon.h"
+
+namespace
+{
+enum class EdgeClassification
+{
+    TOUCHING,
+    CROSSING,
+    INESSENTIAL
+};
+
+/// Classifies the edge (v, w) with respect to the point (x, y) in the same
+/// way as Polyline::getLocationOfPoint() and Polygon::getEdgeType() do.
+template <typename Edge>
+EdgeClassification classifyEdge(Edge const& e, double const x, double const y)
+{
+    long double const a[2] = {e.x1 - e.x0, e.y1 - e.y0};
+    long double const b[2] = {x - e.x0, y - e.y0};
+    long double const det_2x2(a[0] * b[1] - a[1] * b[0]);
+
+    if (det_2x2 > std::numeric_limits<double>::epsilon())  // left
+        return (e.y0 < y && y <= e.y1) ? EdgeClassification::CROSSING
+                                       : EdgeClassification::INESSENTIAL;
+    if (std::numeric_limits<double>::epsilon() < std::abs(det_2x2))  // right
+        return (e.y1 < y && y <= e.y0) ? EdgeClassification::CROSSING
+                                       : EdgeClassification::INESSENTIAL;
+    // the point is located on the line through the edge
+    if (a[0] * b[0] < 0.0 || a[1] * b[1] < 0.0)  // behind
+        return EdgeClassification::INESSENTIAL;
+    if (a[0] * a[0] + a[1] * a[1] < b[0] * b[0] + b[1] * b[1])  // beyond
+        return EdgeClassification::INESSENTIAL;
+    return EdgeClassification::TOUCHING;
+}
+
+std::size_t getSlab(double const y, double const y_begin,
+                    double const inverse_slab_height, std::size_t const n_slabs)
+{
+    if (!(y > y_begin))
+        return 0;
+    return std::min(
+        static_cast<std::size_t>((y - y_begin) * inverse_slab_height),
+        n_slabs - 1);
+}
+
+}  // anonymous namespace
+
+namespace GeoLib
+{
+PreparedPolygon::PreparedPolygon(GeoLib::Polygon const& polygon)
+{
+    std::vector<std::size_t> ids(polygon.getNumberOfPoints());
+    for (std::size_t k = 0; k < ids.size(); ++k)
+        ids[k] = polygon.getPointID(k);
+    GeoLib::AABB const aabb(polygon.getPointsVec(), ids);
+    for (unsigned d = 0; d < 2; ++d)
+    {
+        _min[d] = aabb.getMinPoint()[d];
+        _max[d] = aabb.getMaxPoint()[d];
+    }
+
+    for (auto const* simple_polygon : polygon.getListOfSimplePolygons())
+        _simple_polygons.push_back(prepare(*simple_polygon));
+}
+
+PreparedPolygon::SimplePolygon PreparedPolygon::prepare(
+    GeoLib::Polygon const& polygon)
+{
+    SimplePolygon prepared;
+    std::size_t const n_edges(polygon.getNumberOfPoints() - 1);
+    std::vector<Edge> edges(n_edges);
+    for (std::size_t k = 0; k < n_edges; ++k)
+    {
+        GeoLib::Point const& v(*polygon.getPoint(k));
+        GeoLib::Point const& w(*polygon.getPoint(k + 1));
+        edges[k] = {v[0], v[1], w[0], w[1]};
+    }
+
+    std::vector<std::size_t> ids(polygon.getNumberOfPoints());
+    for (std::size_t k = 0; k < ids.size(); ++k)
+        ids[k] = polygon.getPointID(k);
+    GeoLib::AABB const aabb(polygon.getPointsVec(), ids);
+    for (unsigned d = 0; d < 2; ++d)
+    {
+        prepared.min[d] = aabb.getMinPoint()[d];
+        prepared.max[d] = aabb.getMaxPoint()[d];
+    }
+
+    // about one edge per slab on average
+    prepared.n_slabs = std::max(n_edges, std::size_t(1));
+    prepared.y_begin = prepared.min[1];
+    double const height(prepared.max[1] - prepared.min[1]);
+    prepared.inverse_slab_height = (height > 0) ? prepared.n_slabs / height : 0;
+
+    // An edge is tested for all points whose y-coordinate is in the closed
+    // y-range of the edge, i.e. it is sorted into all slabs covering it.
+    auto const slab_range = [&prepared](Edge const& e)
+    {
+        return std::make_pair(
+            getSlab(std::min(e.y0, e.y1), prepared.y_begin,
+                    prepared.inverse_slab_height, prepared.n_slabs),
+            getSlab(std::max(e.y0, e.y1), prepared.y_begin,
+                    prepared.inverse_slab_height, prepared.n_slabs));
+    };
+
+    prepared.slab_begin.assign(prepared.n_slabs + 1, 0);
+    for (auto const& e : edges)
+    {
+        auto const range = slab_range(e);
+        for (std::size_t s = range.first; s <= range.second; ++s)
+            ++prepared.slab_begin[s + 1];
+    }
+    for (std::size_t s = 0; s < prepared.n_slabs; ++s)
+        prepared.slab_begin[s + 1] += prepared.slab_begin[s];
+
+    prepared.edges.resize(prepared.slab_begin.back());
+    std::vector<std::size_t> position(prepared.slab_begin.begin(),
+                                      prepared.slab_begin.end() - 1);
+    for (auto const& e : edges)
+    {
+        auto const range = slab_range(e);
+        for (std::size_t s = range.first; s <= range.second; ++s)
+            prepared.edges[position[s]++] = e;
+    }
+    return prepared;
+}
+
+bool PreparedPolygon::isPntInSimplePolygon(SimplePolygon const& polygon,
+                                           MathLib::Point3d const& pnt)
+{
+    double const x(pnt[0]);
+    double const y(pnt[1]);
+    if (x < polygon.min[0] || polygon.max[0] < x || y < polygon.min[1] ||
+        polygon.max[1] < y)
+        return false;
+
+    std::size_t const slab(getSlab(y, polygon.y_begin,
+                                   polygon.inverse_slab_height,
+                                   polygon.n_slabs));
+    std::size_t n_intersections(0);
+    for (std::size_t k = polygon.slab_begin[slab];
+         k < polygon.slab_begin[slab + 1]; ++k)
+    {
+        Edge const& e(polygon.edges[k]);
+        if (!((e.y0 <= y && y <= e.y1) || (e.y1 <= y && y <= e.y0)))
+            continue;
+        switch (classifyEdge(e, x, y))
+        {
+            case EdgeClassification::TOUCHING:
+                return true;
+            case EdgeClassification::CROSSING:
+                n_intersections++;
+                break;
+            case EdgeClassification::INESSENTIAL:
+                break;
+        }
+    }
+    return n_intersections % 2 == 1;
+}
+
+bool PreparedPolygon::isPntInPolygon(MathLib::Point3d const& pnt) const
+{
+    if (pnt[0] < _min[0] || _max[0] < pnt[0] || pnt[1] < _min[1] ||
+        _max[1] < pnt[1])
+        return false;
+
+    for (auto const& simple_polygon : _simple_polygons)
+        if (isPntInSimplePolygon(simple_polygon, pnt))
+            return true;
+    return false;
+}
+
+}  // end namespace GeoLib
@@ -0,0 +1,100 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef PREPAREDPOLYGON_H_
+#define PREPAREDPOLYGON_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "MathLib/Point3d.h"
+
+namespace GeoLib
+{
+class Polygon;
+
+/**
+ * A copy of the edges of a polygon prepared for many point-in-polygon
+ * queries. The y-range of the polygon is divided into horizontal slabs of
+ * equal height and every slab stores the edges whose y-range intersects the
+ * slab, such that a query only tests the edges of a single slab instead of
+ * all edges of the polygon.
+ *
+ * The classification of a point is the same as in Polygon::isPntInPolygon(),
+ * i.e. points on the boundary are inside and only the x- and y-coordinates
+ * are taken into account. The object does not refer to the polygon after
+ * construction.
+ */
+class PreparedPolygon final
+{
+public:
+    explicit PreparedPolygon(GeoLib::Polygon const& polygon);
+
+    /// Checks if the given point is inside the polygon, cf.
+    /// Polygon::isPntInPolygon().
+    bool isPntInPolygon(MathLib::Point3d const& pnt) const;
+
+    /// Returns the indices of the points that are inside of the polygon in
+    /// increasing order. If OpenMP is enabled the points are classified in
+    /// parallel.
+    template <typename POINT>
+    std::vector<std::size_t> getIndicesOfPointsInPolygon(
+        std::vector<POINT*> const& pnts) const
+    {
+        std::size_t const n_pnts(pnts.size());
+        std::vector<char> inside(n_pnts);
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(static)
+        for (OPENMP_LOOP_TYPE k = 0; k < n_pnts; ++k)
+#else
+        for (std::size_t k = 0; k < n_pnts; ++k)
+#endif
+            inside[k] = isPntInPolygon(*pnts[k]);
+
+        std::vector<std::size_t> indices;
+        for (std::size_t k = 0; k < n_pnts; ++k)
+            if (inside[k])
+                indices.push_back(k);
+        return indices;
+    }
+
+private:
+    struct Edge
+    {
+        double x0, y0, x1, y1;
+    };
+
+    /// The slab decomposition of one simple polygon.
+    struct SimplePolygon
+    {
+        /// Bounding box in the x-y-plane, half-open as GeoLib::AABB.
+        double min[2];
+        double max[2];
+        double y_begin;
+        double inverse_slab_height;
+        std::size_t n_slabs;
+        /// The edges of slab i are edges[slab_begin[i]:slab_begin[i+1]].
+        std::vector<std::size_t> slab_begin;
+        std::vector<Edge> edges;
+    };
+
+    static SimplePolygon prepare(GeoLib::Polygon const& polygon);
+
+    static bool isPntInSimplePolygon(SimplePolygon const& polygon,
+                                     MathLib::Point3d const& pnt);
+
+    /// The bounding box of the whole polygon.
+    double _min[2];
+    double _max[2];
+    std::vector<SimplePolygon> _simple_polygons;
+};
+
+}  // end namespace GeoLib
+
+#endif  // PREPAREDPOLYGON_H_
@@ -40,14 +40,17 @@ newInstance(MatrixSpecifications const& spec)
 
     if (spec.sparsity_pattern)
     {
-        // Assert that the misuse of the sparsity pattern is consistent.
-        assert(spec.sparsity_pattern->size() == 1);
-
-        auto const max_nonzeroes = spec.sparsity_pattern->front();
+        // The sparsity pattern contains the numbers of nonzeros in the
+        // diagonal block of each local row followed by the numbers of
+        // nonzeros in the off-diagonal block of each local row.
+        auto const& sparsity_pattern = *spec.sparsity_pattern;
+        assert(sparsity_pattern.size() == 2 * nrows);
 
         PETScMatrixOption mat_opt;
-        mat_opt.d_nz = max_nonzeroes;
-        mat_opt.o_nz = max_nonzeroes;
+        mat_opt.d_nnz.assign(sparsity_pattern.begin(),
+                             sparsity_pattern.begin() + nrows);
+        mat_opt.o_nnz.assign(sparsity_pattern.begin() + nrows,
+                             sparsity_pattern.end());
         mat_opt.is_global_size = false;
         return std::unique_ptr<PETScMatrix>(
             new PETScMatrix(nrows, ncols, mat_opt));
@@ -30,7 +30,9 @@ PETScMatrix::PETScMatrix (const PetscInt nrows, const PETScMatrixOption &mat_opt
         _ncols = PETSC_DECIDE;
     }
 
-    create(mat_opt.d_nz, mat_opt.o_nz);
+    create(mat_opt.d_nz, mat_opt.o_nz,
+           mat_opt.d_nnz.empty() ? nullptr : mat_opt.d_nnz.data(),
+           mat_opt.o_nnz.empty() ? nullptr : mat_opt.o_nnz.data());
 }
 
 PETScMatrix::PETScMatrix (const PetscInt nrows, const PetscInt ncols, const PETScMatrixOption &mat_opt)
@@ -45,7 +47,9 @@ PETScMatrix::PETScMatrix (const PetscInt nrows, const PetscInt ncols, const PETS
         _n_loc_cols = ncols;
     }
 
-    create(mat_opt.d_nz, mat_opt.o_nz);
+    create(mat_opt.d_nz, mat_opt.o_nz,
+           mat_opt.d_nnz.empty() ? nullptr : mat_opt.d_nnz.data(),
+           mat_opt.o_nnz.empty() ? nullptr : mat_opt.o_nnz.data());
 }
 
 PETScMatrix::PETScMatrix(const PETScMatrix &A)
@@ -122,7 +126,8 @@ void PETScMatrix::viewer(const std::string &file_name, const PetscViewerFormat v
 
 }
 
-void PETScMatrix::create(const PetscInt d_nz, const PetscInt o_nz)
+void PETScMatrix::create(const PetscInt d_nz, const PetscInt o_nz,
+                         const PetscInt* d_nnz, const PetscInt* o_nnz)
 {
     MatCreate(PETSC_COMM_WORLD, &_A);
     MatSetSizes(_A, _n_loc_rows, _n_loc_cols, _nrows, _ncols);
@@ -130,8 +135,8 @@ void PETScMatrix::create(const PetscInt d_nz, const PetscInt o_nz)
     MatSetFromOptions(_A);
 
     MatSetType(_A, MATMPIAIJ);
-    MatSeqAIJSetPreallocation(_A, d_nz, PETSC_NULL);
-    MatMPIAIJSetPreallocation(_A, d_nz, PETSC_NULL, o_nz, PETSC_NULL);
+    MatSeqAIJSetPreallocation(_A, d_nz, d_nnz);
+    MatMPIAIJSetPreallocation(_A, d_nz, d_nnz, o_nz, o_nnz);
     // If pre-allocation does not work one can use MatSetUp(_A), which is much
     // slower.
 
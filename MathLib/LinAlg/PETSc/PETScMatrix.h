@@ -250,12 +250,18 @@ class PETScMatrix
 
         /*!
           \brief Create the matrix, configure memory allocation and set the related member data.
-          \param Number of nonzeros per row in the diagonal portion of local submatrix
-                 (same value is used for all local rows),
-          \param Number of nonzeros per row in the off-diagonal portion of local submatrix
-                 (same value is used for all local rows)
+          \param d_nz  Number of nonzeros per row in the diagonal portion of local submatrix
+                       (same value is used for all local rows),
+          \param o_nz  Number of nonzeros per row in the off-diagonal portion of local submatrix
+                       (same value is used for all local rows)
+          \param d_nnz Numbers of nonzeros in the diagonal portion of each local row,
+                       or nullptr to use d_nz for all rows.
+          \param o_nnz Numbers of nonzeros in the off-diagonal portion of each local row,
+                       or nullptr to use o_nz for all rows.
         */
-        void create(const PetscInt d_nz, const PetscInt o_nz);
+        void create(const PetscInt d_nz, const PetscInt o_nz,
+                    const PetscInt* d_nnz = nullptr,
+                    const PetscInt* o_nnz = nullptr);
 
         friend bool finalizeMatrixAssembly(PETScMatrix &mat, const MatAssemblyType asm_type);
 };
@@ -14,6 +14,8 @@
 #ifndef PETSCMATRIXOPTION_H_
 #define PETSCMATRIXOPTION_H_
 
+#include <vector>
+
 #include <petscmat.h>
 
 namespace MathLib
@@ -50,6 +52,20 @@ struct PETScMatrixOption
             (same value is used for all local rows), the default is PETSC_DECIDE
     */
     PetscInt o_nz;
+
+    /*!
+     \brief Numbers of nonzeros in the diagonal portion of each local row.
+            If not empty, it is used instead of d_nz and must have one entry
+            per local row, i.e. is_global_size must be false.
+    */
+    std::vector<PetscInt> d_nnz;
+
+    /*!
+     \brief Numbers of nonzeros in the off-diagonal portion of each local row.
+            If not empty, it is used instead of o_nz and must have one entry
+            per local row, i.e. is_global_size must be false.
+    */
+    std::vector<PetscInt> o_nnz;
 };
 
 } // end namespace
@@ -11,6 +11,7 @@
 
 #include <logog/include/logog.hpp>
 
+#include "GeoLib/Grid.h"
 #include "GeoLib/Polyline.h"
 #include "GeoLib/PolylineVec.h"
 
@@ -45,6 +46,8 @@ std::unique_ptr<MeshLib::Mesh> appendLinesAlongPolylines(
     if (!new_mat_ids.empty())
         max_matID = *(std::max_element(new_mat_ids.cbegin(), new_mat_ids.cend()));
 
+    GeoLib::Grid<MeshLib::Node> const mesh_grid(mesh.getNodes().cbegin(),
+                                                mesh.getNodes().cend());
     const std::size_t n_ply (ply_vec.size());
     // for each polyline
     for (std::size_t k(0); k < n_ply; k++)
@@ -52,7 +55,8 @@ std::unique_ptr<MeshLib::Mesh> appendLinesAlongPolylines(
         const GeoLib::Polyline* ply = (*ply_vec.getVector())[k];
 
         // search nodes on the polyline
-        MeshGeoToolsLib::MeshNodesAlongPolyline mshNodesAlongPoly(mesh, *ply, mesh.getMinEdgeLength()*0.5);
+        MeshGeoToolsLib::MeshNodesAlongPolyline mshNodesAlongPoly(
+            mesh, mesh_grid, *ply, mesh.getMinEdgeLength() * 0.5);
         auto &vec_nodes_on_ply = mshNodesAlongPoly.getNodeIDs();
         if (vec_nodes_on_ply.empty()) {
             std::string ply_name;
@@ -9,6 +9,7 @@
 #include "BoundaryElementsAlongPolyline.h"
 
 #include <algorithm>
+#include <array>
 
 #include "GeoLib/Polyline.h"
 
@@ -40,17 +41,11 @@ BoundaryElementsAlongPolyline::BoundaryElementsAlongPolyline(MeshLib::Mesh const
             continue;
         // find edges on the polyline
         for (unsigned i=0; i<e->getNumberOfEdges(); i++) {
-            auto* edge = e->getEdge(i);
+            MeshLib::BoundaryView const edge(e->getEdgeView(i));
             // check if all edge nodes are along the polyline (if yes, store a distance)
             std::vector<std::size_t> edge_node_distances_along_ply;
-            if (includesAllEdgeNodeIDs(node_ids_on_poly, *edge, edge_node_distances_along_ply)) {
-                auto* new_edge = modifyEdgeNodeOrdering(*edge, ply, edge_node_distances_along_ply, node_ids_on_poly);
-                if (edge != new_edge)
-                    delete edge;
-                _boundary_elements.push_back(new_edge);
-            } else {
-                delete edge;
-            }
+            if (includesAllEdgeNodeIDs(node_ids_on_poly, edge, edge_node_distances_along_ply))
+                _boundary_elements.push_back(modifyEdgeNodeOrdering(edge, ply, edge_node_distances_along_ply, node_ids_on_poly));
         }
     }
 
@@ -72,11 +67,11 @@ BoundaryElementsAlongPolyline::~BoundaryElementsAlongPolyline()
         delete p;
 }
 
-bool BoundaryElementsAlongPolyline::includesAllEdgeNodeIDs(const std::vector<std::size_t> &vec_node_ids, const MeshLib::Element &edge, std::vector<std::size_t> &edge_node_distances) const
+bool BoundaryElementsAlongPolyline::includesAllEdgeNodeIDs(const std::vector<std::size_t> &vec_node_ids, const MeshLib::BoundaryView &edge, std::vector<std::size_t> &edge_node_distances) const
 {
     unsigned j=0;
     for (; j<edge.getNumberOfBaseNodes(); j++) {
-        auto itr = std::find(vec_node_ids.begin(), vec_node_ids.end(), edge.getNodeIndex(j));
+        auto itr = std::find(vec_node_ids.begin(), vec_node_ids.end(), edge.getNode(j)->getID());
         if (itr != vec_node_ids.end())
             edge_node_distances.push_back(std::distance(vec_node_ids.begin(), itr));
         else
@@ -85,18 +80,17 @@ bool BoundaryElementsAlongPolyline::includesAllEdgeNodeIDs(const std::vector<std
     return (j==edge.getNumberOfBaseNodes());
 }
 
-MeshLib::Element* BoundaryElementsAlongPolyline::modifyEdgeNodeOrdering(const MeshLib::Element &edge, const GeoLib::Polyline &ply, const std::vector<std::size_t> &edge_node_distances_along_ply, const std::vector<std::size_t> &node_ids_on_poly) const
+MeshLib::Element* BoundaryElementsAlongPolyline::modifyEdgeNodeOrdering(const MeshLib::BoundaryView &edge, const GeoLib::Polyline &ply, const std::vector<std::size_t> &edge_node_distances_along_ply, const std::vector<std::size_t> &node_ids_on_poly) const
 {
-    MeshLib::Element* new_edge = const_cast<MeshLib::Element*>(&edge);
     // The first node of the edge should be always closer to the beginning of the polyline than other nodes.
     // Otherwise, create a new element with reversed local node index
     if (edge_node_distances_along_ply.front() > edge_node_distances_along_ply.back()
             || (ply.isClosed() && edge_node_distances_along_ply.back() == node_ids_on_poly.size()-1)) {
-        MeshLib::Node** new_nodes = new MeshLib::Node*[edge.getNumberOfBaseNodes()];
-        std::reverse_copy(edge.getNodes(), edge.getNodes()+edge.getNumberOfBaseNodes(), new_nodes);
-        new_edge = new MeshLib::Line(new_nodes);
+        std::array<MeshLib::Node*, MeshLib::Line::n_all_nodes> new_nodes;
+        std::reverse_copy(edge.getNodes(), edge.getNodes()+edge.getNumberOfBaseNodes(), new_nodes.begin());
+        return new MeshLib::Line(new_nodes);
     }
-    return new_edge;
+    return edge.createElement();
 }
 
 } // end namespace MeshGeoToolsLib
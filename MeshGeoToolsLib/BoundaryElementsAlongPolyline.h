@@ -19,6 +19,7 @@ namespace MeshLib
 {
 class Mesh;
 class Element;
+class BoundaryView;
 }
 
 namespace MeshGeoToolsLib
@@ -63,21 +64,21 @@ private:
     /**
      * Check if a vector of node IDs includes all nodes of a given element
      * @param vec_node_ids         a vector of Node IDs
-     * @param edge                 Edge object whose node IDs are checked
+     * @param edge                 Edge whose node IDs are checked
      * @param edge_node_distances  a vector of distances of the edge nodes from the beginning of the given node ID vector
      * @return true if all element nodes are included in the vector
      */
-    bool includesAllEdgeNodeIDs(const std::vector<std::size_t> &vec_node_ids, const MeshLib::Element &edge, std::vector<std::size_t> &edge_node_distances) const;
+    bool includesAllEdgeNodeIDs(const std::vector<std::size_t> &vec_node_ids, const MeshLib::BoundaryView &edge, std::vector<std::size_t> &edge_node_distances) const;
 
     /**
-     * Modify node ordering of an edge so that its first node is closer to the beginning of a polyline than others
-     * @param edge                           Element object
+     * Create an edge element whose node ordering is modified so that its first node is closer to the beginning of a polyline than others
+     * @param edge                           Edge of a mesh element
      * @param ply                            Polyline object
      * @param edge_node_distances_along_ply  A vector of current edge node distances along poly
      * @param node_ids_on_poly               A vector of node IDs along the polyine
-     * @return A pointer to the new modified edge object. A pointer to the original edge is returned if the modification is unnecessary.
+     * @return A pointer to the new edge element. Its node ordering is the one of the original edge if the modification is unnecessary.
      */
-    MeshLib::Element* modifyEdgeNodeOrdering(const MeshLib::Element &edge, const GeoLib::Polyline &ply, const std::vector<std::size_t> &edge_node_distances_along_ply, const std::vector<std::size_t> &node_ids_on_poly) const;
+    MeshLib::Element* modifyEdgeNodeOrdering(const MeshLib::BoundaryView &edge, const GeoLib::Polyline &ply, const std::vector<std::size_t> &edge_node_distances_along_ply, const std::vector<std::size_t> &node_ids_on_poly) const;
 
     MeshLib::Mesh const& _mesh;
     GeoLib::Polyline const& _ply;
@@ -11,9 +11,14 @@
 
 #include "HeuristicSearchLength.h"
 
+#include <cmath>
+
 #include <logog/include/logog.hpp>
 
+#include "MathLib/Point3d.h"
+
 #include "MeshLib/Elements/Element.h"
+#include "MeshLib/Node.h"
 
 namespace MeshGeoToolsLib
 {
@@ -32,9 +37,9 @@ HeuristicSearchLength::HeuristicSearchLength(MeshLib::Mesh const& mesh, LengthTy
                 it != elements.cend(); ++it) {
             std::size_t const n_edges((*it)->getNumberOfEdges());
             for (std::size_t k(0); k<n_edges; k++) {
-                auto edge = (*it)->getEdge(k);    // allocation inside getEdge().
-                double const len = edge->getContent();
-                delete edge;
+                MeshLib::BoundaryView const edge((*it)->getEdgeView(k));
+                double const len = std::sqrt(
+                    MathLib::sqrDist(*edge.getNode(0), *edge.getNode(1)));
                 sum += len;
                 sum_of_sqr += len*len;
             }
@@ -119,7 +119,8 @@ MeshNodesAlongPolyline& MeshNodeSearcher::getMeshNodesAlongPolyline(GeoLib::Poly
 
     // compute nodes (and supporting points) along polyline
     _mesh_nodes_along_polylines.push_back(
-            new MeshNodesAlongPolyline(_mesh, ply, _search_length, _search_all_nodes));
+            new MeshNodesAlongPolyline(_mesh, _mesh_grid, ply, _search_length,
+                                       _search_all_nodes));
     return *_mesh_nodes_along_polylines.back();
 }
 
@@ -135,7 +136,8 @@ MeshNodesAlongSurface& MeshNodeSearcher::getMeshNodesAlongSurface(GeoLib::Surfac
 
     // compute nodes (and supporting points) along polyline
     _mesh_nodes_along_surfaces.push_back(
-            new MeshNodesAlongSurface(_mesh, sfc, _search_length, _search_all_nodes));
+            new MeshNodesAlongSurface(_mesh, _mesh_grid, sfc, _search_length,
+                                      _search_all_nodes));
     return *_mesh_nodes_along_surfaces.back();
 }
 
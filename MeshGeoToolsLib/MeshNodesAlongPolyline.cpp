@@ -13,9 +13,11 @@
 #include "MeshNodesAlongPolyline.h"
 
 #include <algorithm>
+#include <array>
 
 #include "BaseLib/quicksort.h"
 #include "MathLib/MathTools.h"
+#include "GeoLib/Grid.h"
 #include "GeoLib/Polyline.h"
 #include "MeshLib/Mesh.h"
 #include "MeshLib/Node.h"
@@ -24,6 +26,7 @@ namespace MeshGeoToolsLib
 {
 MeshNodesAlongPolyline::MeshNodesAlongPolyline(
         MeshLib::Mesh const& mesh,
+        GeoLib::Grid<MeshLib::Node> const& mesh_grid,
         GeoLib::Polyline const& ply,
         double epsilon_radius,
         bool search_all_nodes) :
@@ -31,13 +34,48 @@ MeshNodesAlongPolyline::MeshNodesAlongPolyline(
 {
     assert(epsilon_radius > 0);
     const std::size_t n_nodes (search_all_nodes ? _mesh.getNumberOfNodes() : _mesh.getNumberOfBaseNodes());
-    auto &mesh_nodes = _mesh.getNodes();
-    // loop over all nodes
-    for (std::size_t i = 0; i < n_nodes; i++) {
-        double dist = _ply.getDistanceAlongPolyline(*mesh_nodes[i], epsilon_radius);
-        if (dist >= 0.0) {
-            _msh_node_ids.push_back(mesh_nodes[i]->getID());
-            _dist_of_proj_node_from_ply_start.push_back(dist);
+
+    // Collect the grid cells near the line segments. A node found by
+    // getDistanceAlongPolyline() is at most epsilon_radius away from the line
+    // through a segment and its projection is at most epsilon_radius beyond
+    // the segment's end points.
+    std::vector<std::vector<MeshLib::Node*> const*> cells;
+    for (std::size_t k = 0; k < _ply.getNumberOfSegments(); k++) {
+        GeoLib::Point const& a(*_ply.getPoint(k));
+        GeoLib::Point const& b(*_ply.getPoint(k + 1));
+        std::array<double, 3> min_pnt, max_pnt;
+        for (unsigned d = 0; d < 3; d++) {
+            min_pnt[d] = std::min(a[d], b[d]) - 2 * epsilon_radius;
+            max_pnt[d] = std::max(a[d], b[d]) + 2 * epsilon_radius;
+        }
+        mesh_grid.getPntVecsOfGridCellsIntersectingCuboid(
+            MathLib::Point3d(min_pnt), MathLib::Point3d(max_pnt), cells);
+    }
+    std::sort(cells.begin(), cells.end());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+
+    // candidate nodes in ascending order of their ids
+    std::vector<std::size_t> candidates;
+    for (auto const* cell : cells)
+        for (auto const* node : *cell)
+            if (node->getID() < n_nodes)
+                candidates.push_back(node->getID());
+    std::sort(candidates.begin(), candidates.end());
+
+    std::vector<double> dists(candidates.size());
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (OPENMP_LOOP_TYPE k = 0; k < candidates.size(); ++k)
+#else
+    for (std::size_t k = 0; k < candidates.size(); ++k)
+#endif
+        dists[k] = _ply.getDistanceAlongPolyline(
+            *_mesh.getNode(candidates[k]), epsilon_radius);
+
+    for (std::size_t k = 0; k < candidates.size(); k++) {
+        if (dists[k] >= 0.0) {
+            _msh_node_ids.push_back(candidates[k]);
+            _dist_of_proj_node_from_ply_start.push_back(dists[k]);
         }
     }
 
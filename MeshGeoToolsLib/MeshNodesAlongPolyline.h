@@ -18,11 +18,13 @@
 namespace GeoLib
 {
 class Polyline;
+template <typename POINT> class Grid;
 }
 
 namespace MeshLib
 {
 class Mesh;
+class Node;
 }
 
 namespace MeshGeoToolsLib
@@ -40,11 +42,17 @@ public:
      * Constructor of object, that search mesh nodes along a
      * GeoLib::Polyline polyline within a given search radius. So the polyline
      * is something like a tube.
-     * @param mesh_nodes Nodes the search will be performed on.
+     * Only the mesh nodes in the cells of the \c mesh_grid near the polyline
+     * segments are tested; they are tested in parallel if OpenMP is enabled.
+     * @param mesh Mesh object whose nodes are searched
+     * @param mesh_grid Grid object constructed with mesh nodes
      * @param ply Along the GeoLib::Polyline ply the mesh nodes are searched.
      * @param epsilon_radius Search / tube radius
+     * @param search_all_nodes whether this searches all nodes or only base
+     * nodes
      */
     MeshNodesAlongPolyline(MeshLib::Mesh const& mesh,
+            GeoLib::Grid<MeshLib::Node> const& mesh_grid,
             GeoLib::Polyline const& ply, double epsilon_radius, bool search_all_nodes = true);
 
     /// return the mesh object
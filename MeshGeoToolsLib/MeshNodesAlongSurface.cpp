@@ -13,10 +13,14 @@
 #include "MeshNodesAlongSurface.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 
 #include "BaseLib/quicksort.h"
 #include "MathLib/MathTools.h"
+#include "GeoLib/Grid.h"
 #include "GeoLib/Surface.h"
+#include "GeoLib/Triangle.h"
 #include "MeshLib/Mesh.h"
 #include "MeshLib/Node.h"
 
@@ -25,21 +29,73 @@ namespace MeshGeoToolsLib
 
 MeshNodesAlongSurface::MeshNodesAlongSurface(
         MeshLib::Mesh const& mesh,
+        GeoLib::Grid<MeshLib::Node> const& mesh_grid,
         GeoLib::Surface const& sfc,
         double epsilon_radius,
         bool search_all_nodes) :
     _mesh(mesh), _sfc(sfc)
 {
-    auto& mesh_nodes = _mesh.getNodes();
     const std::size_t n_nodes (search_all_nodes ? _mesh.getNumberOfNodes() : _mesh.getNumberOfBaseNodes());
-    // loop over all nodes
-    for (std::size_t i = 0; i < n_nodes; i++) {
-        auto* node = mesh_nodes[i];
-        if (!sfc.isPntInBoundingVolume(*node))
-            continue;
-        if (sfc.isPntInSfc(*node, epsilon_radius)) {
-            _msh_node_ids.push_back(node->getID());
+
+    // Collect the grid cells near the triangles. isPntInSfc() compares the
+    // squared distance of a node to the plane of a triangle with
+    // epsilon_radius, i.e. a node is found up to a distance of
+    // sqrt(epsilon_radius), which is larger than epsilon_radius for
+    // epsilon_radius < 1. The barycentric coordinates of the projected node
+    // are tested with a relative tolerance of float epsilon.
+    double const plane_distance =
+        std::max(epsilon_radius, std::sqrt(epsilon_radius));
+    std::vector<std::vector<MeshLib::Node*> const*> cells;
+    for (std::size_t k = 0; k < sfc.getNumberOfTriangles(); k++) {
+        GeoLib::Triangle const& triangle(*sfc[k]);
+        std::array<double, 3> min_pnt, max_pnt;
+        for (unsigned d = 0; d < 3; d++) {
+            min_pnt[d] = std::min({(*triangle.getPoint(0))[d],
+                                   (*triangle.getPoint(1))[d],
+                                   (*triangle.getPoint(2))[d]});
+            max_pnt[d] = std::max({(*triangle.getPoint(0))[d],
+                                   (*triangle.getPoint(1))[d],
+                                   (*triangle.getPoint(2))[d]});
+        }
+        double const diameter = std::sqrt(MathLib::sqrDist(
+            MathLib::Point3d(min_pnt), MathLib::Point3d(max_pnt)));
+        double const tolerance = plane_distance + 1e-6 * diameter;
+        for (unsigned d = 0; d < 3; d++) {
+            min_pnt[d] -= tolerance;
+            max_pnt[d] += tolerance;
         }
+        mesh_grid.getPntVecsOfGridCellsIntersectingCuboid(
+            MathLib::Point3d(min_pnt), MathLib::Point3d(max_pnt), cells);
+    }
+    std::sort(cells.begin(), cells.end());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+
+    // candidate nodes in ascending order of their ids
+    std::vector<std::size_t> candidates;
+    for (auto const* cell : cells)
+        for (auto const* node : *cell)
+            if (node->getID() < n_nodes && sfc.isPntInBoundingVolume(*node))
+                candidates.push_back(node->getID());
+    std::sort(candidates.begin(), candidates.end());
+    if (candidates.empty())
+        return;
+
+    // The first call of isPntInSfc() constructs the surface grid, i.e. it
+    // must not be done in parallel.
+    std::vector<char> is_in_sfc(candidates.size());
+    is_in_sfc[0] = sfc.isPntInSfc(*_mesh.getNode(candidates[0]), epsilon_radius);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (OPENMP_LOOP_TYPE k = 1; k < candidates.size(); ++k)
+#else
+    for (std::size_t k = 1; k < candidates.size(); ++k)
+#endif
+        is_in_sfc[k] =
+            sfc.isPntInSfc(*_mesh.getNode(candidates[k]), epsilon_radius);
+
+    for (std::size_t k = 0; k < candidates.size(); k++) {
+        if (is_in_sfc[k])
+            _msh_node_ids.push_back(candidates[k]);
     }
 }
 
@@ -18,11 +18,13 @@
 namespace GeoLib
 {
 class Surface;
+template <typename POINT> class Grid;
 }
 
 namespace MeshLib
 {
 class Mesh;
+class Node;
 }
 
 namespace MeshGeoToolsLib
@@ -36,7 +38,11 @@ public:
     /**
      * Constructor of object, that search mesh nodes along a
      * GeoLib::Surface object within a given search radius.
-     * @param mesh_nodes Nodes the search will be performed on.
+     * Only the mesh nodes in the cells of the \c mesh_grid near the surface
+     * triangles are tested; they are tested in parallel if OpenMP is
+     * enabled.
+     * @param mesh Mesh object whose nodes are searched
+     * @param mesh_grid Grid object constructed with mesh nodes
      * @param sfc Along the GeoLib::Surface sfc the mesh nodes are searched.
      * @param epsilon Euclidean distance tolerance value. Is the distance
      * between a mesh node and the surface smaller than that value it is a mesh
@@ -44,7 +50,9 @@ public:
      * @param search_all_nodes switch between searching all mesh nodes and
      * searching the base nodes.
      */
-    MeshNodesAlongSurface(MeshLib::Mesh const& mesh, GeoLib::Surface const& sfc,
+    MeshNodesAlongSurface(MeshLib::Mesh const& mesh,
+                          GeoLib::Grid<MeshLib::Node> const& mesh_grid,
+                          GeoLib::Surface const& sfc,
                           double epsilon, bool search_all_nodes = true);
 
     /// return the mesh object
@@ -0,0 +1,425 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "CompactMesh.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "MeshLib/Elements/Elements.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+std::vector<double> copyCoordinates(MeshLib::Mesh const& mesh)
+{
+    std::vector<double> coordinates;
+    coordinates.reserve(3 * mesh.getNumberOfNodes());
+    for (auto const* node : mesh.getNodes())
+        coordinates.insert(coordinates.end(), node->getCoords(),
+                           node->getCoords() + 3);
+    return coordinates;
+}
+
+std::vector<std::size_t> copyElementNodeOffsets(MeshLib::Mesh const& mesh)
+{
+    std::vector<std::size_t> offsets;
+    offsets.reserve(mesh.getNumberOfElements() + 1);
+    offsets.push_back(0);
+    for (auto const* e : mesh.getElements())
+        offsets.push_back(offsets.back() + e->getNumberOfNodes());
+    return offsets;
+}
+
+std::vector<std::size_t> copyElementNodes(MeshLib::Mesh const& mesh)
+{
+    std::vector<std::size_t> element_nodes;
+    for (auto const* e : mesh.getElements())
+    {
+        unsigned const n_nodes = e->getNumberOfNodes();
+        for (unsigned i = 0; i < n_nodes; ++i)
+            element_nodes.push_back(e->getNode(i)->getID());
+    }
+    return element_nodes;
+}
+
+std::vector<MeshLib::CellType> copyCellTypes(MeshLib::Mesh const& mesh)
+{
+    std::vector<MeshLib::CellType> cell_types;
+    cell_types.reserve(mesh.getNumberOfElements());
+    for (auto const* e : mesh.getElements())
+        cell_types.push_back(e->getCellType());
+    return cell_types;
+}
+
+template <typename ElementType>
+MeshLib::Element* createElementOfType(std::vector<MeshLib::Node*> const& nodes,
+                                      MeshLib::IndexRange const& node_ids)
+{
+    auto** element_nodes = new MeshLib::Node*[ElementType::n_all_nodes];
+    for (unsigned i = 0; i < ElementType::n_all_nodes; ++i)
+        element_nodes[i] = nodes[node_ids[i]];
+    return new ElementType(element_nodes);
+}
+
+struct CellTypeInfo
+{
+    unsigned dimension;
+    unsigned n_base_nodes;
+    unsigned n_all_nodes;
+};
+
+template <typename ElementType>
+CellTypeInfo getCellTypeInfo()
+{
+    return {ElementType::dimension, ElementType::n_base_nodes,
+            ElementType::n_all_nodes};
+}
+
+CellTypeInfo getCellTypeInfo(MeshLib::CellType const cell_type)
+{
+    using namespace MeshLib;
+    switch (cell_type)
+    {
+        case CellType::POINT1:    return getCellTypeInfo<Point>();
+        case CellType::LINE2:     return getCellTypeInfo<Line>();
+        case CellType::LINE3:     return getCellTypeInfo<Line3>();
+        case CellType::TRI3:      return getCellTypeInfo<Tri>();
+        case CellType::TRI6:      return getCellTypeInfo<Tri6>();
+        case CellType::QUAD4:     return getCellTypeInfo<Quad>();
+        case CellType::QUAD8:     return getCellTypeInfo<Quad8>();
+        case CellType::QUAD9:     return getCellTypeInfo<Quad9>();
+        case CellType::TET4:      return getCellTypeInfo<Tet>();
+        case CellType::TET10:     return getCellTypeInfo<Tet10>();
+        case CellType::HEX8:      return getCellTypeInfo<Hex>();
+        case CellType::HEX20:     return getCellTypeInfo<Hex20>();
+        case CellType::PRISM6:    return getCellTypeInfo<Prism>();
+        case CellType::PRISM15:   return getCellTypeInfo<Prism15>();
+        case CellType::PYRAMID5:  return getCellTypeInfo<Pyramid>();
+        case CellType::PYRAMID13: return getCellTypeInfo<Pyramid13>();
+        default:
+            OGS_FATAL("Cell type %s is not supported.",
+                      MeshLib::CellType2String(cell_type).c_str());
+    }
+}
+}  // anonymous namespace
+
+namespace MeshLib
+{
+Element* createElement(CellType const cell_type,
+                       std::vector<Node*> const& nodes,
+                       IndexRange const& node_ids)
+{
+    switch (cell_type)
+    {
+        case CellType::POINT1:
+            return createElementOfType<Point>(nodes, node_ids);
+        case CellType::LINE2:
+            return createElementOfType<Line>(nodes, node_ids);
+        case CellType::LINE3:
+            return createElementOfType<Line3>(nodes, node_ids);
+        case CellType::TRI3:
+            return createElementOfType<Tri>(nodes, node_ids);
+        case CellType::TRI6:
+            return createElementOfType<Tri6>(nodes, node_ids);
+        case CellType::QUAD4:
+            return createElementOfType<Quad>(nodes, node_ids);
+        case CellType::QUAD8:
+            return createElementOfType<Quad8>(nodes, node_ids);
+        case CellType::QUAD9:
+            return createElementOfType<Quad9>(nodes, node_ids);
+        case CellType::TET4:
+            return createElementOfType<Tet>(nodes, node_ids);
+        case CellType::TET10:
+            return createElementOfType<Tet10>(nodes, node_ids);
+        case CellType::HEX8:
+            return createElementOfType<Hex>(nodes, node_ids);
+        case CellType::HEX20:
+            return createElementOfType<Hex20>(nodes, node_ids);
+        case CellType::PRISM6:
+            return createElementOfType<Prism>(nodes, node_ids);
+        case CellType::PRISM15:
+            return createElementOfType<Prism15>(nodes, node_ids);
+        case CellType::PYRAMID5:
+            return createElementOfType<Pyramid>(nodes, node_ids);
+        case CellType::PYRAMID13:
+            return createElementOfType<Pyramid13>(nodes, node_ids);
+        default:
+            OGS_FATAL("Cell type %s is not supported.",
+                      CellType2String(cell_type).c_str());
+    }
+}
+
+NodeElementTable createNodeElementTable(Mesh const& mesh,
+                                        bool const all_nodes)
+{
+    auto const& elements = mesh.getElements();
+    std::size_t const n_elements = elements.size();
+    auto const getNumberOfNodes = [all_nodes](Element const& e)
+    {
+        return all_nodes ? e.getNumberOfNodes() : e.getNumberOfBaseNodes();
+    };
+
+    // Count, prefix sum, fill as in CompactMesh::buildNodeElementTable().
+    NodeElementTable table;
+    table.offsets.assign(mesh.getNumberOfNodes() + 1, 0);
+    for (std::size_t e = 0; e < n_elements; ++e)
+    {
+        unsigned const n_nodes = getNumberOfNodes(*elements[e]);
+        for (unsigned i = 0; i < n_nodes; ++i)
+            ++table.offsets[elements[e]->getNodeIndex(i) + 1];
+    }
+    std::partial_sum(table.offsets.begin(), table.offsets.end(),
+                     table.offsets.begin());
+
+    table.element_ids.resize(table.offsets.back());
+    std::vector<std::size_t> position(table.offsets.begin(),
+                                      table.offsets.end() - 1);
+    for (std::size_t e = 0; e < n_elements; ++e)
+    {
+        unsigned const n_nodes = getNumberOfNodes(*elements[e]);
+        for (unsigned i = 0; i < n_nodes; ++i)
+            table.element_ids[position[elements[e]->getNodeIndex(i)]++] = e;
+    }
+    return table;
+}
+
+bool isSupportedCellType(CellType const cell_type)
+{
+    switch (cell_type)
+    {
+        case CellType::POINT1:
+        case CellType::LINE2:
+        case CellType::LINE3:
+        case CellType::TRI3:
+        case CellType::TRI6:
+        case CellType::QUAD4:
+        case CellType::QUAD8:
+        case CellType::QUAD9:
+        case CellType::TET4:
+        case CellType::TET10:
+        case CellType::HEX8:
+        case CellType::HEX20:
+        case CellType::PRISM6:
+        case CellType::PRISM15:
+        case CellType::PYRAMID5:
+        case CellType::PYRAMID13:
+            return true;
+        default:
+            return false;
+    }
+}
+
+unsigned getCellTypeNumberOfBaseNodes(CellType const cell_type)
+{
+    return getCellTypeInfo(cell_type).n_base_nodes;
+}
+
+unsigned getCellTypeNumberOfNodes(CellType const cell_type)
+{
+    return getCellTypeInfo(cell_type).n_all_nodes;
+}
+
+unsigned getCellTypeDimension(CellType const cell_type)
+{
+    return getCellTypeInfo(cell_type).dimension;
+}
+
+CompactMesh::CompactMesh(std::string const& name,
+                         std::vector<double>&& coordinates,
+                         std::vector<std::size_t>&& element_node_offsets,
+                         std::vector<std::size_t>&& element_nodes,
+                         std::vector<CellType>&& cell_types,
+                         Properties const& properties,
+                         std::size_t const n_base_nodes)
+    : _name(name),
+      _coordinates(std::move(coordinates)),
+      _element_node_offsets(std::move(element_node_offsets)),
+      _element_nodes(std::move(element_nodes)),
+      _cell_types(std::move(cell_types)),
+      _properties(properties),
+      _n_base_nodes(n_base_nodes == 0 ? getNumberOfNodes() : n_base_nodes)
+{
+    checkConsistency();
+
+    for (auto const cell_type : _cell_types)
+        _dimension = std::max(_dimension, getCellTypeDimension(cell_type));
+}
+
+CompactMesh::CompactMesh(Mesh const& mesh)
+    : CompactMesh(mesh.getName(), copyCoordinates(mesh),
+                  copyElementNodeOffsets(mesh), copyElementNodes(mesh),
+                  copyCellTypes(mesh), mesh.getProperties(),
+                  mesh.getNumberOfBaseNodes())
+{
+}
+
+void CompactMesh::checkConsistency() const
+{
+    if (_n_base_nodes > getNumberOfNodes())
+        OGS_FATAL("The number of base nodes (%d) exceeds the number of nodes.",
+                  _n_base_nodes);
+
+    if (_coordinates.size() % 3 != 0)
+        OGS_FATAL("The number of coordinates (%d) is not a multiple of 3.",
+                  _coordinates.size());
+
+    if (_element_node_offsets.size() != _cell_types.size() + 1)
+        OGS_FATAL(
+            "Expected %d element node offsets for %d elements, got %d.",
+            _cell_types.size() + 1, _cell_types.size(),
+            _element_node_offsets.size());
+
+    if (_element_node_offsets.front() != 0 ||
+        _element_node_offsets.back() != _element_nodes.size())
+        OGS_FATAL("The element node offsets do not match the connectivity.");
+
+    std::size_t const n_nodes = getNumberOfNodes();
+    for (std::size_t e = 0; e < _cell_types.size(); ++e)
+    {
+        auto const node_ids = getElementNodeIDs(e);
+        if (_element_node_offsets[e] > _element_node_offsets[e + 1] ||
+            node_ids.size() != getCellTypeNumberOfNodes(_cell_types[e]))
+            OGS_FATAL("Element %d has a wrong number of nodes.", e);
+
+        for (auto const id : node_ids)
+            if (id >= n_nodes)
+                OGS_FATAL("Element %d references the non-existing node %d.",
+                          e, id);
+    }
+}
+
+MathLib::Point3d CompactMesh::getNode(std::size_t const node_id) const
+{
+    auto const* x = getNodeCoordinates(node_id);
+    return MathLib::Point3d(std::array<double, 3>{{x[0], x[1], x[2]}});
+}
+
+Mesh* CompactMesh::toMesh() const
+{
+    std::size_t const n_nodes = getNumberOfNodes();
+    std::vector<Node*> nodes(n_nodes);
+    for (std::size_t i = 0; i < n_nodes; ++i)
+        nodes[i] = new Node(getNodeCoordinates(i), i);
+
+    std::size_t const n_elements = getNumberOfElements();
+    std::vector<Element*> elements(n_elements);
+    for (std::size_t e = 0; e < n_elements; ++e)
+        elements[e] =
+            createElement(_cell_types[e], nodes, getElementNodeIDs(e));
+
+    return new Mesh(_name, nodes, elements, _properties, _n_base_nodes);
+}
+
+void CompactMesh::buildNodeElementTable() const
+{
+    std::size_t const n_nodes = getNumberOfNodes();
+    std::size_t const n_elements = getNumberOfElements();
+
+    // Count, prefix sum, fill: no per-node vector is grown.
+    _node_element_offsets.assign(n_nodes + 1, 0);
+    for (std::size_t e = 0; e < n_elements; ++e)
+    {
+        auto const node_ids = getElementNodeIDs(e);
+        unsigned const n_base_nodes =
+            getCellTypeNumberOfBaseNodes(_cell_types[e]);
+        for (unsigned i = 0; i < n_base_nodes; ++i)
+            ++_node_element_offsets[node_ids[i] + 1];
+    }
+    std::partial_sum(_node_element_offsets.begin(),
+                     _node_element_offsets.end(),
+                     _node_element_offsets.begin());
+
+    _node_elements.resize(_node_element_offsets.back());
+    std::vector<std::size_t> position(_node_element_offsets.begin(),
+                                      _node_element_offsets.end() - 1);
+    for (std::size_t e = 0; e < n_elements; ++e)
+    {
+        auto const node_ids = getElementNodeIDs(e);
+        unsigned const n_base_nodes =
+            getCellTypeNumberOfBaseNodes(_cell_types[e]);
+        for (unsigned i = 0; i < n_base_nodes; ++i)
+            _node_elements[position[node_ids[i]]++] = e;
+    }
+}
+
+IndexRange CompactMesh::getElementsConnectedToNode(
+    std::size_t const node_id) const
+{
+    std::call_once(_node_elements_flag,
+                   &CompactMesh::buildNodeElementTable, this);
+    return {_node_elements.data() + _node_element_offsets[node_id],
+            _node_elements.data() + _node_element_offsets[node_id + 1]};
+}
+
+void CompactMesh::buildNeighborTable() const
+{
+    std::size_t const n_elements = getNumberOfElements();
+
+    _neighbor_offsets.clear();
+    _neighbor_offsets.reserve(n_elements + 1);
+    _neighbor_offsets.push_back(0);
+    _neighbors.clear();
+
+    std::vector<std::size_t> candidates;
+    for (std::size_t e = 0; e < n_elements; ++e)
+    {
+        auto const node_ids = getElementNodeIDs(e);
+        unsigned const dim = getElementDimension(e);
+        unsigned const n_base_nodes =
+            getCellTypeNumberOfBaseNodes(_cell_types[e]);
+
+        // Every element appears once per node shared with e.
+        candidates.clear();
+        for (unsigned i = 0; i < n_base_nodes; ++i)
+        {
+            auto const elements = getElementsConnectedToNode(node_ids[i]);
+            candidates.insert(candidates.end(), elements.begin(),
+                              elements.end());
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        // Same criterion as in MeshLib::Element::addNeighbor(): elements of
+        // equal dimension sharing at least dim nodes are neighbours.
+        for (auto it = candidates.begin(); it != candidates.end();)
+        {
+            auto const run_end = std::upper_bound(it, candidates.end(), *it);
+            std::size_t const shared_nodes = std::distance(it, run_end);
+            if (*it != e && shared_nodes >= std::max(dim, 1u) &&
+                getElementDimension(*it) == dim)
+                _neighbors.push_back(*it);
+            it = run_end;
+        }
+        _neighbor_offsets.push_back(_neighbors.size());
+    }
+}
+
+IndexRange CompactMesh::getElementNeighbors(std::size_t const element_id) const
+{
+    std::call_once(_neighbors_flag, &CompactMesh::buildNeighborTable, this);
+    return {_neighbors.data() + _neighbor_offsets[element_id],
+            _neighbors.data() + _neighbor_offsets[element_id + 1]};
+}
+
+std::size_t CompactMesh::getMemoryUsage() const
+{
+    return _coordinates.capacity() * sizeof(double) +
+           (_element_node_offsets.capacity() + _element_nodes.capacity() +
+            _node_element_offsets.capacity() + _node_elements.capacity() +
+            _neighbor_offsets.capacity() + _neighbors.capacity()) *
+               sizeof(std::size_t) +
+           _cell_types.capacity() * sizeof(CellType) +
+           _properties.getMemoryUsage();
+}
+
+}  // namespace MeshLib
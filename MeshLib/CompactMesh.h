@@ -0,0 +1,277 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef MESHLIB_COMPACTMESH_H_
+#define MESHLIB_COMPACTMESH_H_
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "MathLib/Point3d.h"
+
+#include "MeshEnums.h"
+#include "Properties.h"
+
+namespace MeshLib
+{
+class Element;
+class Mesh;
+class Node;
+
+/// Checks if elements of the given cell type can be created and stored in a
+/// CompactMesh. The other getCellType...() functions fail for unsupported
+/// types.
+bool isSupportedCellType(CellType const cell_type);
+
+/// Returns the number of base (corner) nodes of the given cell type.
+unsigned getCellTypeNumberOfBaseNodes(CellType const cell_type);
+
+/// Returns the number of all nodes of the given cell type.
+unsigned getCellTypeNumberOfNodes(CellType const cell_type);
+
+/// Returns the spatial dimension of the given cell type.
+unsigned getCellTypeDimension(CellType const cell_type);
+
+/// Contiguous range of indices, e.g. the nodes of an element in a CompactMesh.
+class IndexRange
+{
+public:
+    IndexRange(std::size_t const* begin, std::size_t const* end)
+        : _begin(begin), _end(end)
+    {
+    }
+
+    std::size_t const* begin() const { return _begin; }
+    std::size_t const* end() const { return _end; }
+    std::size_t size() const { return _end - _begin; }
+    bool empty() const { return _begin == _end; }
+    std::size_t operator[](std::size_t const i) const { return _begin[i]; }
+
+private:
+    std::size_t const* _begin;
+    std::size_t const* _end;
+};
+
+/// Creates an element of the given cell type from the given nodes; the
+/// element's nodes are nodes[node_ids[0]], nodes[node_ids[1]], ...
+Element* createElement(CellType const cell_type,
+                       std::vector<Node*> const& nodes,
+                       IndexRange const& node_ids);
+
+/// Node-to-element connectivity in CSR format. The ids of the elements
+/// connected to node n are element_ids[offsets[n]], ...,
+/// element_ids[offsets[n + 1] - 1] in increasing order.
+struct NodeElementTable
+{
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> element_ids;
+
+    IndexRange getElements(std::size_t const node_id) const
+    {
+        return {element_ids.data() + offsets[node_id],
+                element_ids.data() + offsets[node_id + 1]};
+    }
+};
+
+/// Builds the node-to-element table of the given mesh without copying the
+/// mesh. If \c all_nodes is false an element is connected to its base nodes
+/// only, as in CompactMesh::getElementsConnectedToNode() and
+/// MeshLib::Node::getElements(). Otherwise it is connected to all of its
+/// nodes including the nodes of high order elements.
+NodeElementTable createNodeElementTable(Mesh const& mesh,
+                                        bool const all_nodes);
+
+/// Immutable mesh storage in structure-of-arrays layout.
+///
+/// In contrast to MeshLib::Mesh, where every node and element is a separate
+/// heap object, the CompactMesh stores
+/// - the node coordinates in one array (x0, y0, z0, x1, y1, z1, ...),
+/// - the element-to-node connectivity in CSR format (offsets and node ids),
+/// - the cell type of each element.
+///
+/// The inverse connectivity (node-to-element) and the element neighbours are
+/// built lazily on first request. Both are stored in CSR format as well.
+class CompactMesh
+{
+public:
+    /// Lightweight view of one element.
+    class ElementView
+    {
+    public:
+        ElementView(CompactMesh const& mesh, std::size_t const id)
+            : _mesh(mesh), _id(id)
+        {
+        }
+
+        std::size_t getID() const { return _id; }
+        CellType getCellType() const { return _mesh.getCellType(_id); }
+        unsigned getDimension() const { return _mesh.getElementDimension(_id); }
+        IndexRange getNodeIDs() const { return _mesh.getElementNodeIDs(_id); }
+        std::size_t getNumberOfNodes() const { return getNodeIDs().size(); }
+
+        /// Coordinates of the i-th element node.
+        double const* getNodeCoordinates(std::size_t const i) const
+        {
+            return _mesh.getNodeCoordinates(getNodeIDs()[i]);
+        }
+
+    private:
+        CompactMesh const& _mesh;
+        std::size_t const _id;
+    };
+
+    /// Forward iterator over all elements of a CompactMesh.
+    class ElementIterator
+    {
+    public:
+        ElementIterator(CompactMesh const& mesh, std::size_t const id)
+            : _mesh(mesh), _id(id)
+        {
+        }
+
+        ElementView operator*() const { return ElementView(_mesh, _id); }
+        ElementIterator& operator++()
+        {
+            ++_id;
+            return *this;
+        }
+        bool operator!=(ElementIterator const& other) const
+        {
+            return _id != other._id;
+        }
+
+    private:
+        CompactMesh const& _mesh;
+        std::size_t _id;
+    };
+
+    /// Takes over the given arrays.
+    /// \param name          name of the mesh
+    /// \param coordinates   3 * n_nodes node coordinates
+    /// \param element_node_offsets n_elements + 1 offsets into element_nodes
+    /// \param element_nodes node ids of all elements
+    /// \param cell_types    n_elements cell types
+    /// \param properties    properties of the mesh
+    /// \param n_base_nodes  number of base nodes, see MeshLib::Mesh
+    CompactMesh(std::string const& name,
+                std::vector<double>&& coordinates,
+                std::vector<std::size_t>&& element_node_offsets,
+                std::vector<std::size_t>&& element_nodes,
+                std::vector<CellType>&& cell_types,
+                Properties const& properties = Properties(),
+                std::size_t const n_base_nodes = 0);
+
+    /// Copies the geometry, topology and properties of the given mesh.
+    explicit CompactMesh(Mesh const& mesh);
+
+    CompactMesh(CompactMesh const&) = delete;
+    CompactMesh& operator=(CompactMesh const&) = delete;
+
+    /// Creates a MeshLib::Mesh with the same nodes, elements and properties.
+    Mesh* toMesh() const;
+
+    std::string const& getName() const { return _name; }
+
+    /// Returns the maximum dimension over all elements.
+    unsigned getDimension() const { return _dimension; }
+
+    std::size_t getNumberOfNodes() const { return _coordinates.size() / 3; }
+    std::size_t getNumberOfElements() const { return _cell_types.size(); }
+    std::size_t getNumberOfBaseNodes() const { return _n_base_nodes; }
+
+    /// Pointer to the three coordinates of the given node.
+    double const* getNodeCoordinates(std::size_t const node_id) const
+    {
+        return &_coordinates[3 * node_id];
+    }
+
+    MathLib::Point3d getNode(std::size_t const node_id) const;
+
+    CellType getCellType(std::size_t const element_id) const
+    {
+        return _cell_types[element_id];
+    }
+
+    unsigned getElementDimension(std::size_t const element_id) const
+    {
+        return getCellTypeDimension(_cell_types[element_id]);
+    }
+
+    IndexRange getElementNodeIDs(std::size_t const element_id) const
+    {
+        return {_element_nodes.data() + _element_node_offsets[element_id],
+                _element_nodes.data() + _element_node_offsets[element_id + 1]};
+    }
+
+    ElementView getElement(std::size_t const element_id) const
+    {
+        return ElementView(*this, element_id);
+    }
+
+    ElementIterator begin() const { return ElementIterator(*this, 0); }
+    ElementIterator end() const
+    {
+        return ElementIterator(*this, getNumberOfElements());
+    }
+
+    /// Ids of the elements containing the given node as a base node. The
+    /// table is built on first use.
+    IndexRange getElementsConnectedToNode(std::size_t const node_id) const;
+
+    /// Ids of the elements of the same dimension sharing a face (edge in 2d,
+    /// node in 1d) with the given element. In contrast to
+    /// MeshLib::Element::getNeighbor() the neighbours are not ordered by
+    /// faces. The table is built on first use.
+    IndexRange getElementNeighbors(std::size_t const element_id) const;
+
+    Properties const& getProperties() const { return _properties; }
+
+    std::vector<double> const& getCoordinates() const { return _coordinates; }
+    std::vector<std::size_t> const& getElementNodeOffsets() const
+    {
+        return _element_node_offsets;
+    }
+    std::vector<std::size_t> const& getElementNodes() const
+    {
+        return _element_nodes;
+    }
+    std::vector<CellType> const& getCellTypes() const { return _cell_types; }
+
+    /// Heap memory in bytes held by the mesh including the topology tables
+    /// built so far.
+    std::size_t getMemoryUsage() const;
+
+private:
+    void checkConsistency() const;
+    void buildNodeElementTable() const;
+    void buildNeighborTable() const;
+
+    std::string const _name;
+    std::vector<double> const _coordinates;
+    std::vector<std::size_t> const _element_node_offsets;
+    std::vector<std::size_t> const _element_nodes;
+    std::vector<CellType> const _cell_types;
+    Properties const _properties;
+    std::size_t const _n_base_nodes;
+    unsigned _dimension = 0;
+
+    mutable std::once_flag _node_elements_flag;
+    mutable std::vector<std::size_t> _node_element_offsets;
+    mutable std::vector<std::size_t> _node_elements;
+
+    mutable std::once_flag _neighbors_flag;
+    mutable std::vector<std::size_t> _neighbor_offsets;
+    mutable std::vector<std::size_t> _neighbors;
+};
+
+}  // namespace MeshLib
+
+#endif  // MESHLIB_COMPACTMESH_H_
@@ -0,0 +1,129 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "BoundaryView.h"
+
+#include <algorithm>
+
+#include "BaseLib/Error.h"
+
+#include "MeshLib/Elements/Line.h"
+#include "MeshLib/Elements/Point.h"
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Elements/Tri.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+template <typename ElementType>
+MeshLib::Element* createElementOfType(MeshLib::Node* const* nodes)
+{
+    std::array<MeshLib::Node*, ElementType::n_all_nodes> element_nodes;
+    std::copy_n(nodes, ElementType::n_all_nodes, element_nodes.begin());
+    return new ElementType(element_nodes);
+}
+
+MeshLib::Element* createElementOfCellType(MeshLib::CellType const cell_type,
+                                          MeshLib::Node* const* nodes)
+{
+    using namespace MeshLib;
+    switch (cell_type)
+    {
+        case CellType::POINT1: return createElementOfType<Point>(nodes);
+        case CellType::LINE2: return createElementOfType<Line>(nodes);
+        case CellType::LINE3: return createElementOfType<Line3>(nodes);
+        case CellType::TRI3: return createElementOfType<Tri>(nodes);
+        case CellType::TRI6: return createElementOfType<Tri6>(nodes);
+        case CellType::QUAD4: return createElementOfType<Quad>(nodes);
+        case CellType::QUAD8: return createElementOfType<Quad8>(nodes);
+        case CellType::QUAD9: return createElementOfType<Quad9>(nodes);
+        default: return nullptr;
+    }
+}
+}  // anonymous namespace
+
+namespace MeshLib
+{
+CellType BoundaryView::getCellType() const
+{
+    if (_dimension == 1)
+    {
+        switch (_n_nodes)
+        {
+            case 2: return CellType::LINE2;
+            case 3: return CellType::LINE3;
+        }
+    }
+    else if (_dimension == 2)
+    {
+        switch (_n_nodes)
+        {
+            case 3: return CellType::TRI3;
+            case 4: return CellType::QUAD4;
+            case 6: return CellType::TRI6;
+            case 8: return CellType::QUAD8;
+            case 9: return CellType::QUAD9;
+        }
+    }
+    else if (_dimension == 0 && _n_nodes == 1)
+        return CellType::POINT1;
+    return CellType::INVALID;
+}
+
+MeshElemType BoundaryView::getGeomType() const
+{
+    switch (getCellType())
+    {
+        case CellType::POINT1: return MeshElemType::POINT;
+        case CellType::LINE2:
+        case CellType::LINE3: return MeshElemType::LINE;
+        case CellType::TRI3:
+        case CellType::TRI6: return MeshElemType::TRIANGLE;
+        case CellType::QUAD4:
+        case CellType::QUAD8:
+        case CellType::QUAD9: return MeshElemType::QUAD;
+        default: return MeshElemType::INVALID;
+    }
+}
+
+unsigned BoundaryView::getNumberOfBaseNodes() const
+{
+    switch (getGeomType())
+    {
+        case MeshElemType::POINT: return 1;
+        case MeshElemType::LINE: return 2;
+        case MeshElemType::TRIANGLE: return 3;
+        case MeshElemType::QUAD: return 4;
+        default: return 0;
+    }
+}
+
+Element* BoundaryView::createElement() const
+{
+    Element* const element(createElementOfCellType(getCellType(), getNodes()));
+    if (element == nullptr)
+        OGS_FATAL("BoundaryView::createElement(): no element of dimension "
+                  "%d with %d nodes available.", _dimension, _n_nodes);
+    return element;
+}
+
+Element* BoundaryView::createElement(std::vector<Node*> const& nodes) const
+{
+    std::array<Node*, max_nodes> mapped_nodes;
+    for (unsigned i = 0; i < _n_nodes; ++i)
+        mapped_nodes[i] = nodes[_nodes[i]->getID()];
+    Element* const element(
+        createElementOfCellType(getCellType(), mapped_nodes.data()));
+    if (element == nullptr)
+        OGS_FATAL("BoundaryView::createElement(): no element of dimension "
+                  "%d with %d nodes available.", _dimension, _n_nodes);
+    return element;
+}
+
+}  // namespace MeshLib
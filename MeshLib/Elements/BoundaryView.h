@@ -0,0 +1,101 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef BOUNDARYVIEW_H_
+#define BOUNDARYVIEW_H_
+
+#include <array>
+#include <cassert>
+#include <vector>
+
+#include "MeshLib/MeshEnums.h"
+
+namespace MeshLib
+{
+class Element;
+class Node;
+
+/**
+ * The nodes of a face or an edge of an element.
+ *
+ * In contrast to Element::getFace() and Element::getEdge(), which create a
+ * new element on the heap, a BoundaryView is a small value type holding
+ * the pointers to the element nodes selected by a row of the face or edge
+ * node table of the element rule. It is meant for temporary use in loops
+ * over the faces or edges of many elements.
+ */
+class BoundaryView final
+{
+public:
+    /// The maximum number of nodes of a face (Quad9).
+    static const unsigned max_nodes = 9;
+
+    /// An empty boundary, e.g. the face of a line element.
+    BoundaryView() = default;
+
+    /**
+     * @param element_nodes  all nodes of the element
+     * @param local_node_ids the local ids of the boundary nodes within the
+     *                       element, e.g. a row of a face_nodes table
+     * @param n_nodes        the number of nodes of the boundary
+     * @param dimension      the dimension of the boundary, i.e. 2 for faces
+     *                       of 3d elements and 1 for edges
+     */
+    BoundaryView(Node* const* element_nodes, unsigned const* local_node_ids,
+                 unsigned const n_nodes, unsigned const dimension)
+        : _n_nodes(n_nodes), _dimension(dimension)
+    {
+        assert(n_nodes <= max_nodes);
+        for (unsigned i = 0; i < n_nodes; ++i)
+            _nodes[i] = element_nodes[local_node_ids[i]];
+    }
+
+    /// Get the number of all nodes.
+    unsigned getNumberOfNodes() const { return _n_nodes; }
+
+    /// Get the number of the corner nodes, i.e. without the nodes of
+    /// quadratic elements.
+    unsigned getNumberOfBaseNodes() const;
+
+    Node* getNode(unsigned const i) const
+    {
+        assert(i < _n_nodes);
+        return _nodes[i];
+    }
+
+    /// Get the contiguous array of the boundary nodes.
+    Node* const* getNodes() const { return _nodes.data(); }
+
+    unsigned getDimension() const { return _dimension; }
+
+    /// The cell type of the corresponding element; it is derived from the
+    /// dimension and the number of nodes.
+    CellType getCellType() const;
+
+    /// The geometric type of the corresponding element.
+    MeshElemType getGeomType() const;
+
+    /// Creates an element of the cell type of the boundary, i.e. the same
+    /// element as returned by Element::getFace() or Element::getEdge().
+    Element* createElement() const;
+
+    /// Creates an element of the cell type of the boundary whose nodes are
+    /// taken from the given vector at the positions of the ids of the
+    /// boundary nodes, cf. MeshLib::copyElement().
+    Element* createElement(std::vector<Node*> const& nodes) const;
+
+private:
+    std::array<Node*, max_nodes> _nodes;
+    unsigned _n_nodes = 0;
+    unsigned _dimension = 0;
+};
+
+}  // namespace MeshLib
+
+#endif  // BOUNDARYVIEW_H_
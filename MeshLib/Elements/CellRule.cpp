@@ -22,15 +22,13 @@ bool CellRule::testElementNodeOrder(const Element* e)
     const unsigned nFaces (e->getNumberOfFaces());
     for (unsigned j=0; j<nFaces; ++j)
     {
-        MeshLib::Element const*const face (e->getFace(j));
+        BoundaryView const face (e->getFaceView(j));
         // Node 1 is checked below because that way all nodes are used for the test
         // at some point, while for node 0 at least one node in every element
         // type would be used for checking twice and one wouldn't be checked at
         // all. (based on the definition of the _face_nodes variable)
-        const MeshLib::Node x (*(face->getNode(1)));
-        const MathLib::Vector3 cx (c, x);
-        const double s = MathLib::scalarProduct(FaceRule::getSurfaceNormal(face), cx);
-        delete face;
+        const MathLib::Vector3 cx (c, *face.getNode(1));
+        const double s = MathLib::scalarProduct(FaceRule::getSurfaceNormal(face.getNodes()), cx);
         if (s >= 0)
             return false;
     }
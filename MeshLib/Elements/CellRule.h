@@ -10,6 +10,8 @@
 #ifndef CELLRULE_H_
 #define CELLRULE_H_
 
+#include "MeshLib/Elements/BoundaryView.h"
+
 namespace MeshLib
 {
 
@@ -30,6 +32,13 @@ public:
      * center of gravity to lie outside of the actual element
      */
     static bool testElementNodeOrder(const Element* /*e*/);
+
+    /// Returns the nodes of the i-th face of an element of the given rule.
+    template <typename Rule>
+    static BoundaryView getFaceView(Node* const* nodes, unsigned i)
+    {
+        return BoundaryView(nodes, Rule::face_nodes[i], Rule::n_face_nodes[i], 2);
+    }
 }; /* class */
 
 } /* namespace */
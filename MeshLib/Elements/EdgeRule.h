@@ -10,6 +10,8 @@
 #ifndef EDGERULE_H_
 #define EDGERULE_H_
 
+#include "MeshLib/Elements/BoundaryView.h"
+
 namespace MeshLib
 {
 
@@ -30,6 +32,13 @@ public:
     /// Returns the i-th face of the element.
     static const Element* getFace(const Element* /*e*/, unsigned /*i*/) { return nullptr; }
 
+    /// Returns an empty BoundaryView since there are no faces.
+    template <typename Rule>
+    static BoundaryView getFaceView(Node* const* /*nodes*/, unsigned /*i*/)
+    {
+        return BoundaryView();
+    }
+
     /**
     * Checks if the node order of an element is correct by testing surface normals.
     * For 1D elements this always returns true.
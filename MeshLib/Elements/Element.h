@@ -22,6 +22,7 @@
 
 #include "MeshLib/MeshEnums.h"
 #include "MeshLib/Mesh.h"
+#include "MeshLib/Elements/BoundaryView.h"
 #include "MeshLib/Elements/ElementErrorCode.h"
 
 
@@ -87,6 +88,14 @@ public:
     /// Returns the i-th face of the element.
     virtual const Element* getFace(unsigned i) const = 0;
 
+    /// Returns the nodes of the i-th edge of the element. In contrast to
+    /// getEdge() no element is created.
+    virtual BoundaryView getEdgeView(unsigned i) const = 0;
+
+    /// Returns the nodes of the i-th face of the element. In contrast to
+    /// getFace() no element is created.
+    virtual BoundaryView getFaceView(unsigned i) const = 0;
+
     /// Returns the ID of the element.
     virtual std::size_t getID() const final { return _id; }
 
@@ -24,7 +24,11 @@ bool FaceRule::testElementNodeOrder(const Element* e)
 
 MathLib::Vector3 FaceRule::getSurfaceNormal(const Element* e)
 {
-    Node * const * _nodes = e->getNodes();
+    return getSurfaceNormal(e->getNodes());
+}
+
+MathLib::Vector3 FaceRule::getSurfaceNormal(Node const* const* _nodes)
+{
     const MathLib::Vector3 u (*_nodes[1], *_nodes[0]);
     const MathLib::Vector3 v (*_nodes[1], *_nodes[2]);
     return MathLib::crossProduct(u,v);
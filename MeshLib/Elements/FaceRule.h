@@ -10,7 +10,10 @@
 #ifndef FACERULE_H_
 #define FACERULE_H_
 
+#include <type_traits>
+
 #include "MathLib/Vector3.h"
+#include "BoundaryView.h"
 #include "Element.h"
 
 namespace MeshLib
@@ -25,6 +28,15 @@ public:
     /// Returns the face i of the element.
     static const Element* getFace(const Element* e, unsigned i) { return e->getEdge(i); }
 
+    /// Returns the nodes of the i-th face, i.e. the i-th edge, of an element
+    /// of the given rule.
+    template <typename Rule>
+    static BoundaryView getFaceView(Node* const* nodes, unsigned i)
+    {
+        return BoundaryView(nodes, Rule::edge_nodes[i],
+            std::extent<decltype(Rule::edge_nodes), 1>::value, 1);
+    }
+
     /// Constant: The number of faces
     static const unsigned n_faces = 0;
 
@@ -37,6 +49,10 @@ public:
     /// Returns the surface normal of a 2D element.
     static MathLib::Vector3 getSurfaceNormal(const Element* e);
 
+    /// Returns the surface normal of a 2D element given by its nodes, e.g.
+    /// the nodes of a BoundaryView.
+    static MathLib::Vector3 getSurfaceNormal(Node const* const* nodes);
+
 }; /* class */
 
 } /* namespace */
@@ -45,6 +45,8 @@ const unsigned HexRule20::edge_nodes[12][3] =
     {3, 7, 19}  // Edge 11
 };
 
+const unsigned HexRule20::n_face_nodes[6] = { 8, 8, 8, 8, 8, 8 };
+
 const Element* HexRule20::getFace(const Element* e, unsigned i)
 {
     if (i < n_faces)
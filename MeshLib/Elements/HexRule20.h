@@ -58,6 +58,9 @@ public:
     /// Constant: Local node index table for edge
     static const unsigned edge_nodes[12][3];
 
+    /// Constant: Table for the number of nodes for each face
+    static const unsigned n_face_nodes[6];
+
     /// Returns the i-th edge of the element.
     typedef QuadraticEdgeReturn EdgeReturn;
 
@@ -47,6 +47,8 @@ const unsigned HexRule8::edge_nodes[12][2] =
     {3, 7}  // Edge 11
 };
 
+const unsigned HexRule8::n_face_nodes[6] = { 4, 4, 4, 4, 4, 4 };
+
 const Element* HexRule8::getFace(const Element* e, unsigned i)
 {
     if (i < n_faces)
@@ -105,9 +107,8 @@ ElementErrorCode HexRule8::validate(const Element* e)
         if (error_code.all())
             break;
 
-        const MeshLib::Element* quad (e->getFace(i));
-        error_code |= quad->validate();
-        delete quad;
+        error_code |=
+            QuadRule4::validateGeometry(e->getFaceView(i).getNodes());
     }
     error_code[ElementErrorFlag::NodeOrder]  = !e->testElementNodeOrder();
     return error_code;
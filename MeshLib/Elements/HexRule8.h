@@ -73,6 +73,9 @@ public:
     /// Constant: Local node index table for edge
     static const unsigned edge_nodes[12][2];
 
+    /// Constant: Table for the number of nodes for each face
+    static const unsigned n_face_nodes[6];
+
     /// Returns the i-th edge of the element.
     typedef LinearEdgeReturn EdgeReturn;
 
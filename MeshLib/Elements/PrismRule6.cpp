@@ -97,12 +97,11 @@ ElementErrorCode PrismRule6::validate(const Element* e)
 
     for (unsigned i=1; i<4; ++i)
     {
-        const MeshLib::Quad* quad (dynamic_cast<const MeshLib::Quad*>(e->getFace(i)));
-        if (quad)
-            error_code |= quad->validate();
+        BoundaryView const face(e->getFaceView(i));
+        if (face.getGeomType() == MeshElemType::QUAD)
+            error_code |= QuadRule4::validateGeometry(face.getNodes());
         else
             error_code.set(ElementErrorFlag::NodeOrder);
-        delete quad;
     }
     error_code[ElementErrorFlag::NodeOrder] = !e->testElementNodeOrder();
     return error_code;
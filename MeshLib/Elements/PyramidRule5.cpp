@@ -96,15 +96,14 @@ ElementErrorCode PyramidRule5::validate(const Element* e)
     ElementErrorCode error_code;
     error_code[ElementErrorFlag::ZeroVolume] = e->hasZeroVolume();
 
-    const MeshLib::Quad* base (dynamic_cast<const MeshLib::Quad*>(e->getFace(4)));
-    if (base)
+    BoundaryView const base(e->getFaceView(4));
+    if (base.getGeomType() == MeshElemType::QUAD)
     {
-        error_code |= base->validate();
+        error_code |= QuadRule4::validateGeometry(base.getNodes());
         error_code[ElementErrorFlag::NodeOrder] = !e->testElementNodeOrder();
     }
     else
         error_code.set(ElementErrorFlag::NodeOrder);
-    delete base;
 
     return error_code;
 }
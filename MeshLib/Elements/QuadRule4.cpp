@@ -9,6 +9,8 @@
 
 #include "QuadRule4.h"
 
+#include <limits>
+
 #include <logog/include/logog.hpp>
 
 #include "MathLib/GeometricBasics.h"
@@ -53,10 +55,17 @@ unsigned QuadRule4::identifyFace(Node const* const* _nodes, Node* nodes[3])
 }
 
 ElementErrorCode QuadRule4::validate(const Element* e)
+{
+    ElementErrorCode error_code(validateGeometry(e->getNodes()));
+    error_code[ElementErrorFlag::NodeOrder] = !e->testElementNodeOrder();
+    return error_code;
+}
+
+ElementErrorCode QuadRule4::validateGeometry(Node const* const* _nodes)
 {
     ElementErrorCode error_code;
-    error_code[ElementErrorFlag::ZeroVolume] = e->hasZeroVolume();
-    Node const* const* _nodes = e->getNodes();
+    error_code[ElementErrorFlag::ZeroVolume] =
+        computeVolume(_nodes) < std::numeric_limits<double>::epsilon();
     error_code[ElementErrorFlag::NonCoplanar] =
         (!MathLib::isCoplanar(*_nodes[0], *_nodes[1], *_nodes[2], *_nodes[3]));
     // for collapsed quads (i.e. reduced to a line) this test might result
@@ -67,7 +76,6 @@ ElementErrorCode QuadRule4::validate(const Element* e)
                    *_nodes[0], *_nodes[2], *_nodes[1], *_nodes[3]) &&
                MathLib::dividedByPlane(
                    *_nodes[1], *_nodes[3], *_nodes[0], *_nodes[2])));
-    error_code[ElementErrorFlag::NodeOrder] = !e->testElementNodeOrder();
     return error_code;
 }
 
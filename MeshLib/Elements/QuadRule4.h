@@ -74,6 +74,14 @@ public:
      */
     static ElementErrorCode validate(const Element* e);
 
+    /**
+     * Tests if the quadrilateral given by its four nodes is geometrically
+     * valid, i.e. it checks everything validate() checks except the node
+     * order. This allows to test faces of 3d elements without creating
+     * them.
+     */
+    static ElementErrorCode validateGeometry(Node const* const* _nodes);
+
     /// Returns the ID of a face given an array of nodes.
     static unsigned identifyFace(Node const* const*, Node* nodes[3]);
 
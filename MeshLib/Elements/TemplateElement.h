@@ -11,7 +11,9 @@
 #define TEMPLATEELEMENT_H_
 
 #include <array>
+#include <cassert>
 #include <limits>
+#include <type_traits>
 
 #include "MathLib/Point3d.h"
 
@@ -78,6 +80,20 @@ public:
     /// Returns the face i of the element.
     const Element* getFace(unsigned i) const { return ELEMENT_RULE::getFace(this, i); }
 
+    /// Returns the nodes of the edge i of the element.
+    BoundaryView getEdgeView(unsigned i) const
+    {
+        assert(i < getNumberOfEdges());
+        return BoundaryView(this->_nodes, ELEMENT_RULE::edge_nodes[i],
+            std::extent<decltype(ELEMENT_RULE::edge_nodes), 1>::value, 1);
+    }
+
+    /// Returns the nodes of the face i of the element.
+    BoundaryView getFaceView(unsigned i) const
+    {
+        return ELEMENT_RULE::template getFaceView<ELEMENT_RULE>(this->_nodes, i);
+    }
+
     /// Get the number of edges for this element.
     unsigned getNumberOfEdges() const { return ELEMENT_RULE::n_edges; }
 
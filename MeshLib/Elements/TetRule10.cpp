@@ -37,6 +37,8 @@ const unsigned TetRule10::edge_nodes[6][3] =
     {2, 3, 9}  // Edge 5
 };
 
+const unsigned TetRule10::n_face_nodes[4] = { 6, 6, 6, 6 };
+
 const Element* TetRule10::getFace(const Element* e, unsigned i)
 {
     if (i<n_faces)
@@ -39,6 +39,8 @@ const unsigned TetRule4::edge_nodes[6][2] =
     {2, 3}  // Edge 5
 };
 
+const unsigned TetRule4::n_face_nodes[4] = { 3, 3, 3, 3 };
+
 const Element* TetRule4::getFace(const Element* e, unsigned i)
 {
     if (i<n_faces)
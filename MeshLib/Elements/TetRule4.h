@@ -68,6 +68,9 @@ public:
     /// Constant: Local node index table for edge
     static const unsigned edge_nodes[6][2];
 
+    /// Constant: Table for the number of nodes for each face
+    static const unsigned n_face_nodes[4];
+
     /// Returns the i-th edge of the element.
     typedef LinearEdgeReturn EdgeReturn;
 
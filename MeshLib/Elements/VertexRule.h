@@ -10,6 +10,8 @@
 #ifndef MESHLIB_VERTEX_RULE_H
 #define MESHLIB_VERTEX_RULE_H
 
+#include "MeshLib/Elements/BoundaryView.h"
+
 namespace MeshLib
 {
 
@@ -33,6 +35,13 @@ public:
         return nullptr;
     }
 
+    /// Returns an empty BoundaryView since there are no faces.
+    template <typename Rule>
+    static BoundaryView getFaceView(Node* const* /*nodes*/, unsigned /*i*/)
+    {
+        return BoundaryView();
+    }
+
     /// Checks if the node order of an element is correct by testing surface
     /// normals.  For 0D elements this always returns true.
     static bool testElementNodeOrder(const Element* /*e*/) { return true; }
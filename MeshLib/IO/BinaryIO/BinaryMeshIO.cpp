@@ -0,0 +1,472 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "BinaryMeshIO.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <type_traits>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+
+#include "MeshLib/CompactMesh.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/Properties.h"
+
+namespace
+{
+static_assert(sizeof(std::size_t) == sizeof(std::uint64_t),
+              "The binary mesh format requires 64 bit indices.");
+static_assert(sizeof(double) == 8, "The binary mesh format requires IEEE "
+                                   "754 double precision values.");
+
+char const magic[8] = {'O', 'G', 'S', 'B', 'M', 'E', 'S', 'H'};
+std::size_t const alignment = 8;
+
+bool isLittleEndian()
+{
+    std::uint16_t const one = 1;
+    return *reinterpret_cast<std::uint8_t const*>(&one) == 1;
+}
+
+std::size_t padding(std::size_t const n_bytes)
+{
+    return (alignment - n_bytes % alignment) % alignment;
+}
+
+template <typename T>
+MeshLib::IO::BinaryDataType getBinaryDataType()
+{
+    using MeshLib::IO::BinaryDataType;
+    if (std::is_same<T, char>::value)
+        return BinaryDataType::Char;
+    if (std::is_floating_point<T>::value)
+        return sizeof(T) == 4 ? BinaryDataType::Float32
+                              : BinaryDataType::Float64;
+    if (std::is_signed<T>::value)
+        return sizeof(T) == 1 ? BinaryDataType::Int8
+                              : sizeof(T) == 4 ? BinaryDataType::Int32
+                                               : BinaryDataType::Int64;
+    return sizeof(T) == 1 ? BinaryDataType::UInt8
+                          : sizeof(T) == 4 ? BinaryDataType::UInt32
+                                           : BinaryDataType::UInt64;
+}
+
+class BinaryWriter
+{
+public:
+    explicit BinaryWriter(std::string const& file_name)
+        : _os(file_name, std::ios::binary)
+    {
+        if (!_os)
+            OGS_FATAL("Could not open file `%s' for writing.",
+                      file_name.c_str());
+    }
+
+    void write(std::uint64_t const value)
+    {
+        _os.write(reinterpret_cast<char const*>(&value), sizeof(value));
+    }
+
+    void write(void const* const data, std::size_t const n_bytes)
+    {
+        _os.write(static_cast<char const*>(data), n_bytes);
+    }
+
+    void write(std::string const& str)
+    {
+        write(str.data(), str.size());
+        pad(str.size());
+    }
+
+    void pad(std::size_t const n_bytes)
+    {
+        char const zeros[alignment] = {};
+        _os.write(zeros, padding(n_bytes));
+    }
+
+    bool good() const { return _os.good(); }
+
+private:
+    std::ofstream _os;
+};
+
+template <typename T>
+bool writeProperty(BinaryWriter& writer, MeshLib::Properties const& properties,
+                   std::string const& name)
+{
+    auto const& p = properties.getPropertyVector<T>(name);
+    if (!p)
+        return false;
+
+    writer.write(name.size());
+    writer.write(static_cast<std::uint64_t>(p->getMeshItemType()));
+    writer.write(static_cast<std::uint64_t>(getBinaryDataType<T>()));
+    writer.write(p->getNumberOfComponents());
+    writer.write(p->size());
+    writer.write(name);
+    writer.write(p->data(), p->size() * sizeof(T));
+    writer.pad(p->size() * sizeof(T));
+    return true;
+}
+
+bool writeProperty(BinaryWriter& writer, MeshLib::Properties const& properties,
+                   std::string const& name)
+{
+    return writeProperty<double>(writer, properties, name) ||
+           writeProperty<float>(writer, properties, name) ||
+           writeProperty<int>(writer, properties, name) ||
+           writeProperty<unsigned>(writer, properties, name) ||
+           writeProperty<long>(writer, properties, name) ||
+           writeProperty<unsigned long>(writer, properties, name) ||
+           writeProperty<char>(writer, properties, name) ||
+           writeProperty<unsigned char>(writer, properties, name);
+}
+
+template <typename T>
+bool hasPropertyOfType(MeshLib::Properties const& properties,
+                       std::string const& name)
+{
+    return static_cast<bool>(properties.getPropertyVector<T>(name));
+}
+
+bool isSupportedProperty(MeshLib::Properties const& properties,
+                         std::string const& name)
+{
+    return hasPropertyOfType<double>(properties, name) ||
+           hasPropertyOfType<float>(properties, name) ||
+           hasPropertyOfType<int>(properties, name) ||
+           hasPropertyOfType<unsigned>(properties, name) ||
+           hasPropertyOfType<long>(properties, name) ||
+           hasPropertyOfType<unsigned long>(properties, name) ||
+           hasPropertyOfType<char>(properties, name) ||
+           hasPropertyOfType<unsigned char>(properties, name);
+}
+
+/// Sequential access to the sections of a mapped binary mesh file.
+class BinaryReader
+{
+public:
+    BinaryReader(char const* data, std::size_t size, std::string const& name)
+        : _data(data), _size(size), _file_name(name)
+    {
+    }
+
+    /// Returns a pointer to the next n values and skips the padding.
+    template <typename T>
+    T const* take(std::size_t const n)
+    {
+        std::size_t const n_bytes = n * sizeof(T);
+        if (n_bytes / sizeof(T) != n || _size - _position < n_bytes)
+            OGS_FATAL("The binary mesh file `%s' is truncated.",
+                      _file_name.c_str());
+        T const* const values = reinterpret_cast<T const*>(_data + _position);
+        _position += n_bytes;
+        _position += std::min(padding(n_bytes), _size - _position);
+        return values;
+    }
+
+    std::uint64_t readValue() { return *take<std::uint64_t>(1); }
+
+    std::string readString(std::size_t const length)
+    {
+        return std::string(take<char>(length), length);
+    }
+
+private:
+    char const* const _data;
+    std::size_t const _size;
+    std::size_t _position = 0;
+    std::string const& _file_name;
+};
+
+template <typename T>
+void createProperty(MeshLib::Properties& properties,
+                    MeshLib::IO::BinaryPropertyView const& view)
+{
+    auto p = properties.createNewPropertyVector<T>(
+        view.name, view.mesh_item_type, view.n_components);
+    if (!p)
+    {
+        WARN("Could not create property vector `%s'.", view.name.c_str());
+        return;
+    }
+    p->resize(view.n_values);
+    std::memcpy(p->data(), view.data, view.n_values * sizeof(T));
+}
+
+void createProperty(MeshLib::Properties& properties,
+                    MeshLib::IO::BinaryPropertyView const& view)
+{
+    using MeshLib::IO::BinaryDataType;
+    using Int64 = std::conditional<sizeof(long) == 8, long, long long>::type;
+    using UInt64 = std::conditional<sizeof(unsigned long) == 8, unsigned long,
+                                    unsigned long long>::type;
+    switch (view.data_type)
+    {
+        case BinaryDataType::Float64:
+            return createProperty<double>(properties, view);
+        case BinaryDataType::Float32:
+            return createProperty<float>(properties, view);
+        case BinaryDataType::Int64:
+            return createProperty<Int64>(properties, view);
+        case BinaryDataType::UInt64:
+            return createProperty<UInt64>(properties, view);
+        case BinaryDataType::Int32:
+            return createProperty<int>(properties, view);
+        case BinaryDataType::UInt32:
+            return createProperty<unsigned>(properties, view);
+        case BinaryDataType::Int8:
+            return createProperty<signed char>(properties, view);
+        case BinaryDataType::UInt8:
+            return createProperty<unsigned char>(properties, view);
+        case BinaryDataType::Char:
+            return createProperty<char>(properties, view);
+    }
+}
+
+}  // anonymous namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+std::size_t getBinaryDataTypeSize(BinaryDataType const data_type)
+{
+    switch (data_type)
+    {
+        case BinaryDataType::Float64:
+        case BinaryDataType::Int64:
+        case BinaryDataType::UInt64:
+            return 8;
+        case BinaryDataType::Float32:
+        case BinaryDataType::Int32:
+        case BinaryDataType::UInt32:
+            return 4;
+        case BinaryDataType::Int8:
+        case BinaryDataType::UInt8:
+        case BinaryDataType::Char:
+            return 1;
+    }
+    OGS_FATAL("Unknown binary data type %lu.",
+              static_cast<unsigned long>(data_type));
+}
+
+void BinaryMeshView::checkPropertySize(BinaryPropertyView const& property,
+                                       std::string const& file_name) const
+{
+    bool valid = property.n_components > 0 &&
+                 property.n_values % property.n_components == 0;
+    if (valid)
+    {
+        // The numbers of edges and faces are not stored in the file.
+        std::size_t const n_tuples = property.n_values / property.n_components;
+        if (property.mesh_item_type == MeshItemType::Node)
+            valid = n_tuples == _n_nodes;
+        else if (property.mesh_item_type == MeshItemType::Cell)
+            valid = n_tuples == _n_elements;
+    }
+    // getBinaryDataTypeSize() fails for unknown data types.
+    valid = valid && property.n_values <=
+                         std::numeric_limits<std::size_t>::max() /
+                             getBinaryDataTypeSize(property.data_type);
+    if (!valid)
+        OGS_FATAL("Property `%s' in `%s' has %lu values with %lu components; "
+                  "this does not match the mesh with %lu nodes and %lu "
+                  "elements.",
+                  property.name.c_str(), file_name.c_str(),
+                  static_cast<unsigned long>(property.n_values),
+                  static_cast<unsigned long>(property.n_components),
+                  static_cast<unsigned long>(_n_nodes),
+                  static_cast<unsigned long>(_n_elements));
+}
+
+BinaryMeshView::BinaryMeshView(std::string const& file_name)
+    : _file(file_name)
+{
+    if (!isLittleEndian())
+        OGS_FATAL("Reading binary meshes requires a little endian system.");
+
+    BinaryReader reader(_file.data(), _file.size(), file_name);
+
+    if (std::memcmp(reader.take<char>(sizeof(magic)), magic, sizeof(magic)))
+        OGS_FATAL("The file `%s' is not a binary mesh file.",
+                  file_name.c_str());
+    auto const version = reader.readValue();
+    if (version > binary_mesh_format_version)
+        OGS_FATAL("The binary mesh file `%s' has version %lu; only versions "
+                  "up to %lu are supported.",
+                  file_name.c_str(), static_cast<unsigned long>(version),
+                  static_cast<unsigned long>(binary_mesh_format_version));
+
+    _n_nodes = reader.readValue();
+    _n_base_nodes = reader.readValue();
+    _n_elements = reader.readValue();
+    std::size_t const n_element_nodes = reader.readValue();
+    std::size_t const n_properties = reader.readValue();
+    _name = reader.readString(reader.readValue());
+
+    _coordinates = reader.take<double>(3 * _n_nodes);
+    _offsets = reader.take<std::size_t>(_n_elements + 1);
+    _element_nodes = reader.take<std::size_t>(n_element_nodes);
+    _cell_types = reader.take<std::uint8_t>(_n_elements);
+
+    if (_n_base_nodes > _n_nodes)
+        OGS_FATAL("The binary mesh file `%s' has more base nodes than nodes.",
+                  file_name.c_str());
+    if (_offsets[0] != 0 || _offsets[_n_elements] != n_element_nodes)
+        OGS_FATAL("The element node offsets in `%s' are inconsistent.",
+                  file_name.c_str());
+    // All elements are checked here such that createMesh() cannot fail
+    // after it started to allocate nodes and elements.
+    for (std::size_t e = 0; e < _n_elements; ++e)
+    {
+        bool valid = isSupportedCellType(getCellType(e)) &&
+                     _offsets[e] <= _offsets[e + 1] &&
+                     _offsets[e + 1] - _offsets[e] ==
+                         getCellTypeNumberOfNodes(getCellType(e));
+        for (std::size_t k = _offsets[e]; valid && k < _offsets[e + 1]; ++k)
+            valid = _element_nodes[k] < _n_nodes;
+        if (!valid)
+            OGS_FATAL("Element %lu of the binary mesh file `%s' is invalid.",
+                      static_cast<unsigned long>(e), file_name.c_str());
+    }
+
+    _properties.resize(n_properties);
+    for (auto& p : _properties)
+    {
+        std::size_t const name_length = reader.readValue();
+        auto const mesh_item_type = reader.readValue();
+        p.data_type = static_cast<BinaryDataType>(reader.readValue());
+        p.n_components = reader.readValue();
+        p.n_values = reader.readValue();
+        p.name = reader.readString(name_length);
+
+        if (mesh_item_type > static_cast<std::uint64_t>(MeshItemType::Cell))
+            OGS_FATAL("Property `%s' in `%s' has the unknown mesh item type "
+                      "%lu.",
+                      p.name.c_str(), file_name.c_str(),
+                      static_cast<unsigned long>(mesh_item_type));
+        p.mesh_item_type = static_cast<MeshItemType>(mesh_item_type);
+        checkPropertySize(p, file_name);
+
+        p.data = reader.take<char>(p.n_values *
+                                   getBinaryDataTypeSize(p.data_type));
+    }
+
+    DBUG("Mapped binary mesh `%s' (%s): %lu nodes, %lu elements.",
+         _name.c_str(), _file.isMapped() ? "memory mapped" : "read",
+         static_cast<unsigned long>(_n_nodes),
+         static_cast<unsigned long>(_n_elements));
+}
+
+Mesh* BinaryMeshView::createMesh() const
+{
+    std::vector<Node*> nodes(_n_nodes);
+    for (std::size_t i = 0; i < _n_nodes; ++i)
+        nodes[i] = new Node(_coordinates + 3 * i, i);
+
+    // The connectivity has been checked by the constructor.
+    std::vector<Element*> elements(_n_elements);
+    for (std::size_t e = 0; e < _n_elements; ++e)
+    {
+        IndexRange const node_ids(_element_nodes + _offsets[e],
+                                  _element_nodes + _offsets[e + 1]);
+        elements[e] = createElement(getCellType(e), nodes, node_ids);
+    }
+
+    Properties properties;
+    for (auto const& p : _properties)
+        createProperty(properties, p);
+
+    return new Mesh(_name, nodes, elements, properties, _n_base_nodes);
+}
+
+void writeBinaryMesh(Mesh const& mesh, std::string const& file_name)
+{
+    if (!isLittleEndian())
+        OGS_FATAL("Writing binary meshes requires a little endian system.");
+
+    auto const& nodes = mesh.getNodes();
+    auto const& elements = mesh.getElements();
+    auto const& properties = mesh.getProperties();
+
+    std::size_t n_element_nodes = 0;
+    for (auto const* e : elements)
+        n_element_nodes += e->getNumberOfNodes();
+
+    // Only the property vectors of supported types are counted in the header.
+    std::vector<std::string> property_names;
+    for (auto const& name : properties.getPropertyVectorNames())
+    {
+        if (isSupportedProperty(properties, name))
+            property_names.push_back(name);
+        else
+            WARN("Property vector `%s' has an unsupported type; it is not "
+                 "written to the binary mesh file.", name.c_str());
+    }
+
+    BinaryWriter writer(file_name);
+    writer.write(magic, sizeof(magic));
+    writer.write(binary_mesh_format_version);
+    writer.write(mesh.getNumberOfNodes());
+    writer.write(mesh.getNumberOfBaseNodes());
+    writer.write(mesh.getNumberOfElements());
+    writer.write(n_element_nodes);
+    writer.write(property_names.size());
+    writer.write(mesh.getName().size());
+    writer.write(mesh.getName());
+
+    for (auto const* node : nodes)
+        writer.write(node->getCoords(), 3 * sizeof(double));
+
+    std::uint64_t offset = 0;
+    writer.write(offset);
+    for (auto const* e : elements)
+    {
+        offset += e->getNumberOfNodes();
+        writer.write(offset);
+    }
+
+    for (auto const* e : elements)
+    {
+        unsigned const n_nodes = e->getNumberOfNodes();
+        for (unsigned i = 0; i < n_nodes; ++i)
+            writer.write(e->getNode(i)->getID());
+    }
+
+    for (auto const* e : elements)
+    {
+        auto const cell_type = static_cast<std::uint8_t>(e->getCellType());
+        writer.write(&cell_type, 1);
+    }
+    writer.pad(elements.size());
+
+    for (auto const& name : property_names)
+        writeProperty(writer, properties, name);
+
+    if (!writer.good())
+        OGS_FATAL("Writing the binary mesh file `%s' failed.",
+                  file_name.c_str());
+}
+
+Mesh* readBinaryMesh(std::string const& file_name)
+{
+    BinaryMeshView const view(file_name);
+    return view.createMesh();
+}
+
+}  // namespace IO
+}  // namespace MeshLib
@@ -0,0 +1,146 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef MESHLIB_IO_BINARYMESHIO_H_
+#define MESHLIB_IO_BINARYMESHIO_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "BaseLib/MemoryMappedFile.h"
+
+#include "MeshLib/Location.h"
+#include "MeshLib/MeshEnums.h"
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+/// Version of the binary mesh format written by writeBinaryMesh().
+std::uint64_t const binary_mesh_format_version = 1;
+
+/// Value types of property vectors in the binary mesh format.
+enum class BinaryDataType : std::uint64_t
+{
+    Float64 = 0,
+    Float32 = 1,
+    Int64 = 2,
+    UInt64 = 3,
+    Int32 = 4,
+    UInt32 = 5,
+    Int8 = 6,
+    UInt8 = 7,
+    Char = 8
+};
+
+/// Size in bytes of a single value of the given type.
+std::size_t getBinaryDataTypeSize(BinaryDataType const data_type);
+
+/// A property vector stored in a binary mesh file.
+struct BinaryPropertyView
+{
+    std::string name;
+    MeshItemType mesh_item_type;
+    BinaryDataType data_type;
+    std::size_t n_components;
+    /// Number of values, i.e. number of tuples times number of components.
+    std::size_t n_values;
+    /// Points into the memory mapped file.
+    void const* data;
+};
+
+/// Read-only access to a mesh stored in the binary mesh format.
+///
+/// The binary mesh format stores all data in little endian byte order. Every
+/// section starts at a multiple of 8 bytes, so the arrays can be used in
+/// place after the file has been mapped into memory.
+/// - Header: the magic string "OGSBMESH", the format version, the numbers of
+///   nodes, base nodes, elements, element nodes (length of the connectivity
+///   array) and properties, and the length of the mesh name (all uint64),
+///   followed by the mesh name.
+/// - Node coordinates: x0, y0, z0, x1, ... (double).
+/// - Element node offsets: n_elements + 1 offsets into the connectivity array
+///   (uint64).
+/// - Connectivity: the node ids of all elements (uint64).
+/// - Cell types: one MeshLib::CellType per element (uint8).
+/// - Properties: for every property the length of its name, its mesh item
+///   type, its BinaryDataType, the number of components and the number of
+///   values (all uint64), followed by the name and the values.
+///
+/// The view does not copy any of the arrays.
+class BinaryMeshView final
+{
+public:
+    /// Maps the given file into memory and checks the header, the sizes of
+    /// all sections, the cell types and node ids of all elements, and the
+    /// sizes of the property vectors.
+    explicit BinaryMeshView(std::string const& file_name);
+
+    std::string const& getName() const { return _name; }
+    std::size_t getNumberOfNodes() const { return _n_nodes; }
+    std::size_t getNumberOfBaseNodes() const { return _n_base_nodes; }
+    std::size_t getNumberOfElements() const { return _n_elements; }
+
+    /// The 3 * getNumberOfNodes() node coordinates.
+    double const* getCoordinates() const { return _coordinates; }
+
+    /// The getNumberOfElements() + 1 offsets into getElementNodes().
+    std::size_t const* getElementNodeOffsets() const { return _offsets; }
+
+    /// The node ids of all elements.
+    std::size_t const* getElementNodes() const { return _element_nodes; }
+
+    CellType getCellType(std::size_t const element_id) const
+    {
+        return static_cast<CellType>(_cell_types[element_id]);
+    }
+
+    std::vector<BinaryPropertyView> const& getProperties() const
+    {
+        return _properties;
+    }
+
+    /// Creates a MeshLib::Mesh from the data of the file.
+    Mesh* createMesh() const;
+
+private:
+    /// Checks the number of values of the property against the number of
+    /// nodes or elements.
+    void checkPropertySize(BinaryPropertyView const& property,
+                           std::string const& file_name) const;
+
+    BaseLib::MemoryMappedFile const _file;
+
+    std::string _name;
+    std::size_t _n_nodes = 0;
+    std::size_t _n_base_nodes = 0;
+    std::size_t _n_elements = 0;
+
+    double const* _coordinates = nullptr;
+    std::size_t const* _offsets = nullptr;
+    std::size_t const* _element_nodes = nullptr;
+    std::uint8_t const* _cell_types = nullptr;
+    std::vector<BinaryPropertyView> _properties;
+};
+
+/// Writes the mesh including all property vectors of supported value types
+/// in the binary mesh format, see BinaryMeshView.
+void writeBinaryMesh(Mesh const& mesh, std::string const& file_name);
+
+/// Reads a mesh from a file in the binary mesh format.
+Mesh* readBinaryMesh(std::string const& file_name);
+
+}  // namespace IO
+}  // namespace MeshLib
+
+#endif  // MESHLIB_IO_BINARYMESHIO_H_
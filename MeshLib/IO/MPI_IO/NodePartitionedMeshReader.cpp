@@ -14,6 +14,8 @@
 
 #include "NodePartitionedMeshReader.h"
 
+#include <algorithm>
+
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/FileTools.h"
@@ -122,17 +124,151 @@ NodePartitionedMeshReader::readBinaryDataFromFile(std::string const& filename,
         return false;
     }
 
-    // Read data
+    // Read data collectively, s.t. the MPI-IO implementation can aggregate
+    // the requests of all ranks.
     char file_mode[] = "native";
     MPI_File_set_view(file, offset, type, type, file_mode, MPI_INFO_NULL);
     // The static cast is checked above.
-    MPI_File_read(file, data.data(), static_cast<int>(data.size()), type,
+    MPI_File_read_all(file, data.data(), static_cast<int>(data.size()), type,
         MPI_STATUS_IGNORE);
     MPI_File_close(&file);
 
     return true;
 }
 
+bool NodePartitionedMeshReader::readBinaryFile(std::string const& filename,
+    std::vector<char>& data) const
+{
+    MPI_File file;
+
+    char* filename_char = const_cast<char*>(filename.data());
+    int const file_status = MPI_File_open(_mpi_comm, filename_char,
+            MPI_MODE_RDONLY, MPI_INFO_NULL, &file);
+
+    if(file_status != 0)
+    {
+        ERR("Error opening file %s. MPI error code %d", filename.c_str(), file_status);
+        return false;
+    }
+
+    MPI_Offset file_size = 0;
+    MPI_File_get_size(file, &file_size);
+    if (!is_safely_convertable<MPI_Offset, int>(file_size))
+    {
+        ERR("The file %s is too large for MPI_File_read_all() call.",
+            filename.c_str());
+        MPI_File_close(&file);
+        return false;
+    }
+    data.resize(static_cast<std::size_t>(file_size));
+
+    char file_mode[] = "native";
+    MPI_File_set_view(file, 0, MPI_CHAR, MPI_CHAR, file_mode, MPI_INFO_NULL);
+    MPI_File_read_all(file, data.data(), static_cast<int>(file_size),
+        MPI_CHAR, MPI_STATUS_IGNORE);
+    MPI_File_close(&file);
+
+    return true;
+}
+
+bool NodePartitionedMeshReader::readPropertiesBinary(
+    const std::string &file_name_base, MeshLib::Properties& properties) const
+{
+    const std::string fname_header = file_name_base +  "_partitioned_msh_";
+    const std::string fname_num_p_ext = std::to_string(_mpi_comm_size) + ".bin";
+
+    std::string const fname_cfg = fname_header + "props_cfg" + fname_num_p_ext;
+    if (!BaseLib::IsFileExisting(fname_cfg))
+        return true;
+
+    std::vector<char> cfg;
+    if (!readBinaryFile(fname_cfg, cfg))
+        return false;
+
+    // Sequential reading of the configuration data.
+    std::size_t pos = 0;
+    auto const read_cfg = [&](void* value, std::size_t const size) -> bool
+    {
+        if (pos + size > cfg.size())
+            return false;
+        std::copy(cfg.data() + pos, cfg.data() + pos + size,
+                  static_cast<char*>(value));
+        pos += size;
+        return true;
+    };
+
+    unsigned long number_of_properties = 0;
+    if (!read_cfg(&number_of_properties, sizeof(unsigned long)))
+    {
+        ERR("Error reading the property configuration from %s.",
+            fname_cfg.c_str());
+        return false;
+    }
+
+    std::string const fname_val = fname_header + "props_val" + fname_num_p_ext;
+    for (unsigned long i = 0; i < number_of_properties; ++i)
+    {
+        unsigned long name_length = 0;
+        if (!read_cfg(&name_length, sizeof(unsigned long)) ||
+            pos + name_length > cfg.size())
+        {
+            ERR("Error reading the property configuration from %s.",
+                fname_cfg.c_str());
+            return false;
+        }
+        std::string const name(cfg.data() + pos, name_length);
+        pos += name_length;
+
+        // Mesh item type, data type, number of components.
+        unsigned long header[3];
+        // Offsets of the values of all partitions.
+        std::vector<unsigned long> offsets(_mpi_comm_size);
+        if (!read_cfg(header, sizeof(header)) ||
+            !read_cfg(offsets.data(), offsets.size() * sizeof(unsigned long)))
+        {
+            ERR("Error reading the property configuration from %s.",
+                fname_cfg.c_str());
+            return false;
+        }
+
+        auto const item_type = static_cast<MeshLib::MeshItemType>(header[0]);
+        unsigned long const n_items =
+            item_type == MeshLib::MeshItemType::Node
+                ? _mesh_info.nodes
+                : _mesh_info.regular_elements + _mesh_info.ghost_elements;
+        unsigned long const n_components = header[2];
+        MPI_Offset const offset = static_cast<MPI_Offset>(offsets[_mpi_rank]);
+
+        bool read_ok = false;
+        switch (header[1])
+        {
+        case 0:
+        {
+            auto pv = properties.createNewPropertyVector<double>(
+                name, item_type, n_components);
+            pv->resize(n_items * n_components);
+            read_ok = readBinaryDataFromFile(fname_val, offset, MPI_DOUBLE, *pv);
+            break;
+        }
+        case 1:
+        {
+            auto pv = properties.createNewPropertyVector<int>(
+                name, item_type, n_components);
+            pv->resize(n_items * n_components);
+            read_ok = readBinaryDataFromFile(fname_val, offset, MPI_INT, *pv);
+            break;
+        }
+        default:
+            ERR("Unknown data type %d of property %s.", header[1],
+                name.c_str());
+        }
+        if (!read_ok)
+            return false;
+    }
+
+    return true;
+}
+
 MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::readBinary(
     const std::string &file_name_base)
 {
@@ -183,9 +319,15 @@ MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::readBinary(
     const bool process_ghost = true;
     setElements(mesh_nodes, ghost_elem_data, mesh_elems, process_ghost);
 
+    //----------------------------------------------------------------------------------
+    // Read properties
+    MeshLib::Properties properties;
+    if (!readPropertiesBinary(file_name_base, properties))
+        return nullptr;
+
     //----------------------------------------------------------------------------------
     return newMesh(BaseLib::extractBaseName(file_name_base),
-               mesh_nodes, glb_node_ids, mesh_elems);
+               mesh_nodes, glb_node_ids, mesh_elems, properties);
 }
 
 bool NodePartitionedMeshReader::openASCIIFiles(std::string const& file_name_base,
@@ -392,7 +534,8 @@ MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::readASCII(
 
         if(_mpi_rank == i)
             np_mesh = newMesh(BaseLib::extractBaseName(file_name_base),
-                    mesh_nodes, glb_node_ids, mesh_elems);
+                    mesh_nodes, glb_node_ids, mesh_elems,
+                    MeshLib::Properties());
     }
 
     if(_mpi_rank == 0)
@@ -412,12 +555,13 @@ NodePartitionedMeshReader::newMesh(
     std::string const& mesh_name,
     std::vector<MeshLib::Node*> const& mesh_nodes,
     std::vector<unsigned long> const& glb_node_ids,
-    std::vector<MeshLib::Element*> const& mesh_elems) const
+    std::vector<MeshLib::Element*> const& mesh_elems,
+    MeshLib::Properties const& properties) const
 {
     return new MeshLib::NodePartitionedMesh(
         mesh_name + std::to_string(_mpi_comm_size),
         mesh_nodes, glb_node_ids, mesh_elems,
-        MeshLib::Properties(),
+        properties,
         _mesh_info.global_base_nodes,
         _mesh_info.global_nodes,
         _mesh_info.base_nodes,
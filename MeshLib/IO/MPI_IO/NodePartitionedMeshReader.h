@@ -21,6 +21,7 @@
 #include <mpi.h>
 
 #include "MeshLib/NodePartitionedMesh.h"
+#include "MeshLib/Properties.h"
 
 namespace MeshLib
 {
@@ -99,15 +100,17 @@ private:
         \param mesh_nodes   Node data.
         \param glb_node_ids Global IDs of nodes.
         \param mesh_elems   Element data.
+        \param properties   Mesh properties.
         \return             True on success and false otherwise.
      */
     MeshLib::NodePartitionedMesh* newMesh(std::string const& mesh_name,
         std::vector<MeshLib::Node*> const& mesh_nodes,
         std::vector<unsigned long> const& glb_node_ids,
-        std::vector<MeshLib::Element*> const& mesh_elems) const;
+        std::vector<MeshLib::Element*> const& mesh_elems,
+        MeshLib::Properties const& properties) const;
 
     /*!
-        \brief Parallel reading of a binary file via MPI_File_read, and it is called by readBinary
+        \brief Collective reading of a binary file via MPI_File_read_all, and it is called by readBinary
                to read files of mesh data head, nodes, non-ghost elements and ghost elements, respectively.
         \note           In case of failure during opening of the file, an
                         error message is printed.
@@ -127,6 +130,37 @@ private:
     bool readBinaryDataFromFile(std::string const& filename, MPI_Offset offset,
         MPI_Datatype type, DATA& data) const;
 
+    /*!
+        \brief Collective reading of a whole (small) binary file by all
+               ranks via MPI_File_read_all.
+        \param filename File name containing data.
+        \param data     A container to be filled with the file content.
+        \return         True on success and false otherwise.
+     */
+    bool readBinaryFile(std::string const& filename,
+        std::vector<char>& data) const;
+
+    /*!
+         \brief Read the node and cell properties of the partition of this
+                rank from the binary files
+                file_name_base+_partitioned_msh_props_cfg[number of partitions].bin
+                file_name_base+_partitioned_msh_props_val[number of partitions].bin
+                The first file is read completely by all ranks. It contains
+                the number of properties followed by a record for each
+                property: the length of the name, the name, the mesh item
+                type, the data type (0: double, 1: int), the number of
+                components, and the byte offsets of the values of each
+                partition in the second file.
+                Meshes partitioned without properties have no such files.
+         \param file_name_base  Name of file to be read, which must be a name
+                                with the path to the file and without file
+                                extension.
+         \param properties      Properties to be filled.
+         \return                True on success and false otherwise.
+     */
+    bool readPropertiesBinary(const std::string &file_name_base,
+        MeshLib::Properties& properties) const;
+
     /*!
          \brief Create a NodePartitionedMesh object, read binary mesh data
                 in the manner of parallel, and return a pointer to it.
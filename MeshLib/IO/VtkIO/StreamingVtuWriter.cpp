@@ -0,0 +1,476 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "StreamingVtuWriter.h"
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#include <vtk_zlib.h>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/Properties.h"
+#include "MeshLib/VtkOGSEnum.h"
+
+namespace
+{
+using Header = std::uint64_t;
+
+/// Description of one DataArray element and its values.
+struct DataArray
+{
+    std::string name;
+    std::string type;
+    std::size_t n_components;
+    char const* data;
+    std::size_t n_bytes;
+    std::function<void(std::ostream&)> write_ascii;
+};
+
+template <typename T>
+std::string getVtkTypeName()
+{
+    std::string const size = std::to_string(8 * sizeof(T));
+    if (std::is_floating_point<T>::value)
+        return "Float" + size;
+    return (std::is_signed<T>::value ? "Int" : "UInt") + size;
+}
+
+template <typename T>
+void writeAsciiValues(std::ostream& os, T const* values, std::size_t const n)
+{
+    // The unary plus prints character types as numbers.
+    for (std::size_t i = 0; i < n; ++i)
+        os << +values[i] << (i % 6 == 5 ? '\n' : ' ');
+}
+
+template <typename T>
+DataArray makeDataArray(std::string const& name, T const* values,
+                        std::size_t const n_values,
+                        std::size_t const n_components)
+{
+    return {name,
+            getVtkTypeName<T>(),
+            n_components,
+            reinterpret_cast<char const*>(values),
+            n_values * sizeof(T),
+            [values, n_values](std::ostream& os) {
+                writeAsciiValues(os, values, n_values);
+            }};
+}
+
+template <typename T>
+bool addProperty(MeshLib::Properties const& properties,
+                 std::string const& name,
+                 std::vector<DataArray>& point_data,
+                 std::vector<DataArray>& cell_data)
+{
+    auto const p = properties.getPropertyVector<T>(name);
+    if (!p)
+        return false;
+
+    auto array = makeDataArray(name, p->data(), p->size(),
+                               p->getNumberOfComponents());
+    if (p->getMeshItemType() == MeshLib::MeshItemType::Node)
+        point_data.push_back(std::move(array));
+    else if (p->getMeshItemType() == MeshLib::MeshItemType::Cell)
+        cell_data.push_back(std::move(array));
+    return true;
+}
+
+/// Streaming base64 encoder; consecutive calls of encode() produce one
+/// contiguous base64 string.
+class Base64Encoder
+{
+public:
+    explicit Base64Encoder(std::ostream& os) : _os(os) {}
+
+    void encode(char const* data, std::size_t n_bytes)
+    {
+        while (n_bytes > 0)
+        {
+            _buffer[_n_buffered++] = static_cast<unsigned char>(*data++);
+            --n_bytes;
+            if (_n_buffered == 3)
+                flush();
+        }
+    }
+
+    /// Writes the remaining bytes including the padding.
+    void finish()
+    {
+        if (_n_buffered > 0)
+            flush();
+    }
+
+private:
+    void flush()
+    {
+        static char const table[] =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        for (std::size_t i = _n_buffered; i < 3; ++i)
+            _buffer[i] = 0;
+        char const out[4] = {
+            table[_buffer[0] >> 2],
+            table[((_buffer[0] & 0x03) << 4) | (_buffer[1] >> 4)],
+            _n_buffered > 1
+                ? table[((_buffer[1] & 0x0f) << 2) | (_buffer[2] >> 6)]
+                : '=',
+            _n_buffered > 2 ? table[_buffer[2] & 0x3f] : '='};
+        _os.write(out, 4);
+        _n_buffered = 0;
+    }
+
+    std::ostream& _os;
+    std::array<unsigned char, 3> _buffer;
+    std::size_t _n_buffered = 0;
+};
+
+/// The binary representation of a data array as written to the file: a
+/// header followed by the (possibly compressed) data.
+struct EncodedArray
+{
+    std::vector<Header> header;
+    /// Compressed data, empty if the data is not compressed.
+    std::vector<char> compressed;
+    /// Uncompressed data, points to the data of the DataArray.
+    char const* data = nullptr;
+    std::size_t n_bytes = 0;
+
+    std::size_t headerBytes() const { return header.size() * sizeof(Header); }
+
+    std::size_t size() const
+    {
+        return headerBytes() + (data ? n_bytes : compressed.size());
+    }
+};
+
+EncodedArray encode(DataArray const& array, bool const compress)
+{
+    EncodedArray encoded;
+    if (!compress)
+    {
+        encoded.header = {array.n_bytes};
+        encoded.data = array.data;
+        encoded.n_bytes = array.n_bytes;
+        return encoded;
+    }
+
+    std::size_t const block_size = MeshLib::IO::StreamingVtuWriter::block_size;
+    std::size_t const n_blocks = (array.n_bytes + block_size - 1) / block_size;
+    std::size_t const last_block_size = array.n_bytes % block_size;
+
+    // Blocks are compressed independently of each other.
+    std::vector<std::vector<char>> blocks(n_blocks);
+    bool failed = false;
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic) reduction(||:failed)
+    for (OPENMP_LOOP_TYPE b = 0; b < n_blocks; ++b)
+#else
+    for (std::size_t b = 0; b < n_blocks; ++b)
+#endif
+    {
+        auto const* const source =
+            reinterpret_cast<Bytef const*>(array.data + b * block_size);
+        uLong const source_size = static_cast<uLong>(
+            std::min(block_size, array.n_bytes - b * block_size));
+        uLongf compressed_size = compressBound(source_size);
+        blocks[b].resize(compressed_size);
+        if (compress2(reinterpret_cast<Bytef*>(blocks[b].data()),
+                      &compressed_size, source, source_size,
+                      Z_BEST_SPEED) != Z_OK)
+        {
+            failed = true;
+        }
+        blocks[b].resize(compressed_size);
+    }
+    if (failed)
+        OGS_FATAL("Compression of the data array `%s' failed.",
+                  array.name.c_str());
+
+    encoded.header = {n_blocks, block_size, last_block_size};
+    for (auto const& block : blocks)
+        encoded.header.push_back(block.size());
+    for (auto const& block : blocks)
+        encoded.compressed.insert(encoded.compressed.end(), block.begin(),
+                                  block.end());
+    return encoded;
+}
+
+void writeBase64(std::ostream& os, EncodedArray const& encoded)
+{
+    Base64Encoder encoder(os);
+    encoder.encode(reinterpret_cast<char const*>(encoded.header.data()),
+                   encoded.headerBytes());
+    if (encoded.data)
+    {
+        encoder.encode(encoded.data, encoded.n_bytes);
+        encoder.finish();
+        return;
+    }
+    // The header of compressed data is encoded separately.
+    encoder.finish();
+    encoder.encode(encoded.compressed.data(), encoded.compressed.size());
+    encoder.finish();
+}
+
+void writeRaw(std::ostream& os, EncodedArray const& encoded)
+{
+    os.write(reinterpret_cast<char const*>(encoded.header.data()),
+             encoded.headerBytes());
+    if (encoded.data)
+        os.write(encoded.data, encoded.n_bytes);
+    else
+        os.write(encoded.compressed.data(), encoded.compressed.size());
+}
+
+bool isLittleEndian()
+{
+    std::uint16_t const one = 1;
+    return *reinterpret_cast<std::uint8_t const*>(&one) == 1;
+}
+
+}  // anonymous namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+void appendVtkNodeIDs(Element const& element,
+                      std::vector<std::int64_t>& node_ids)
+{
+    unsigned const n_nodes = element.getNumberOfNodes();
+    std::array<std::int64_t, 27> ids;
+    for (unsigned i = 0; i < n_nodes; ++i)
+        ids[i] = element.getNode(i)->getID();
+
+    switch (element.getCellType())
+    {
+        case CellType::PRISM6:
+            for (unsigned i = 0; i < 3; ++i)
+                std::swap(ids[i], ids[i + 3]);
+            break;
+        case CellType::PRISM15:
+        {
+            std::array<std::int64_t, 15> ogs_ids;
+            std::copy_n(ids.begin(), 15, ogs_ids.begin());
+            for (unsigned i = 0; i < 3; ++i)
+            {
+                ids[i] = ogs_ids[i + 3];
+                ids[i + 3] = ogs_ids[i];
+            }
+            for (unsigned i = 0; i < 3; ++i)
+                ids[6 + i] = ogs_ids[8 - i];
+            for (unsigned i = 0; i < 3; ++i)
+                ids[9 + i] = ogs_ids[14 - i];
+            ids[12] = ogs_ids[9];
+            ids[13] = ogs_ids[11];
+            ids[14] = ogs_ids[10];
+            break;
+        }
+        default:
+            break;
+    }
+    node_ids.insert(node_ids.end(), ids.begin(), ids.begin() + n_nodes);
+}
+
+std::size_t const StreamingVtuWriter::block_size;
+
+StreamingVtuWriter::StreamingVtuWriter(Mesh const& mesh,
+                                       VtuDataMode const data_mode,
+                                       bool const compress)
+    : _mesh(mesh),
+      _data_mode(data_mode),
+      _compress(compress && data_mode != VtuDataMode::Ascii)
+{
+    if (data_mode == VtuDataMode::Ascii && compress)
+        WARN("Ascii data cannot be compressed, ignoring compression flag.");
+}
+
+bool StreamingVtuWriter::writeToFile(std::string const& file_name) const
+{
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os)
+    {
+        ERR("Could not open file `%s' for writing.", file_name.c_str());
+        return false;
+    }
+    write(os);
+    if (!os)
+    {
+        ERR("Writing the file `%s' failed.", file_name.c_str());
+        return false;
+    }
+    return true;
+}
+
+void StreamingVtuWriter::write(std::ostream& os) const
+{
+    if (_data_mode != VtuDataMode::Ascii && !isLittleEndian())
+        OGS_FATAL("Binary vtu output requires a little endian system.");
+
+    std::size_t const n_nodes = _mesh.getNumberOfNodes();
+    std::size_t const n_elements = _mesh.getNumberOfElements();
+
+    // Temporary buffers for the geometry and topology.
+    std::vector<double> coordinates;
+    coordinates.reserve(3 * n_nodes);
+    for (auto const* node : _mesh.getNodes())
+        coordinates.insert(coordinates.end(), node->getCoords(),
+                           node->getCoords() + 3);
+
+    std::vector<std::int64_t> connectivity;
+    std::vector<std::int64_t> offsets;
+    std::vector<std::uint8_t> types;
+    offsets.reserve(n_elements);
+    types.reserve(n_elements);
+    for (auto const* element : _mesh.getElements())
+    {
+        appendVtkNodeIDs(*element, connectivity);
+        offsets.push_back(connectivity.size());
+        int const type = OGSToVtkCellType(element->getCellType());
+        if (type < 0)
+            OGS_FATAL("Element %lu has a cell type not supported by vtk.",
+                      static_cast<unsigned long>(element->getID()));
+        types.push_back(static_cast<std::uint8_t>(type));
+    }
+
+    std::vector<DataArray> point_data;
+    std::vector<DataArray> cell_data;
+    auto const& properties = _mesh.getProperties();
+    for (auto const& name : properties.getPropertyVectorNames())
+    {
+        if (addProperty<double>(properties, name, point_data, cell_data) ||
+            addProperty<float>(properties, name, point_data, cell_data) ||
+            addProperty<int>(properties, name, point_data, cell_data) ||
+            addProperty<unsigned>(properties, name, point_data, cell_data) ||
+            addProperty<long>(properties, name, point_data, cell_data) ||
+            addProperty<unsigned long>(properties, name, point_data,
+                                       cell_data) ||
+            addProperty<char>(properties, name, point_data, cell_data) ||
+            addProperty<unsigned char>(properties, name, point_data,
+                                       cell_data))
+            continue;
+        WARN("Property vector `%s' has an unsupported type; it is not written.",
+             name.c_str());
+    }
+
+    std::vector<DataArray> const points = {
+        makeDataArray("Points", coordinates.data(), coordinates.size(), 3)};
+    std::vector<DataArray> const cells = {
+        makeDataArray("connectivity", connectivity.data(), connectivity.size(),
+                      1),
+        makeDataArray("offsets", offsets.data(), offsets.size(), 1),
+        makeDataArray("types", types.data(), types.size(), 1)};
+
+    // In appended mode the offsets into the appended data are written in the
+    // xml part. The size of uncompressed arrays is known in advance and they
+    // are written directly from their storage at the end. Compressed arrays
+    // are kept in compressed form until then.
+    std::vector<DataArray const*> appended;
+    std::vector<EncodedArray> appended_compressed;
+    std::size_t appended_offset = 0;
+
+    char const* const format = _data_mode == VtuDataMode::Ascii
+                                   ? "ascii"
+                                   : _data_mode == VtuDataMode::Binary
+                                         ? "binary"
+                                         : "appended";
+
+    auto write_data_array = [&](DataArray const& array,
+                                std::string const& indent) {
+        os << indent << "<DataArray type=\"" << array.type << "\" Name=\""
+           << array.name << "\"";
+        if (array.n_components > 1)
+            os << " NumberOfComponents=\"" << array.n_components << "\"";
+        os << " format=\"" << format << "\"";
+
+        switch (_data_mode)
+        {
+            case VtuDataMode::Ascii:
+                os << ">\n";
+                array.write_ascii(os);
+                os << "\n" << indent << "</DataArray>\n";
+                break;
+            case VtuDataMode::Binary:
+                os << ">\n" << indent << "  ";
+                writeBase64(os, encode(array, _compress));
+                os << "\n" << indent << "</DataArray>\n";
+                break;
+            case VtuDataMode::Appended:
+                os << " offset=\"" << appended_offset << "\"/>\n";
+                appended.push_back(&array);
+                if (_compress)
+                {
+                    appended_compressed.push_back(encode(array, true));
+                    appended_offset += appended_compressed.back().size();
+                }
+                else
+                {
+                    appended_offset += sizeof(Header) + array.n_bytes;
+                }
+                break;
+        }
+    };
+
+    auto write_section = [&](std::string const& section,
+                             std::vector<DataArray> const& arrays) {
+        os << "      <" << section << ">\n";
+        for (auto const& array : arrays)
+            write_data_array(array, "        ");
+        os << "      </" << section << ">\n";
+    };
+
+    os << std::setprecision(std::numeric_limits<double>::digits10 + 2);
+    os << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" "
+          "byte_order=\"LittleEndian\" header_type=\"UInt64\"";
+    if (_compress)
+        os << " compressor=\"vtkZLibDataCompressor\"";
+    os << ">\n"
+       << "  <UnstructuredGrid>\n"
+       << "    <Piece NumberOfPoints=\"" << n_nodes << "\" NumberOfCells=\""
+       << n_elements << "\">\n";
+    write_section("PointData", point_data);
+    write_section("CellData", cell_data);
+    write_section("Points", points);
+    write_section("Cells", cells);
+    os << "    </Piece>\n"
+       << "  </UnstructuredGrid>\n";
+
+    if (_data_mode == VtuDataMode::Appended)
+    {
+        os << "  <AppendedData encoding=\"raw\">\n   _";
+        for (std::size_t k = 0; k < appended.size(); ++k)
+        {
+            if (_compress)
+                writeRaw(os, appended_compressed[k]);
+            else
+                writeRaw(os, encode(*appended[k], false));
+        }
+        os << "\n  </AppendedData>\n";
+    }
+    os << "</VTKFile>\n";
+}
+
+}  // namespace IO
+}  // namespace MeshLib
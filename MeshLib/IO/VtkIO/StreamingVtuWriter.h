@@ -0,0 +1,84 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef MESHLIB_IO_STREAMINGVTUWRITER_H_
+#define MESHLIB_IO_STREAMINGVTUWRITER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace MeshLib
+{
+class Element;
+class Mesh;
+
+namespace IO
+{
+/// Appends the node ids of the element in the node order of the
+/// corresponding vtk cell type.
+void appendVtkNodeIDs(Element const& element,
+                      std::vector<std::int64_t>& node_ids);
+
+/// Data modes of the StreamingVtuWriter; they correspond to the modes of
+/// vtkXMLWriter.
+enum class VtuDataMode
+{
+    Ascii,
+    Binary,   ///< base64 encoded data inline in the DataArray elements
+    Appended  ///< raw binary data in the AppendedData section
+};
+
+/// Writes a mesh and its property vectors to a VTK XML unstructured grid
+/// file (*.vtu) without creating intermediate VTK objects.
+///
+/// In contrast to VtuInterface the data is written directly from the
+/// property vectors and the mesh. Only the coordinates and the cell arrays
+/// are assembled into temporary buffers. Binary data is optionally
+/// compressed with zlib in blocks of block_size bytes which are compressed
+/// in parallel. In appended mode the compressed arrays are kept in memory
+/// until the appended data section is written, because their offsets are
+/// written before.
+///
+/// Property vectors of types double, float, int, unsigned, long,
+/// unsigned long, char and unsigned char assigned to nodes or cells are
+/// written.
+class StreamingVtuWriter final
+{
+public:
+    /// \param mesh       the mesh to be written.
+    /// \param data_mode  the way the data arrays are stored in the file.
+    /// \param compress   compress the binary data with zlib; ignored for
+    ///                   ascii output.
+    StreamingVtuWriter(Mesh const& mesh,
+                       VtuDataMode const data_mode = VtuDataMode::Appended,
+                       bool const compress = true);
+
+    /// Writes the mesh to the given file.
+    /// \return True on success, false on error.
+    bool writeToFile(std::string const& file_name) const;
+
+    /// Writes the vtu document to the given stream.
+    void write(std::ostream& os) const;
+
+    /// Size of the uncompressed blocks in bytes.
+    static std::size_t const block_size = 32768;
+
+private:
+    Mesh const& _mesh;
+    VtuDataMode const _data_mode;
+    bool const _compress;
+};
+
+}  // namespace IO
+}  // namespace MeshLib
+
+#endif  // MESHLIB_IO_STREAMINGVTUWRITER_H_
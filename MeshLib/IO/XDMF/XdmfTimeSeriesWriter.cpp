@@ -0,0 +1,324 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "XdmfTimeSeriesWriter.h"
+
+#include <cctype>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/VtkIO/StreamingVtuWriter.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/Properties.h"
+
+namespace
+{
+/// 64 bit FNV-1a hash of the given bytes.
+std::uint64_t computeHash(char const* data, std::size_t const n_bytes)
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    for (std::size_t i = 0; i < n_bytes; ++i)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/// Replaces all characters not suitable for file names by underscores. The
+/// result is not unique, e.g. for "a.b" and "a_b".
+std::string makeFileNamePart(std::string name)
+{
+    for (auto& c : name)
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-')
+            c = '_';
+    return name;
+}
+
+/// Replaces the characters with a special meaning in xml attribute values
+/// and text by entity references.
+std::string escapeXML(std::string const& s)
+{
+    std::string escaped;
+    escaped.reserve(s.size());
+    for (char const c : s)
+    {
+        switch (c)
+        {
+            case '&':  escaped += "&amp;"; break;
+            case '<':  escaped += "&lt;"; break;
+            case '>':  escaped += "&gt;"; break;
+            case '"':  escaped += "&quot;"; break;
+            case '\'': escaped += "&apos;"; break;
+            default:   escaped += c;
+        }
+    }
+    return escaped;
+}
+
+/// Xdmf topology type of the given element and the number of nodes which
+/// has to be given explicitly in a mixed topology, zero otherwise.
+std::pair<std::int64_t, std::int64_t> getXdmfCellType(
+    MeshLib::Element const& element)
+{
+    switch (element.getCellType())
+    {
+        case MeshLib::CellType::POINT1:    return {1, 1};  // Polyvertex
+        case MeshLib::CellType::LINE2:     return {2, 2};  // Polyline
+        case MeshLib::CellType::LINE3:     return {34, 0};
+        case MeshLib::CellType::TRI3:      return {4, 0};
+        case MeshLib::CellType::TRI6:      return {36, 0};
+        case MeshLib::CellType::QUAD4:     return {5, 0};
+        case MeshLib::CellType::QUAD8:     return {37, 0};
+        case MeshLib::CellType::QUAD9:     return {35, 0};
+        case MeshLib::CellType::TET4:      return {6, 0};
+        case MeshLib::CellType::TET10:     return {38, 0};
+        case MeshLib::CellType::HEX8:      return {9, 0};
+        case MeshLib::CellType::HEX20:     return {48, 0};
+        case MeshLib::CellType::HEX27:     return {50, 0};
+        case MeshLib::CellType::PRISM6:    return {8, 0};
+        case MeshLib::CellType::PRISM15:   return {40, 0};
+        case MeshLib::CellType::PRISM18:   return {41, 0};
+        case MeshLib::CellType::PYRAMID5:  return {7, 0};
+        case MeshLib::CellType::PYRAMID13: return {39, 0};
+        default:
+            OGS_FATAL("Element %lu has a cell type not supported by xdmf.",
+                      static_cast<unsigned long>(element.getID()));
+    }
+}
+
+/// Xdmf NumberType and Precision attributes of a DataItem of type T.
+template <typename T>
+std::string getXdmfNumberType()
+{
+    std::string type;
+    if (std::is_floating_point<T>::value)
+        type = "Float";
+    else if (sizeof(T) == 1)
+        type = std::is_signed<T>::value ? "Char" : "UChar";
+    else
+        type = std::is_signed<T>::value ? "Int" : "UInt";
+    return "NumberType=\"" + type + "\" Precision=\"" +
+           std::to_string(sizeof(T)) + "\"";
+}
+
+std::string makeDataItem(std::string const& dimensions,
+                         std::string const& number_type,
+                         std::string const& file_name)
+{
+    return "<DataItem Dimensions=\"" + dimensions + "\" " + number_type +
+           " Format=\"Binary\" Endian=\"Little\">" + escapeXML(file_name) +
+           "</DataItem>";
+}
+
+using WriteData = std::function<std::string(
+    std::string const& key, char const* data, std::size_t const n_bytes)>;
+
+/// Writes the property vector of type T with the given name, if there is
+/// one, and adds the corresponding Attribute element to the grid.
+/// \return False if there is no property vector of type T.
+template <typename T>
+bool addAttribute(MeshLib::Properties const& properties,
+                  std::string const& name, WriteData const& write_data,
+                  std::ostream& grid)
+{
+    auto const p = properties.getPropertyVector<T>(name);
+    if (!p)
+        return false;
+
+    std::string center;
+    if (p->getMeshItemType() == MeshLib::MeshItemType::Node)
+        center = "Node";
+    else if (p->getMeshItemType() == MeshLib::MeshItemType::Cell)
+        center = "Cell";
+    else
+        return true;
+
+    std::size_t const n_components = p->getNumberOfComponents();
+    std::string const file_name =
+        write_data("attribute_" + center + "_" + name,
+                   reinterpret_cast<char const*>(p->data()),
+                   p->size() * sizeof(T));
+
+    std::string type = "Scalar";
+    std::string dimensions = std::to_string(p->size() / n_components);
+    if (n_components > 1)
+    {
+        type = n_components == 3 ? "Vector" : "Matrix";
+        dimensions += " " + std::to_string(n_components);
+    }
+    grid << "        <Attribute Name=\"" << escapeXML(name)
+         << "\" AttributeType=\""
+         << type << "\" Center=\"" << center << "\">\n          "
+         << makeDataItem(dimensions, getXdmfNumberType<T>(), file_name)
+         << "\n        </Attribute>\n";
+    return true;
+}
+}  // anonymous namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+XdmfTimeSeriesWriter::XdmfTimeSeriesWriter(std::string const& file_name)
+    : _file_name(file_name),
+      _directory(BaseLib::extractPath(file_name)),
+      _data_file_prefix(BaseLib::extractBaseNameWithoutExtension(file_name))
+{
+}
+
+std::string XdmfTimeSeriesWriter::writeData(std::string const& key,
+                                            char const* data,
+                                            std::size_t const n_bytes)
+{
+    std::uint64_t const hash = computeHash(data, n_bytes);
+
+    // Unchanged data is detected by the size and the hash only. Reading the
+    // file back for a comparison would cost as much I/O as writing it.
+    auto it = _data_files.find(key);
+    if (it != _data_files.end() && it->second.hash == hash &&
+        it->second.n_bytes == n_bytes)
+    {
+        return it->second.file_name;
+    }
+
+    // The key index makes the file names of different keys distinct, even
+    // if the keys are mapped to the same file name part.
+    std::size_t const key_index =
+        it == _data_files.end() ? _data_files.size() : it->second.key_index;
+    unsigned const version = it == _data_files.end() ? 0 : it->second.version + 1;
+    std::string const file_name =
+        _data_file_prefix + "_" + makeFileNamePart(key) + "_" +
+        std::to_string(key_index) + "_" + std::to_string(version) + ".bin";
+
+    std::ofstream os(_directory + file_name, std::ios::binary);
+    if (!os)
+        OGS_FATAL("Could not open file `%s' for writing.",
+                  (_directory + file_name).c_str());
+    os.write(data, n_bytes);
+    if (!os)
+        OGS_FATAL("Writing the file `%s' failed.",
+                  (_directory + file_name).c_str());
+    ++_n_written_data_files;
+
+    _data_files[key] = {file_name, hash, n_bytes, key_index, version};
+    return file_name;
+}
+
+void XdmfTimeSeriesWriter::addTimeStep(Mesh const& mesh, double const t)
+{
+    std::uint16_t const one = 1;
+    if (*reinterpret_cast<std::uint8_t const*>(&one) != 1)
+        OGS_FATAL("Xdmf output requires a little endian system.");
+
+    std::size_t const n_nodes = mesh.getNumberOfNodes();
+    std::size_t const n_elements = mesh.getNumberOfElements();
+
+    std::ostringstream grid;
+    grid << std::setprecision(std::numeric_limits<double>::max_digits10);
+    grid << "      <Grid Name=\"" << escapeXML(mesh.getName())
+         << "\" GridType=\"Uniform\">\n"
+         << "        <Time Value=\"" << t << "\"/>\n";
+
+    {
+        std::vector<std::int64_t> topology;
+        topology.reserve(n_elements * 9);
+        for (auto const* element : mesh.getElements())
+        {
+            auto const type = getXdmfCellType(*element);
+            topology.push_back(type.first);
+            if (type.second > 0)
+                topology.push_back(type.second);
+            appendVtkNodeIDs(*element, topology);
+        }
+        std::string const file_name =
+            writeData("topology", reinterpret_cast<char const*>(topology.data()),
+                      topology.size() * sizeof(std::int64_t));
+        grid << "        <Topology TopologyType=\"Mixed\" NumberOfElements=\""
+             << n_elements << "\">\n          "
+             << makeDataItem(std::to_string(topology.size()),
+                             getXdmfNumberType<std::int64_t>(), file_name)
+             << "\n        </Topology>\n";
+    }
+
+    {
+        std::vector<double> coordinates;
+        coordinates.reserve(3 * n_nodes);
+        for (auto const* node : mesh.getNodes())
+            coordinates.insert(coordinates.end(), node->getCoords(),
+                               node->getCoords() + 3);
+        std::string const file_name = writeData(
+            "geometry", reinterpret_cast<char const*>(coordinates.data()),
+            coordinates.size() * sizeof(double));
+        grid << "        <Geometry GeometryType=\"XYZ\">\n          "
+             << makeDataItem(std::to_string(n_nodes) + " 3",
+                             getXdmfNumberType<double>(), file_name)
+             << "\n        </Geometry>\n";
+    }
+
+    auto const write_data = [this](std::string const& key, char const* data,
+                                   std::size_t const n_bytes) {
+        return writeData(key, data, n_bytes);
+    };
+    auto const& properties = mesh.getProperties();
+    for (auto const& name : properties.getPropertyVectorNames())
+    {
+        if (addAttribute<double>(properties, name, write_data, grid) ||
+            addAttribute<float>(properties, name, write_data, grid) ||
+            addAttribute<int>(properties, name, write_data, grid) ||
+            addAttribute<unsigned>(properties, name, write_data, grid) ||
+            addAttribute<long>(properties, name, write_data, grid) ||
+            addAttribute<unsigned long>(properties, name, write_data, grid) ||
+            addAttribute<char>(properties, name, write_data, grid) ||
+            addAttribute<unsigned char>(properties, name, write_data, grid))
+            continue;
+        WARN("Property vector `%s' has an unsupported type; it is not written.",
+             name.c_str());
+    }
+
+    grid << "      </Grid>\n";
+    _grids.push_back(grid.str());
+
+    writeXdmfFile();
+}
+
+void XdmfTimeSeriesWriter::writeXdmfFile() const
+{
+    std::ofstream os(_file_name);
+    if (!os)
+        OGS_FATAL("Could not open file `%s' for writing.", _file_name.c_str());
+
+    os << "<?xml version=\"1.0\" ?>\n"
+          "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+          "<Xdmf Version=\"2.0\">\n"
+          "  <Domain>\n"
+          "    <Grid Name=\"TimeSeries\" GridType=\"Collection\""
+          " CollectionType=\"Temporal\">\n";
+    for (auto const& grid : _grids)
+        os << grid;
+    os << "    </Grid>\n"
+          "  </Domain>\n"
+          "</Xdmf>\n";
+}
+
+}  // namespace IO
+}  // namespace MeshLib
@@ -0,0 +1,99 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef MESHLIB_IO_XDMFTIMESERIESWRITER_H_
+#define MESHLIB_IO_XDMFTIMESERIESWRITER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+/// Writes a time series of a mesh and its property vectors to an XDMF file
+/// (*.xdmf) with the heavy data stored in raw binary files.
+///
+/// Each data array of a time step, i.e. the node coordinates, the topology
+/// and every property vector, is stored in a separate file
+/// `<prefix>_<array name>_<array index>_<version>.bin` next to the xdmf
+/// file. Arrays which did not change since they were last written, e.g. the
+/// geometry or the material ids, are detected by their size and a 64 bit
+/// hash of their content, and the grid of the new time step references the
+/// already written file. The written files are not read back, i.e. a hash
+/// collision of two arrays of the same size would go unnoticed. In a typical
+/// simulation only the primary and secondary variables are written in every
+/// time step.
+///
+/// The xdmf file itself is rewritten after every time step, like the
+/// PVDFile, so it is always valid even if the simulation is aborted.
+///
+/// Property vectors of types double, float, int, unsigned, long,
+/// unsigned long, char and unsigned char assigned to nodes or cells are
+/// written.
+class XdmfTimeSeriesWriter final
+{
+public:
+    /// \param file_name  the name of the xdmf file; the data files are named
+    ///                   after it without the extension.
+    explicit XdmfTimeSeriesWriter(std::string const& file_name);
+
+    /// Writes all changed data arrays of the mesh and adds the mesh as the
+    /// grid of the time step \c t to the xdmf file.
+    void addTimeStep(Mesh const& mesh, double const t);
+
+    /// Number of data files written so far.
+    std::size_t getNumberOfWrittenDataFiles() const
+    {
+        return _n_written_data_files;
+    }
+
+private:
+    /// The most recently written file of a data array.
+    struct DataFile
+    {
+        std::string file_name;  ///< relative to the xdmf file
+        std::uint64_t hash;
+        std::size_t n_bytes;
+        /// Distinguishes keys which differ only in characters that are
+        /// replaced in the file name.
+        std::size_t key_index;
+        unsigned version;
+    };
+
+    /// Returns the name, relative to the xdmf file, of a file containing the
+    /// given data. The data is only written if it differs from the data
+    /// written last for the same \c key.
+    std::string writeData(std::string const& key, char const* data,
+                          std::size_t const n_bytes);
+
+    void writeXdmfFile() const;
+
+    std::string const _file_name;
+    /// The directory of the xdmf file including the trailing separator.
+    std::string const _directory;
+    /// The base name of the data files.
+    std::string const _data_file_prefix;
+
+    std::map<std::string, DataFile> _data_files;
+    std::size_t _n_written_data_files = 0;
+
+    /// The xml description of the grid of each time step.
+    std::vector<std::string> _grids;
+};
+
+}  // namespace IO
+}  // namespace MeshLib
+
+#endif  // MESHLIB_IO_XDMFTIMESERIESWRITER_H_
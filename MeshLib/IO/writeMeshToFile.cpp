@@ -15,6 +15,7 @@
 
 #include "MeshLib/Mesh.h"
 
+#include "MeshLib/IO/BinaryIO/BinaryMeshIO.h"
 #include "MeshLib/IO/Legacy/MeshIO.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 
@@ -32,6 +33,8 @@ void writeMeshToFile(const MeshLib::Mesh &mesh, const std::string &file_name)
     } else if (BaseLib::hasFileExtension("vtu", file_name)) {
         MeshLib::IO::VtuInterface writer(&mesh);
         writer.writeToFile(file_name);
+    } else if (BaseLib::hasFileExtension("bmsh", file_name)) {
+        MeshLib::IO::writeBinaryMesh(mesh, file_name);
     } else {
         ERR("writeMeshToFile(): Unknown mesh file format in file %s.", file_name.c_str());
     }
@@ -44,8 +44,8 @@ Mesh::Mesh(const std::string &name,
     this->resetElementIDs();
     this->setDimension();
     this->setElementsConnectedToNodes();
-    //this->setNodesConnectedByEdges();
-    this->setNodesConnectedByElements();
+    // The nodes connected by elements are computed on first use, see
+    // Node::getConnectedNodes() and setNodesConnectedByElements().
     this->setElementNeighbors();
 
     this->calcEdgeLengthRange();
@@ -131,11 +131,28 @@ void Mesh::setDimension()
 
 void Mesh::setElementsConnectedToNodes()
 {
-    for (auto e = _elements.begin(); e != _elements.end(); ++e)
+    // Count the elements per node first to allocate the node's element
+    // vectors only once.
+    std::vector<std::size_t> n_connected_elements(_nodes.size(), 0);
+    for (Element const* const e : _elements)
+    {
+        const unsigned nNodes (e->getNumberOfBaseNodes());
+        for (unsigned j=0; j<nNodes; ++j)
+        {
+            assert(e->_nodes[j]->getID() < _nodes.size());
+            ++n_connected_elements[e->_nodes[j]->getID()];
+        }
+    }
+    for (Node* const node : _nodes)
+        if (node)
+            node->_elements.reserve(node->_elements.size() +
+                                    n_connected_elements[node->getID()]);
+
+    for (Element* const e : _elements)
     {
-        const unsigned nNodes ((*e)->getNumberOfBaseNodes());
+        const unsigned nNodes (e->getNumberOfBaseNodes());
         for (unsigned j=0; j<nNodes; ++j)
-            (*e)->_nodes[j]->addElement(*e);
+            e->_nodes[j]->addElement(e);
     }
 }
 
@@ -166,30 +183,37 @@ void Mesh::calcEdgeLengthRange()
 
 void Mesh::setElementNeighbors()
 {
-    std::vector<Element*> neighbors;
-    for (auto it = _elements.begin(); it != _elements.end(); ++it)
+    // Every element only sets its own neighbors, s.t. the elements can be
+    // processed in parallel.
+    std::size_t const n_elements = _elements.size();
+#ifdef _OPENMP
+    #pragma omp parallel
+#endif
     {
-        // create vector with all elements connected to current element (includes lots of doubles!)
-        Element *const element = *it;
-
-        const std::size_t nNodes (element->getNumberOfBaseNodes());
-        for (unsigned n(0); n<nNodes; ++n)
+        std::vector<Element*> neighbors;
+#ifdef _OPENMP
+        #pragma omp for schedule(static)
+        for (OPENMP_LOOP_TYPE i = 0; i < n_elements; ++i)
+#else
+        for (std::size_t i = 0; i < n_elements; ++i)
+#endif
         {
-            std::vector<Element*> const& conn_elems ((element->getNode(n)->getElements()));
-            neighbors.insert(neighbors.end(), conn_elems.begin(), conn_elems.end());
-        }
-        std::sort(neighbors.begin(), neighbors.end());
-        auto const neighbors_new_end = std::unique(neighbors.begin(), neighbors.end());
+            // create vector with all elements connected to current element (includes lots of doubles!)
+            Element *const element = _elements[i];
 
-        for (auto neighbor = neighbors.begin(); neighbor != neighbors_new_end; ++neighbor)
-        {
-            boost::optional<unsigned> const opposite_face_id = element->addNeighbor(*neighbor);
-            if (opposite_face_id)
+            const std::size_t nNodes (element->getNumberOfBaseNodes());
+            for (unsigned n(0); n<nNodes; ++n)
             {
-                (*neighbor)->setNeighbor(element, *opposite_face_id);
+                std::vector<Element*> const& conn_elems ((element->getNode(n)->getElements()));
+                neighbors.insert(neighbors.end(), conn_elems.begin(), conn_elems.end());
             }
+            std::sort(neighbors.begin(), neighbors.end());
+            auto const neighbors_new_end = std::unique(neighbors.begin(), neighbors.end());
+
+            for (auto neighbor = neighbors.begin(); neighbor != neighbors_new_end; ++neighbor)
+                element->addNeighbor(*neighbor);
+            neighbors.clear();
         }
-        neighbors.clear();
     }
 }
 
@@ -222,34 +246,17 @@ void Mesh::setNodesConnectedByEdges()
     }
 }
 
-void Mesh::setNodesConnectedByElements()
+void Mesh::setNodesConnectedByElements() const
 {
-    // Allocate temporary space for adjacent nodes.
-    std::vector<Node*> adjacent_nodes;
-    for (Node* const node : _nodes)
+    std::size_t const n_nodes = _nodes.size();
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for (OPENMP_LOOP_TYPE i = 0; i < n_nodes; ++i)
+#else
+    for (std::size_t i = 0; i < n_nodes; ++i)
+#endif
     {
-        adjacent_nodes.clear();
-
-        // Get all elements, to which this node is connected.
-        std::vector<Element*> const& conn_elems = node->getElements();
-
-        // And collect all elements' nodes.
-        for (Element const* const element : conn_elems)
-        {
-            Node* const* const single_elem_nodes = element->getNodes();
-            std::size_t const nnodes = element->getNumberOfBaseNodes();
-            for (std::size_t n = 0; n < nnodes; n++)
-                adjacent_nodes.push_back(single_elem_nodes[n]);
-        }
-
-        // Make nodes unique and sorted by their ids.
-        // This relies on the node's id being equivalent to it's address.
-        std::sort(adjacent_nodes.begin(), adjacent_nodes.end(),
-            [](Node* a, Node* b) { return a->getID() < b->getID(); });
-        auto const last = std::unique(adjacent_nodes.begin(), adjacent_nodes.end());
-        adjacent_nodes.erase(last, adjacent_nodes.end());
-
-        node->setConnectedNodes(adjacent_nodes);
+        _nodes[i]->computeConnectedNodes();
     }
 }
 
@@ -258,7 +265,7 @@ void scaleMeshPropertyVector(MeshLib::Mesh & mesh,
                              double factor)
 {
     boost::optional<MeshLib::PropertyVector<double> &> pv(
-        mesh.getProperties().getPropertyVector<double>(property_name));
+        mesh.getProperties().getMutablePropertyVector<double>(property_name));
 
     for (auto & v : *pv)
         v *= factor;
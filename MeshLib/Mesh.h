@@ -124,6 +124,14 @@ public:
     MeshLib::Properties & getProperties() { return _properties; }
     MeshLib::Properties const& getProperties() const { return _properties; }
 
+    /// Computes the element-connectivity of all nodes in parallel. Two nodes
+    /// i and j are connected if they are shared by an element.
+    /// Otherwise the connectivity is computed on the first call of
+    /// Node::getConnectedNodes() for each node separately; calling this
+    /// method is required before the connected nodes are accessed from
+    /// multiple threads.
+    void setNodesConnectedByElements() const;
+
 protected:
     /// Set the minimum and maximum length over the edges of the mesh.
     void calcEdgeLengthRange();
@@ -147,10 +155,6 @@ protected:
 
     void setNodesConnectedByEdges();
 
-    /// Computes the element-connectivity of nodes. Two nodes i and j are
-    /// connected if they are shared by an element.
-    void setNodesConnectedByElements();
-
     std::size_t const _id;
     unsigned _mesh_dimension;
     /// The minimal and maximal edge length over all elements in the mesh
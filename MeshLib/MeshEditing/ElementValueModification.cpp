@@ -28,7 +28,7 @@ bool ElementValueModification::replace(MeshLib::Mesh &mesh,
     bool replace_if_exists)
 {
     boost::optional<MeshLib::PropertyVector<int> &> optional_property_value_vec(
-        mesh.getProperties().getPropertyVector<int>(property_name)
+        mesh.getProperties().getMutablePropertyVector<int>(property_name)
     );
 
     if (!optional_property_value_vec) {
@@ -69,7 +69,7 @@ std::size_t ElementValueModification::condense(MeshLib::Mesh &mesh)
 {
     boost::optional<MeshLib::PropertyVector<int> &>
         optional_property_value_vec(
-            mesh.getProperties().getPropertyVector<int>("MaterialIDs")
+            mesh.getProperties().getMutablePropertyVector<int>("MaterialIDs")
         );
 
     if (!optional_property_value_vec) {
@@ -99,7 +99,7 @@ std::size_t ElementValueModification::setByElementType(MeshLib::Mesh &mesh, Mesh
 {
     boost::optional<MeshLib::PropertyVector<int> &>
         optional_property_value_vec(
-            mesh.getProperties().getPropertyVector<int>("MaterialIDs")
+            mesh.getProperties().getMutablePropertyVector<int>("MaterialIDs")
         );
 
     if (!optional_property_value_vec) {
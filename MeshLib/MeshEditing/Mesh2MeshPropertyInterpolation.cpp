@@ -12,6 +12,7 @@
  *
  */
 
+#include <algorithm>
 #include <vector>
 #include <fstream>
 #include <boost/optional.hpp>
@@ -20,6 +21,8 @@
 
 #include <logog/include/logog.hpp>
 
+#include "BaseLib/Error.h"
+
 #include "GeoLib/AABB.h"
 #include "GeoLib/Grid.h"
 
@@ -32,10 +35,17 @@ namespace MeshLib {
 
 Mesh2MeshPropertyInterpolation::Mesh2MeshPropertyInterpolation(
     Mesh const& src_mesh, std::string const& property_name)
-    : _src_mesh(src_mesh), _property_name(property_name)
+    : Mesh2MeshPropertyInterpolation(src_mesh,
+                                     std::vector<std::string>{property_name})
 {}
 
-bool Mesh2MeshPropertyInterpolation::setPropertiesForMesh(Mesh& dest_mesh) const
+Mesh2MeshPropertyInterpolation::Mesh2MeshPropertyInterpolation(
+    Mesh const& src_mesh, std::vector<std::string> property_names)
+    : _src_mesh(src_mesh), _property_names(std::move(property_names))
+{}
+
+bool Mesh2MeshPropertyInterpolation::checkDimensions(
+    Mesh const& dest_mesh) const
 {
     if (_src_mesh.getDimension() != dest_mesh.getDimension()) {
         ERR("MeshLib::Mesh2MeshPropertyInterpolation::setPropertiesForMesh() "
@@ -51,39 +61,132 @@ bool Mesh2MeshPropertyInterpolation::setPropertiesForMesh(Mesh& dest_mesh) const
             "implemented only for 2D case at the moment.");
         return false;
     }
+    return true;
+}
 
-    boost::optional<MeshLib::PropertyVector<double> &> opt_pv(
-        dest_mesh.getProperties().getPropertyVector<double>(_property_name));
-    if (!opt_pv) {
-        INFO("Create new PropertyVector \"%s\" of type double.",
-             _property_name.c_str());
-        opt_pv = dest_mesh.getProperties().createNewPropertyVector<double>(
-            _property_name, MeshItemType::Cell, 1);
-        if (!opt_pv) {
-            WARN("Could not get or create a PropertyVector of type double"
-                " using the given name \"%s\".", _property_name.c_str());
+bool Mesh2MeshPropertyInterpolation::setPropertiesForMesh(Mesh& dest_mesh) const
+{
+    if (!checkDimensions(dest_mesh))
+        return false;
+
+    // fetch the source of property values
+    std::vector<MeshLib::PropertyVector<double> const*> src_properties;
+    for (auto const& property_name : _property_names)
+    {
+        boost::optional<MeshLib::PropertyVector<double> const&> opt_src_props(
+            _src_mesh.getProperties().getPropertyVector<double>(property_name));
+        if (!opt_src_props)
+        {
+            WARN("Did not find PropertyVector<double> \"%s\".",
+                 property_name.c_str());
             return false;
         }
+        if (opt_src_props->size() != _src_mesh.getNumberOfElements())
+        {
+            WARN("PropertyVector<double> \"%s\" does not contain one value "
+                 "per element.", property_name.c_str());
+            return false;
+        }
+        src_properties.push_back(&opt_src_props.get());
+    }
+
+    std::vector<MeshLib::PropertyVector<double>*> dest_properties;
+    for (auto const& property_name : _property_names)
+    {
+        boost::optional<MeshLib::PropertyVector<double> &> opt_pv(
+            dest_mesh.getProperties().getMutablePropertyVector<double>(property_name));
+        if (!opt_pv) {
+            INFO("Create new PropertyVector \"%s\" of type double.",
+                 property_name.c_str());
+            opt_pv = dest_mesh.getProperties().createNewPropertyVector<double>(
+                property_name, MeshItemType::Cell, 1);
+            if (!opt_pv) {
+                WARN("Could not get or create a PropertyVector of type double"
+                    " using the given name \"%s\".", property_name.c_str());
+                return false;
+            }
+        }
+        MeshLib::PropertyVector<double> & dest_pv(opt_pv.get());
+        if (dest_pv.size() != dest_mesh.getNumberOfElements())
+            dest_pv.resize(dest_mesh.getNumberOfElements());
+        dest_properties.push_back(&dest_pv);
+    }
+
+    Weights const& weights(getWeights(dest_mesh));
+    std::size_t const n_properties(_property_names.size());
+    std::size_t const n_dest_elements(dest_mesh.getNumberOfElements());
+    // all properties are interpolated in one pass over the weights
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_dest_elements; ++k)
+#else
+    for (std::size_t k = 0; k < n_dest_elements; ++k)
+#endif
+    {
+        std::size_t const begin(weights.row_begin[k]);
+        std::size_t const end(weights.row_begin[k + 1]);
+        if (begin == end)
+            continue;
+        for (std::size_t p = 0; p < n_properties; ++p)
+        {
+            MeshLib::PropertyVector<double> const& src(*src_properties[p]);
+            double value(0.0);
+            for (std::size_t j = begin; j < end; ++j)
+                value += weights.values[j] * src[weights.source_elements[j]];
+            (*dest_properties[p])[k] = value;
+        }
     }
-    MeshLib::PropertyVector<double> & dest_properties(opt_pv.get());
-    if (dest_properties.size() != dest_mesh.getNumberOfElements())
-        dest_properties.resize(dest_mesh.getNumberOfElements());
 
-    interpolatePropertiesForMesh(dest_mesh, dest_properties);
+    return true;
+}
 
+bool Mesh2MeshPropertyInterpolation::interpolateElementValues(
+    Mesh const& dest_mesh, std::vector<double> const& source_values,
+    std::vector<double>& dest_values) const
+{
+    if (!checkDimensions(dest_mesh))
+        return false;
+    if (source_values.size() != _src_mesh.getNumberOfElements())
+    {
+        ERR("Mesh2MeshPropertyInterpolation::interpolateElementValues(): "
+            "expected %d source values, got %d.",
+            _src_mesh.getNumberOfElements(), source_values.size());
+        return false;
+    }
+
+    Weights const& weights(getWeights(dest_mesh));
+    std::size_t const n_dest_elements(dest_mesh.getNumberOfElements());
+    if (dest_values.size() != n_dest_elements)
+        dest_values.resize(n_dest_elements);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_dest_elements; ++k)
+#else
+    for (std::size_t k = 0; k < n_dest_elements; ++k)
+#endif
+    {
+        std::size_t const begin(weights.row_begin[k]);
+        std::size_t const end(weights.row_begin[k + 1]);
+        if (begin == end)
+            continue;
+        double value(0.0);
+        for (std::size_t j = begin; j < end; ++j)
+            value += weights.values[j] * source_values[weights.source_elements[j]];
+        dest_values[k] = value;
+    }
     return true;
 }
 
-void Mesh2MeshPropertyInterpolation::interpolatePropertiesForMesh(
-    Mesh& dest_mesh, MeshLib::PropertyVector<double>& dest_properties) const
+Mesh2MeshPropertyInterpolation::Weights const&
+Mesh2MeshPropertyInterpolation::getWeights(Mesh const& dest_mesh) const
 {
-    std::vector<double> interpolated_src_node_properties(
-        _src_mesh.getNumberOfNodes());
-    interpolateElementPropertiesToNodeProperties(
-        interpolated_src_node_properties);
+    if (_weights.dest_mesh_id == dest_mesh.getID() &&
+        _weights.n_dest_elements == dest_mesh.getNumberOfElements())
+        return _weights;
 
     // idea: looping over the destination elements and calculate properties
-    // from interpolated_src_node_properties to accelerate the (source) point
+    // from the source node values, which are the averages of the values of
+    // the adjacent source elements; to accelerate the (source) point
     // search construct a grid
     std::vector<MeshLib::Node*> const& src_nodes(_src_mesh.getNodes());
     GeoLib::Grid<MeshLib::Node> src_grid(src_nodes.begin(), src_nodes.end(),
@@ -91,9 +194,17 @@ void Mesh2MeshPropertyInterpolation::interpolatePropertiesForMesh(
 
     auto const& dest_elements(dest_mesh.getElements());
     const std::size_t n_dest_elements(dest_elements.size());
-    for (std::size_t k(0); k < n_dest_elements; k++)
+    std::vector<std::vector<std::pair<std::size_t, double>>> rows(
+        n_dest_elements);
+    std::vector<char> found_source_nodes(n_dest_elements, 1);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_dest_elements; ++k)
+#else
+    for (std::size_t k = 0; k < n_dest_elements; ++k)
+#endif
     {
-        MeshLib::Element& dest_element(*dest_elements[k]);
+        MeshLib::Element const& dest_element(*dest_elements[k]);
         if (dest_element.getGeomType() == MeshElemType::LINE)
             continue;
 
@@ -107,58 +218,71 @@ void Mesh2MeshPropertyInterpolation::interpolatePropertiesForMesh(
         src_grid.getPntVecsOfGridCellsIntersectingCuboid(
             elem_aabb.getMinPoint(), elem_aabb.getMaxPoint(), nodes);
 
-        std::size_t cnt(0);
-        double average_value(0.0);
-
+        std::vector<MeshLib::Node const*> nodes_in_element;
         for (auto const* nodes_vec : nodes)
         {
             for (auto const* node : *nodes_vec)
             {
-                if (elem_aabb.containsPointXY(*node) &&
+                if (node->getNumberOfElements() > 0 &&
+                    elem_aabb.containsPointXY(*node) &&
                     MeshLib::isPointInElementXY(*node, dest_element))
                 {
-                    average_value +=
-                        interpolated_src_node_properties[node->getID()];
-                    cnt++;
+                    nodes_in_element.push_back(node);
                 }
             }
         }
 
-        if (cnt == 0)
-            OGS_FATAL(
-                "Mesh2MeshInterpolation: Could not find values in source mesh "
-                "for the element %d.",
-                k);
-        dest_properties[k] = average_value / cnt;
-    }
-}
+        if (nodes_in_element.empty())
+        {
+            found_source_nodes[k] = 0;
+            continue;
+        }
 
-void Mesh2MeshPropertyInterpolation::interpolateElementPropertiesToNodeProperties(
-    std::vector<double> &interpolated_properties) const
-{
-    // fetch the source of property values
-    boost::optional<MeshLib::PropertyVector<double> const&> opt_src_props(
-        _src_mesh.getProperties().getPropertyVector<double>(_property_name));
-    if (!opt_src_props)
-    {
-        WARN("Did not find PropertyVector<double> \"%s\".",
-             _property_name.c_str());
-        return;
+        auto& row(rows[k]);
+        for (auto const* node : nodes_in_element)
+        {
+            std::size_t const n_con_elems(node->getNumberOfElements());
+            double const w(1.0 / (nodes_in_element.size() * n_con_elems));
+            for (std::size_t j(0); j < n_con_elems; j++)
+                row.emplace_back(node->getElement(j)->getID(), w);
+        }
+        // merge the weights of source elements adjacent to several nodes
+        std::sort(row.begin(), row.end());
+        std::size_t n_entries(0);
+        for (std::size_t j(0); j < row.size(); ++j)
+        {
+            if (n_entries > 0 && row[n_entries - 1].first == row[j].first)
+                row[n_entries - 1].second += row[j].second;
+            else
+                row[n_entries++] = row[j];
+        }
+        row.resize(n_entries);
     }
 
-    MeshLib::PropertyVector<double> const& elem_props(opt_src_props.get());
-    std::vector<MeshLib::Node*> const& src_nodes(_src_mesh.getNodes());
-    const std::size_t n_src_nodes(src_nodes.size());
-    for (std::size_t k(0); k < n_src_nodes; k++)
-    {
-        const std::size_t n_con_elems(src_nodes[k]->getNumberOfElements());
-        interpolated_properties[k] = elem_props[(src_nodes[k]->getElement(0))->getID()];
-        for (std::size_t j(1); j < n_con_elems; j++)
+    auto const not_found = std::find(found_source_nodes.begin(),
+                                     found_source_nodes.end(), 0);
+    if (not_found != found_source_nodes.end())
+        OGS_FATAL(
+            "Mesh2MeshInterpolation: Could not find values in source mesh "
+            "for the element %d.",
+            std::distance(found_source_nodes.begin(), not_found));
+
+    Weights weights;
+    weights.dest_mesh_id = dest_mesh.getID();
+    weights.n_dest_elements = n_dest_elements;
+    weights.row_begin.resize(n_dest_elements + 1, 0);
+    for (std::size_t k(0); k < n_dest_elements; ++k)
+        weights.row_begin[k + 1] = weights.row_begin[k] + rows[k].size();
+    weights.source_elements.reserve(weights.row_begin.back());
+    weights.values.reserve(weights.row_begin.back());
+    for (auto const& row : rows)
+        for (auto const& entry : row)
         {
-            interpolated_properties[k] += elem_props[(src_nodes[k]->getElement(j))->getID()];
+            weights.source_elements.push_back(entry.first);
+            weights.values.push_back(entry.second);
         }
-        interpolated_properties[k] /= n_con_elems;
-    }
+    _weights = std::move(weights);
+    return _weights;
 }
 
 } // end namespace MeshLib
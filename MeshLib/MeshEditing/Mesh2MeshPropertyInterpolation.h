@@ -15,6 +15,10 @@
 #ifndef MESH2MESHPROPERTYINTERPOLATION_H_
 #define MESH2MESHPROPERTYINTERPOLATION_H_
 
+#include <limits>
+#include <string>
+#include <vector>
+
 #include "MeshLib/PropertyVector.h"
 
 namespace MeshLib {
@@ -26,6 +30,19 @@ class Mesh;
  * mesh elements of a (source) mesh to mesh elements of another
  * (destination) mesh deploying weighted interpolation. The two
  * meshes must have the same dimension.
+ *
+ * The element values are averaged to the source nodes and the value of a
+ * destination element is the mean of the values of the source nodes located
+ * in the element. Since the transfer is linear, it is stored as a sparse
+ * weight matrix when the properties are set for a destination mesh the
+ * first time. Further transfers to the same destination mesh, e.g. of other
+ * properties or of values of later time steps, only apply the cached
+ * weights. The weights assume that the geometry of both meshes is not
+ * changed while the object lives.
+ *
+ * The class is not reentrant: the const member functions compute and
+ * replace the cached weights, hence an object must not be used by several
+ * threads concurrently. Use one object per thread instead.
  */
 class Mesh2MeshPropertyInterpolation final
 {
@@ -41,7 +58,18 @@ public:
                                    std::string const& property_name);
 
     /**
-     * Calculates entries for the property vector and sets appropriate indices
+     * Constructor taking the source mesh and several properties, which are
+     * interpolated in one pass.
+     * @param source_mesh the mesh the given property information is
+     * assigned to.
+     * @param property_names names of PropertyVectors of type double in the
+     * \c source_mesh
+     */
+    Mesh2MeshPropertyInterpolation(Mesh const& source_mesh,
+                                   std::vector<std::string> property_names);
+
+    /**
+     * Calculates entries for the property vectors and sets appropriate indices
      * in the mesh elements.
      * @param mesh the mesh the property information will be calculated and set
      * via weighted interpolation
@@ -49,24 +77,45 @@ public:
      */
     bool setPropertiesForMesh(Mesh& mesh) const;
 
-private:
     /**
-     * @param dest_mesh
-     * @param dest_properties
+     * Interpolates arbitrary element values of the source mesh to the
+     * elements of the destination mesh using the cached weights.
+     * @param dest_mesh the destination mesh
+     * @param source_values one value per element of the source mesh
+     * @param dest_values one value per element of the destination mesh; the
+     * values of line elements are not changed
+     * @return true if the operation was successful, false on error
      */
-    void interpolatePropertiesForMesh(
-        Mesh& dest_mesh,
-        MeshLib::PropertyVector<double>& dest_properties) const;
+    bool interpolateElementValues(Mesh const& dest_mesh,
+                                  std::vector<double> const& source_values,
+                                  std::vector<double>& dest_values) const;
 
-    /**
-     * Method interpolates the element wise given properties to the nodes of the element
-     * @param interpolated_node_properties the vector must have the same number of entries as
-     * the source mesh has number of nodes, the content of the particular entries will be overwritten
-     */
-    void interpolateElementPropertiesToNodeProperties(std::vector<double> &interpolated_node_properties) const;
+private:
+    /// Sparse matrix in compressed row format mapping the element values of
+    /// the source mesh to the element values of the destination mesh. Empty
+    /// rows belong to destination elements that are not interpolated.
+    struct Weights
+    {
+        std::size_t dest_mesh_id = std::numeric_limits<std::size_t>::max();
+        std::size_t n_dest_elements = 0;
+        std::vector<std::size_t> row_begin;
+        std::vector<std::size_t> source_elements;
+        std::vector<double> values;
+    };
+
+    /// Checks if the interpolation is implemented for the meshes.
+    bool checkDimensions(Mesh const& dest_mesh) const;
+
+    /// Returns the interpolation weights for the given destination mesh;
+    /// the weights are computed on the first call for a mesh. The returned
+    /// reference is invalidated by a call for another destination mesh.
+    Weights const& getWeights(Mesh const& dest_mesh) const;
 
     Mesh const& _src_mesh;
-    std::string const& _property_name;
+    std::vector<std::string> const _property_names;
+    /// Cache of the weights of the last destination mesh, not guarded
+    /// against concurrent access.
+    mutable Weights _weights;
 };
 
 } // end namespace MeshLib
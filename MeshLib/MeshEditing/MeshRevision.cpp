@@ -14,15 +14,13 @@
 
 #include "MeshRevision.h"
 
-#include <numeric>
-
 #include <logog/include/logog.hpp>
 
-#include "GeoLib/Grid.h"
 #include "MathLib/GeometricBasics.h"
 
 #include "MeshLib/Elements/Elements.h"
 #include "MeshLib/Mesh.h"
+#include "MeshLib/MeshSearch/CoincidentNodes.h"
 
 #include "DuplicateMeshComponents.h"
 
@@ -184,47 +182,7 @@ MeshLib::Mesh* MeshRevision::subdivideMesh(const std::string &new_mesh_name) con
 
 std::vector<std::size_t> MeshRevision::collapseNodeIndices(double eps) const
 {
-    const std::vector<MeshLib::Node*> &nodes(_mesh.getNodes());
-    const std::size_t nNodes(_mesh.getNumberOfNodes());
-    std::vector<std::size_t> id_map(nNodes);
-    const double half_eps(eps / 2.0);
-    const double sqr_eps(eps*eps);
-    std::iota(id_map.begin(), id_map.end(), 0);
-
-    GeoLib::Grid<MeshLib::Node> const grid(nodes.begin(), nodes.end(), 64);
-
-    for (std::size_t k = 0; k < nNodes; ++k)
-    {
-        MeshLib::Node const*const node(nodes[k]);
-        if (node->getID() != k)
-            continue;
-        std::vector<std::vector<MeshLib::Node*> const*> node_vectors(
-            grid.getPntVecsOfGridCellsIntersectingCube(*node, half_eps));
-
-        const std::size_t nVectors(node_vectors.size());
-        for (std::size_t i = 0; i < nVectors; ++i)
-        {
-            const std::vector<MeshLib::Node*> &cell_vector(*node_vectors[i]);
-            const std::size_t nGridCellNodes(cell_vector.size());
-            for (std::size_t j = 0; j < nGridCellNodes; ++j)
-            {
-                MeshLib::Node const*const test_node(cell_vector[j]);
-                // are node indices already identical (i.e. nodes will be collapsed)
-                if (id_map[node->getID()] == id_map[test_node->getID()])
-                    continue;
-
-                // if test_node has already been collapsed to another node x, ignore it
-                // (if the current node would need to be collapsed with x it would already have happened when x was tested)
-                if (test_node->getID() != id_map[test_node->getID()])
-                    continue;
-
-                // calc distance
-                if (MathLib::sqrDist(node->getCoords(), test_node->getCoords()) < sqr_eps)
-                    id_map[test_node->getID()] = node->getID();
-            }
-        }
-    }
-    return id_map;
+    return MeshLib::findCoincidentNodes(_mesh.getNodes(), eps);
 }
 
 std::vector<MeshLib::Node*> MeshRevision::constructNewNodesArray(const std::vector<std::size_t> &id_map) const
@@ -55,7 +55,8 @@ public:
     /// Returns the number of potentially collapsable nodes
     unsigned getNumberOfCollapsableNodes(double eps = std::numeric_limits<double>::epsilon()) const;
 
-    /// Designates nodes to be collapsed by setting their ID to the index of the node they will get merged with.
+    /// Designates nodes to be collapsed by mapping their index to the index of the node they will get merged with.
+    /// Nodes are merged transitively, each node is mapped to the smallest index of its group (see findCoincidentNodes()).
     std::vector<std::size_t> collapseNodeIndices(double eps) const;
 
     /**
@@ -0,0 +1,374 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ReorderMesh.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
+#include <logog/include/logog.hpp>
+
+#include "MeshLib/CompactMesh.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+std::size_t const unvisited = std::numeric_limits<std::size_t>::max();
+
+/// Adjacency of the mesh nodes in compressed row storage.
+struct NodeAdjacency
+{
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> neighbors;
+
+    std::size_t degree(std::size_t const i) const
+    {
+        return offsets[i + 1] - offsets[i];
+    }
+};
+
+/// Two nodes are adjacent if they belong to a common element. All element
+/// nodes are taken into account, because Node::getElements() lists the
+/// elements of the base nodes only.
+NodeAdjacency computeNodeAdjacency(MeshLib::Mesh const& mesh)
+{
+    std::size_t const n_nodes = mesh.getNumberOfNodes();
+    MeshLib::NodeElementTable const node_elements(
+        MeshLib::createNodeElementTable(mesh, true));
+    std::vector<MeshLib::Element*> const& elements = mesh.getElements();
+
+    NodeAdjacency adjacency;
+    adjacency.offsets.reserve(n_nodes + 1);
+    adjacency.offsets.push_back(0);
+
+    std::vector<std::size_t> node_neighbors;
+    for (std::size_t node_id = 0; node_id < n_nodes; ++node_id)
+    {
+        node_neighbors.clear();
+        for (std::size_t const e : node_elements.getElements(node_id))
+            for (unsigned i = 0; i < elements[e]->getNumberOfNodes(); ++i)
+                if (elements[e]->getNodeIndex(i) != node_id)
+                    node_neighbors.push_back(elements[e]->getNodeIndex(i));
+        std::sort(node_neighbors.begin(), node_neighbors.end());
+        node_neighbors.erase(
+            std::unique(node_neighbors.begin(), node_neighbors.end()),
+            node_neighbors.end());
+
+        adjacency.neighbors.insert(adjacency.neighbors.end(),
+                                   node_neighbors.begin(),
+                                   node_neighbors.end());
+        adjacency.offsets.push_back(adjacency.neighbors.size());
+    }
+    return adjacency;
+}
+
+/// Visits the unvisited nodes reachable from \c start breadth first, where
+/// the neighbours of a node are visited in the order of increasing degree.
+/// The level of each visited node is stored in \c level.
+/// \return the visited nodes in the order of the traversal
+std::vector<std::size_t> traverseBreadthFirst(std::size_t const start,
+                                              NodeAdjacency const& adjacency,
+                                              std::vector<std::size_t>& level)
+{
+    std::vector<std::size_t> visited(1, start);
+    level[start] = 0;
+
+    std::vector<std::size_t> next;
+    for (std::size_t k = 0; k < visited.size(); ++k)
+    {
+        std::size_t const i = visited[k];
+        next.clear();
+        for (std::size_t n = adjacency.offsets[i]; n < adjacency.offsets[i + 1];
+             ++n)
+        {
+            std::size_t const j = adjacency.neighbors[n];
+            if (level[j] != unvisited)
+                continue;
+            level[j] = level[i] + 1;
+            next.push_back(j);
+        }
+        std::sort(next.begin(), next.end(),
+                  [&adjacency](std::size_t a, std::size_t b)
+                  {
+                      return adjacency.degree(a) < adjacency.degree(b) ||
+                             (adjacency.degree(a) == adjacency.degree(b) &&
+                              a < b);
+                  });
+        visited.insert(visited.end(), next.begin(), next.end());
+    }
+    return visited;
+}
+
+/// Finds a node of (almost) maximal eccentricity in the connected component
+/// of \c start following George and Liu, i.e. the level structure rooted at
+/// a node of minimal degree in the last level is computed until the depth
+/// does not increase any more.
+std::size_t findPseudoPeripheralNode(std::size_t const start,
+                                     NodeAdjacency const& adjacency,
+                                     std::vector<std::size_t>& level)
+{
+    std::size_t node = start;
+    std::size_t eccentricity = 0;
+    while (true)
+    {
+        std::vector<std::size_t> const visited(
+            traverseBreadthFirst(node, adjacency, level));
+        std::size_t const depth = level[visited.back()];
+
+        std::size_t candidate = visited.back();
+        for (auto it = visited.rbegin();
+             it != visited.rend() && level[*it] == depth; ++it)
+            if (adjacency.degree(*it) < adjacency.degree(candidate) ||
+                (adjacency.degree(*it) == adjacency.degree(candidate) &&
+                 *it < candidate))
+                candidate = *it;
+
+        for (std::size_t const i : visited)
+            level[i] = unvisited;
+
+        if (depth <= eccentricity)
+            return node;
+        eccentricity = depth;
+        node = candidate;
+    }
+}
+
+/// Computes the index of a point on the Hilbert curve of order \c bits from
+/// its integer coordinates. J. Skilling, Programming the Hilbert curve, AIP
+/// Conf. Proc. 707, 2004.
+std::uint64_t computeHilbertIndex(std::array<std::uint32_t, 3> x,
+                                  unsigned const bits)
+{
+    std::uint32_t const m = std::uint32_t(1) << (bits - 1);
+
+    // inverse undo excess work
+    for (std::uint32_t q = m; q > 1; q >>= 1)
+    {
+        std::uint32_t const p = q - 1;
+        for (unsigned i = 0; i < 3; ++i)
+        {
+            if (x[i] & q)
+                x[0] ^= p;
+            else
+            {
+                std::uint32_t const t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+
+    // Gray encode
+    for (unsigned i = 1; i < 3; ++i)
+        x[i] ^= x[i - 1];
+    std::uint32_t t = 0;
+    for (std::uint32_t q = m; q > 1; q >>= 1)
+        if (x[2] & q)
+            t ^= q - 1;
+    for (unsigned i = 0; i < 3; ++i)
+        x[i] ^= t;
+
+    // interleave the bits of the transposed index
+    std::uint64_t index = 0;
+    for (unsigned b = bits; b-- > 0;)
+        for (unsigned i = 0; i < 3; ++i)
+            index = (index << 1) | ((x[i] >> b) & 1);
+    return index;
+}
+
+}  // anonymous namespace
+
+namespace MeshLib
+{
+std::vector<std::size_t> computeReverseCuthillMcKeeOrder(
+    MeshLib::Mesh const& mesh)
+{
+    std::size_t const n_nodes = mesh.getNumberOfNodes();
+    NodeAdjacency const adjacency(computeNodeAdjacency(mesh));
+
+    // each connected component is started from the node of smallest degree
+    std::vector<std::size_t> start_nodes(n_nodes);
+    std::iota(start_nodes.begin(), start_nodes.end(), 0);
+    std::stable_sort(start_nodes.begin(), start_nodes.end(),
+                     [&adjacency](std::size_t a, std::size_t b)
+                     {
+                         return adjacency.degree(a) < adjacency.degree(b);
+                     });
+
+    std::vector<std::size_t> level(n_nodes, unvisited);
+    std::vector<std::size_t> order;
+    order.reserve(n_nodes);
+    for (std::size_t const start : start_nodes)
+    {
+        if (level[start] != unvisited)
+            continue;
+        std::vector<std::size_t> const component(traverseBreadthFirst(
+            findPseudoPeripheralNode(start, adjacency, level), adjacency,
+            level));
+        order.insert(order.end(), component.begin(), component.end());
+    }
+
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+std::vector<std::size_t> computeHilbertCurveOrder(
+    std::vector<MeshLib::Node*> const& nodes)
+{
+    std::size_t const n_nodes = nodes.size();
+    std::vector<std::size_t> order(n_nodes);
+    std::iota(order.begin(), order.end(), 0);
+    if (n_nodes < 2)
+        return order;
+
+    std::array<double, 3> min_pnt = {{(*nodes[0])[0], (*nodes[0])[1],
+                                      (*nodes[0])[2]}};
+    std::array<double, 3> max_pnt(min_pnt);
+    for (auto const* node : nodes)
+        for (unsigned d = 0; d < 3; ++d)
+        {
+            min_pnt[d] = std::min(min_pnt[d], (*node)[d]);
+            max_pnt[d] = std::max(max_pnt[d], (*node)[d]);
+        }
+    double max_extent = 0;
+    for (unsigned d = 0; d < 3; ++d)
+        max_extent = std::max(max_extent, max_pnt[d] - min_pnt[d]);
+    if (!(max_extent > 0))
+        return order;
+
+    // 21 bits per dimension fit into a 64 bit curve index
+    unsigned const bits = 21;
+    std::uint32_t const max_coordinate = (std::uint32_t(1) << bits) - 1;
+    double const scale = max_coordinate / max_extent;
+
+    std::vector<std::uint64_t> keys(n_nodes);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_nodes; ++k)
+#else
+    for (std::size_t k = 0; k < n_nodes; ++k)
+#endif
+    {
+        std::array<std::uint32_t, 3> x;
+        for (unsigned d = 0; d < 3; ++d)
+            x[d] = std::min(max_coordinate,
+                            static_cast<std::uint32_t>(
+                                ((*nodes[k])[d] - min_pnt[d]) * scale));
+        keys[k] = computeHilbertIndex(x, bits);
+    }
+
+    std::sort(order.begin(), order.end(),
+              [&keys](std::size_t a, std::size_t b)
+              {
+                  return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+              });
+    return order;
+}
+
+MeshLib::Mesh* reorderMesh(MeshLib::Mesh const& mesh,
+                           std::vector<std::size_t> const& node_order,
+                           std::string const& new_mesh_name)
+{
+    std::size_t const n_nodes = mesh.getNumberOfNodes();
+    std::vector<std::size_t> new_node_ids(n_nodes, unvisited);
+    if (node_order.size() != n_nodes)
+    {
+        ERR("reorderMesh: The node order has %d entries, but the mesh has "
+            "%d nodes.", node_order.size(), n_nodes);
+        return nullptr;
+    }
+    for (std::size_t const id : node_order)
+    {
+        if (id >= n_nodes || new_node_ids[id] != unvisited)
+        {
+            ERR("reorderMesh: The node order is not a permutation of the "
+                "node ids.");
+            return nullptr;
+        }
+        new_node_ids[id] = 0;
+    }
+
+    std::vector<std::size_t> new_to_old_node_ids(node_order);
+    std::stable_partition(new_to_old_node_ids.begin(),
+                          new_to_old_node_ids.end(),
+                          [&mesh](std::size_t id)
+                          {
+                              return mesh.isBaseNode(id);
+                          });
+    for (std::size_t i = 0; i < n_nodes; ++i)
+        new_node_ids[new_to_old_node_ids[i]] = i;
+
+    // sort the elements by the smallest new id of their nodes
+    std::size_t const n_elements = mesh.getNumberOfElements();
+    std::vector<std::size_t> element_keys(n_elements, unvisited);
+    for (std::size_t e = 0; e < n_elements; ++e)
+    {
+        MeshLib::Element const& element(*mesh.getElement(e));
+        for (unsigned i = 0; i < element.getNumberOfNodes(); ++i)
+            element_keys[e] = std::min(element_keys[e],
+                                       new_node_ids[element.getNodeIndex(i)]);
+    }
+    std::vector<std::size_t> new_to_old_element_ids(n_elements);
+    std::iota(new_to_old_element_ids.begin(), new_to_old_element_ids.end(),
+              0);
+    std::stable_sort(new_to_old_element_ids.begin(),
+                     new_to_old_element_ids.end(),
+                     [&element_keys](std::size_t a, std::size_t b)
+                     {
+                         return element_keys[a] < element_keys[b];
+                     });
+
+    // copy node and element objects
+    std::vector<MeshLib::Node*> new_nodes(n_nodes);
+    for (std::size_t i = 0; i < n_nodes; ++i)
+        new_nodes[i] =
+            new MeshLib::Node(*mesh.getNode(new_to_old_node_ids[i]));
+    std::vector<MeshLib::Element*> new_elements(n_elements);
+    for (std::size_t e = 0; e < n_elements; ++e)
+    {
+        MeshLib::Element const& element(
+            *mesh.getElement(new_to_old_element_ids[e]));
+        new_elements[e] = element.clone();
+        for (unsigned i = 0; i < element.getNumberOfNodes(); ++i)
+            new_elements[e]->setNode(
+                i, new_nodes[new_node_ids[element.getNodeIndex(i)]]);
+    }
+
+    return new MeshLib::Mesh(
+        new_mesh_name, new_nodes, new_elements,
+        mesh.getProperties().permuteCopyProperties(new_to_old_element_ids,
+                                                   new_to_old_node_ids),
+        mesh.getNumberOfBaseNodes());
+}
+
+std::size_t computeNodeBandwidth(MeshLib::Mesh const& mesh)
+{
+    std::size_t bandwidth = 0;
+    for (MeshLib::Element const* element : mesh.getElements())
+    {
+        std::size_t min_id = unvisited;
+        std::size_t max_id = 0;
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+        {
+            std::size_t const id = element->getNodeIndex(i);
+            min_id = std::min(min_id, id);
+            max_id = std::max(max_id, id);
+        }
+        if (element->getNumberOfNodes() > 0)
+            bandwidth = std::max(bandwidth, max_id - min_id);
+    }
+    return bandwidth;
+}
+
+}  // end namespace MeshLib
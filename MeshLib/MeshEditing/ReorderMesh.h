@@ -0,0 +1,68 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef REORDERMESH_H_
+#define REORDERMESH_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+class Node;
+
+/**
+ * Computes a Reverse Cuthill-McKee ordering of the mesh nodes. Two nodes are
+ * adjacent if they belong to a common element. Each connected component is
+ * traversed breadth first, starting from a pseudo-peripheral node and
+ * visiting the neighbours in the order of increasing degree. The ordering
+ * reduces the bandwidth of the global matrices, whose d.o.f. are numbered in
+ * the node order.
+ * @return a vector of node ids, where the i-th entry is the id of the node
+ * that becomes node i
+ */
+std::vector<std::size_t> computeReverseCuthillMcKeeOrder(
+    MeshLib::Mesh const& mesh);
+
+/**
+ * Sorts the nodes along a three-dimensional Hilbert curve through their
+ * bounding box, i.e. nodes that are close in space get close ids.
+ * @return a vector of node indices, where the i-th entry is the index of the
+ * node that becomes node i
+ */
+std::vector<std::size_t> computeHilbertCurveOrder(
+    std::vector<MeshLib::Node*> const& nodes);
+
+/**
+ * Creates a copy of the mesh with the nodes renumbered according to
+ * \c node_order. The elements are sorted by the smallest new id of their
+ * nodes, such that the nodes of consecutive elements are close in memory.
+ * Node and cell properties are reordered accordingly. The original mesh is
+ * kept unchanged.
+ * @param mesh          the mesh to be reordered
+ * @param node_order    the i-th entry is the id of the node that becomes
+ *                      node i; the base nodes stay in front of the non-base
+ *                      nodes of a quadratic mesh in any case
+ * @param new_mesh_name the name of the new mesh
+ * @return a new mesh object or nullptr if \c node_order is not a permutation
+ * of the node ids
+ */
+MeshLib::Mesh* reorderMesh(MeshLib::Mesh const& mesh,
+                           std::vector<std::size_t> const& node_order,
+                           std::string const& new_mesh_name);
+
+/// Returns the largest difference of the ids of two nodes of an element,
+/// i.e. the half bandwidth of a matrix with one d.o.f. per node.
+std::size_t computeNodeBandwidth(MeshLib::Mesh const& mesh);
+
+}  // end namespace MeshLib
+
+#endif  // REORDERMESH_H_
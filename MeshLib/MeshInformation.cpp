@@ -13,7 +13,36 @@
  */
 
 #include "MeshInformation.h"
-#include "Elements/Element.h"
+#include "Elements/Elements.h"
+
+namespace
+{
+/// Size of the object of the concrete element type.
+std::size_t getElementObjectSize(MeshLib::Element const& e)
+{
+    using namespace MeshLib;
+    switch (e.getCellType())
+    {
+        case CellType::POINT1:    return sizeof(Point);
+        case CellType::LINE2:     return sizeof(Line);
+        case CellType::LINE3:     return sizeof(Line3);
+        case CellType::TRI3:      return sizeof(Tri);
+        case CellType::TRI6:      return sizeof(Tri6);
+        case CellType::QUAD4:     return sizeof(Quad);
+        case CellType::QUAD8:     return sizeof(Quad8);
+        case CellType::QUAD9:     return sizeof(Quad9);
+        case CellType::TET4:      return sizeof(Tet);
+        case CellType::TET10:     return sizeof(Tet10);
+        case CellType::HEX8:      return sizeof(Hex);
+        case CellType::HEX20:     return sizeof(Hex20);
+        case CellType::PRISM6:    return sizeof(Prism);
+        case CellType::PRISM15:   return sizeof(Prism15);
+        case CellType::PYRAMID5:  return sizeof(Pyramid);
+        case CellType::PYRAMID13: return sizeof(Pyramid13);
+        default:                  return sizeof(Element);
+    }
+}
+}  // anonymous namespace
 
 namespace MeshLib
 {
@@ -42,4 +71,43 @@ const std::array<unsigned, 7> MeshInformation::getNumberOfElementTypes(const Mes
     return n_element_types;
 }
 
+MeshMemoryUsage MeshInformation::getMemoryUsage(const MeshLib::Mesh &mesh)
+{
+    MeshMemoryUsage usage;
+
+    auto const& nodes = mesh.getNodes();
+    usage.nodes = nodes.capacity() * sizeof(MeshLib::Node*) +
+                  nodes.size() * sizeof(MeshLib::Node);
+    for (auto const* node : nodes)
+    {
+        usage.connectivity +=
+            node->getElements().capacity() * sizeof(MeshLib::Element*);
+        // The connected nodes are computed on first use; then the capacity
+        // is the number of base nodes of all elements of the node.
+        std::size_t connected_nodes = node->_connected_nodes.capacity();
+        if (!node->_connected_nodes_set)
+        {
+            connected_nodes = 0;
+            for (auto const* e : node->getElements())
+                connected_nodes += e->getNumberOfBaseNodes();
+        }
+        usage.connectivity += connected_nodes * sizeof(MeshLib::Node*);
+    }
+
+    auto const& elements = mesh.getElements();
+    usage.elements = elements.capacity() * sizeof(MeshLib::Element*);
+    for (auto const* e : elements)
+    {
+        usage.elements += getElementObjectSize(*e);
+        // the node and neighbour arrays allocated by each element
+        usage.connectivity +=
+            e->getNumberOfNodes() * sizeof(MeshLib::Node*) +
+            e->getNumberOfNeighbors() * sizeof(MeshLib::Element*);
+    }
+
+    usage.properties = mesh.getProperties().getMemoryUsage();
+
+    return usage;
+}
+
 } //end MeshLib
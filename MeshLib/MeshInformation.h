@@ -27,6 +27,17 @@
 namespace MeshLib
 {
 
+/// Estimated heap memory in bytes held by a mesh.
+struct MeshMemoryUsage
+{
+    std::size_t nodes = 0;         ///< Node objects and the node vector.
+    std::size_t elements = 0;      ///< Element objects and the element vector.
+    std::size_t connectivity = 0;  ///< Element nodes and neighbours, node
+                                   ///< elements and connected nodes, the
+                                   ///< latter also if not computed yet.
+    std::size_t properties = 0;    ///< Property vectors.
+};
+
 /**
  * \brief A set of tools for extracting information from a mesh
  */
@@ -67,6 +78,9 @@ public:
      */
     static const std::array<unsigned, 7> getNumberOfElementTypes(const MeshLib::Mesh &mesh);
 
+    /// Returns an estimate of the memory held by the given mesh.
+    static MeshMemoryUsage getMemoryUsage(const MeshLib::Mesh &mesh);
+
 
 };
 
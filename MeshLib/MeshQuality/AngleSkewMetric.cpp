@@ -29,37 +29,22 @@ AngleSkewMetric::AngleSkewMetric(Mesh const& mesh) :
     ElementQualityMetric(mesh)
 {}
 
-void AngleSkewMetric::calculateQuality ()
+double AngleSkewMetric::computeElementQuality (Element const& elem) const
 {
-    const std::vector<MeshLib::Element*>& elements(_mesh.getElements());
-    const std::size_t nElements (_mesh.getNumberOfElements());
-
-    for (std::size_t k(0); k < nElements; k++)
+    switch (elem.getGeomType())
     {
-        Element const& elem (*elements[k]);
-        switch (elem.getGeomType())
-        {
-        case MeshElemType::LINE:
-            _element_quality_metric[k] = -1.0;
-            break;
-        case MeshElemType::TRIANGLE:
-            _element_quality_metric[k] = checkTriangle (elem);
-            break;
-        case MeshElemType::QUAD:
-            _element_quality_metric[k] = checkQuad (elem);
-            break;
-        case MeshElemType::TETRAHEDRON:
-            _element_quality_metric[k] = checkTetrahedron (elem);
-            break;
-        case MeshElemType::HEXAHEDRON:
-            _element_quality_metric[k] = checkHexahedron (elem);
-            break;
-        case MeshElemType::PRISM:
-            _element_quality_metric[k] = checkPrism (elem);
-            break;
-        default:
-            break;
-        }
+    case MeshElemType::TRIANGLE:
+        return checkTriangle (elem);
+    case MeshElemType::QUAD:
+        return checkQuad (elem);
+    case MeshElemType::TETRAHEDRON:
+        return checkTetrahedron (elem);
+    case MeshElemType::HEXAHEDRON:
+        return checkHexahedron (elem);
+    case MeshElemType::PRISM:
+        return checkPrism (elem);
+    default:
+        return -1.0;
     }
 }
 
@@ -28,7 +28,7 @@ class AngleSkewMetric final : public ElementQualityMetric
 public:
     AngleSkewMetric(Mesh const& mesh);
 
-    void calculateQuality();
+    double computeElementQuality(Element const& elem) const override;
 
 private:
     double checkTriangle(Element const& elem) const;
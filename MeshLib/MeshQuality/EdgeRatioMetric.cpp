@@ -14,6 +14,9 @@
 
 #include "EdgeRatioMetric.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "MathLib/MathTools.h"
 #include "MeshLib/Node.h"
 
@@ -24,57 +27,29 @@ EdgeRatioMetric::EdgeRatioMetric(Mesh const& mesh) :
 {
 }
 
-void EdgeRatioMetric::calculateQuality()
+double EdgeRatioMetric::computeElementQuality(Element const& elem) const
 {
-    // get all elements of mesh
-    const std::vector<MeshLib::Element*>& elements(_mesh.getElements());
-    const std::size_t nElements (_mesh.getNumberOfElements());
-    for (std::size_t k(0); k < nElements; k++)
+    switch (elem.getGeomType())
     {
-        Element const& elem (*elements[k]);
-        switch (elem.getGeomType())
-        {
-        case MeshElemType::LINE:
-            _element_quality_metric[k] = 1.0;
-            break;
-        case MeshElemType::TRIANGLE: {
-            _element_quality_metric[k] = checkTriangle(*elem.getNode(0), *elem.getNode(1), *elem.getNode(2));
-            break;
-        }
-        case MeshElemType::QUAD: {
-            _element_quality_metric[k] = checkQuad(*elem.getNode(0), *elem.getNode(1), *elem.getNode(2), *elem.getNode(3));
-            break;
-        }
-        case MeshElemType::TETRAHEDRON: {
-            _element_quality_metric[k] = checkTetrahedron(*elem.getNode(0), *elem.getNode(1), *elem.getNode(2), *elem.getNode(3));
-            break;
-        }
-        case MeshElemType::PRISM: {
-            std::vector<const MathLib::Point3d*> pnts;
-            for (std::size_t j(0); j < 6; j++)
-                pnts.push_back(elem.getNode(j));
-            _element_quality_metric[k] = checkPrism(pnts);
-            break;
-        }
-        case MeshElemType::PYRAMID: {
-            std::vector<const MathLib::Point3d*> pnts;
-            for (std::size_t j(0); j < 5; j++)
-                pnts.push_back(elem.getNode(j));
-            _element_quality_metric[k] = checkPyramid(pnts);
-            break;
-        }
-        case MeshElemType::HEXAHEDRON: {
-            std::vector<const MathLib::Point3d*> pnts;
-            for (std::size_t j(0); j < 8; j++)
-                pnts.push_back(elem.getNode(j));
-            _element_quality_metric[k] = checkHexahedron(pnts);
-            break;
-        }
-        default:
-            ERR ("MeshQualityShortestLongestRatio::check () check for element type %s not implemented.",
-                 MeshElemType2String(elem.getGeomType()).c_str());
-        }
+    case MeshElemType::LINE:
+        return 1.0;
+    case MeshElemType::TRIANGLE:
+        return checkTriangle(*elem.getNode(0), *elem.getNode(1), *elem.getNode(2));
+    case MeshElemType::QUAD:
+        return checkQuad(*elem.getNode(0), *elem.getNode(1), *elem.getNode(2), *elem.getNode(3));
+    case MeshElemType::TETRAHEDRON:
+        return checkTetrahedron(*elem.getNode(0), *elem.getNode(1), *elem.getNode(2), *elem.getNode(3));
+    case MeshElemType::PRISM:
+        return checkPrism(elem.getNodes());
+    case MeshElemType::PYRAMID:
+        return checkPyramid(elem.getNodes());
+    case MeshElemType::HEXAHEDRON:
+        return checkHexahedron(elem.getNodes());
+    default:
+        ERR ("MeshQualityShortestLongestRatio::check () check for element type %s not implemented.",
+             MeshElemType2String(elem.getGeomType()).c_str());
     }
+    return -1.0;
 }
 
 double EdgeRatioMetric::checkTriangle (MathLib::Point3d const& a,
@@ -121,13 +96,8 @@ double EdgeRatioMetric::checkQuad (MathLib::Point3d const& a,
                          MathLib::sqrDist (d,c),
                          MathLib::sqrDist (a,d)};
 
-    // sort lengths - since this is a very small array we use bubble sort
-    for (std::size_t i(0); i < 4; i++)
-        for (std::size_t j(i + 1); j < 4; j++)
-            if (sqr_lengths[i] >= sqr_lengths[j])
-                std::swap (sqr_lengths[i], sqr_lengths[j]);
-
-    return sqrt(sqr_lengths[0]) / sqrt(sqr_lengths[3]);
+    auto const min_max = std::minmax_element(sqr_lengths, sqr_lengths + 4);
+    return std::sqrt(*min_max.first) / std::sqrt(*min_max.second);
 }
 
 double EdgeRatioMetric::checkTetrahedron (MathLib::Point3d const& a,
@@ -139,16 +109,11 @@ double EdgeRatioMetric::checkTetrahedron (MathLib::Point3d const& a,
                          MathLib::sqrDist (c,a), MathLib::sqrDist (a,d),
                          MathLib::sqrDist (b,d), MathLib::sqrDist (c,d)};
 
-    // sort lengths - since this is a very small array we use bubble sort
-    for (std::size_t i(0); i < 6; i++)
-        for (std::size_t j(i + 1); j < 6; j++)
-            if (sqr_lengths[i] >= sqr_lengths[j])
-                std::swap (sqr_lengths[i], sqr_lengths[j]);
-
-    return sqrt(sqr_lengths[0]) / sqrt(sqr_lengths[5]);
+    auto const min_max = std::minmax_element(sqr_lengths, sqr_lengths + 6);
+    return std::sqrt(*min_max.first) / std::sqrt(*min_max.second);
 }
 
-double EdgeRatioMetric::checkPrism (std::vector<const MathLib::Point3d*> const& pnts) const
+double EdgeRatioMetric::checkPrism (Node const* const* pnts) const
 {
     double sqr_lengths[9] = {MathLib::sqrDist (*pnts[0],*pnts[1]),
                          MathLib::sqrDist (*pnts[1],*pnts[2]),
@@ -160,16 +125,11 @@ double EdgeRatioMetric::checkPrism (std::vector<const MathLib::Point3d*> const&
                          MathLib::sqrDist (*pnts[1],*pnts[4]),
                          MathLib::sqrDist (*pnts[2],*pnts[5])};
 
-    // sort lengths - since this is a very small array we use bubble sort
-    for (std::size_t i(0); i < 9; i++)
-        for (std::size_t j(i + 1); j < 9; j++)
-            if (sqr_lengths[i] >= sqr_lengths[j])
-                std::swap (sqr_lengths[i], sqr_lengths[j]);
-
-    return sqrt(sqr_lengths[0]) / sqrt(sqr_lengths[8]);
+    auto const min_max = std::minmax_element(sqr_lengths, sqr_lengths + 9);
+    return std::sqrt(*min_max.first) / std::sqrt(*min_max.second);
 }
 
-double EdgeRatioMetric::checkPyramid (std::vector<const MathLib::Point3d*> const &pnts) const
+double EdgeRatioMetric::checkPyramid (Node const* const* pnts) const
 {
     double sqr_lengths[8] = {MathLib::sqrDist (*pnts[0],*pnts[1]),
                          MathLib::sqrDist (*pnts[1],*pnts[2]),
@@ -180,16 +140,11 @@ double EdgeRatioMetric::checkPyramid (std::vector<const MathLib::Point3d*> const
                          MathLib::sqrDist (*pnts[2],*pnts[4]),
                          MathLib::sqrDist (*pnts[3],*pnts[4])};
 
-    // sort lengths - since this is a very small array we use bubble sort
-    for (std::size_t i(0); i < 8; i++)
-        for (std::size_t j(i + 1); j < 8; j++)
-            if (sqr_lengths[i] >= sqr_lengths[j])
-                std::swap (sqr_lengths[i], sqr_lengths[j]);
-
-    return sqrt(sqr_lengths[0]) / sqrt(sqr_lengths[7]);
+    auto const min_max = std::minmax_element(sqr_lengths, sqr_lengths + 8);
+    return std::sqrt(*min_max.first) / std::sqrt(*min_max.second);
 }
 
-double EdgeRatioMetric::checkHexahedron (std::vector<const MathLib::Point3d*> const & pnts) const
+double EdgeRatioMetric::checkHexahedron (Node const* const* pnts) const
 {
     double sqr_lengths[12] = {MathLib::sqrDist (*pnts[0],*pnts[1]),
                           MathLib::sqrDist (*pnts[1],*pnts[2]),
@@ -204,12 +159,7 @@ double EdgeRatioMetric::checkHexahedron (std::vector<const MathLib::Point3d*> co
                           MathLib::sqrDist (*pnts[2],*pnts[6]),
                           MathLib::sqrDist (*pnts[3],*pnts[7])};
 
-    // sort lengths - since this is a very small array we use bubble sort
-    for (std::size_t i(0); i < 12; i++)
-        for (std::size_t j(i + 1); j < 12; j++)
-            if (sqr_lengths[i] >= sqr_lengths[j])
-                std::swap (sqr_lengths[i], sqr_lengths[j]);
-
-    return sqrt(sqr_lengths[0]) / sqrt(sqr_lengths[11]);
+    auto const min_max = std::minmax_element(sqr_lengths, sqr_lengths + 12);
+    return std::sqrt(*min_max.first) / std::sqrt(*min_max.second);
 }
 } // end namespace MeshLib
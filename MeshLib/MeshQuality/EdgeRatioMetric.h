@@ -30,7 +30,7 @@ public:
     EdgeRatioMetric(Mesh const& mesh);
     virtual ~EdgeRatioMetric () {}
 
-    virtual void calculateQuality ();
+    double computeElementQuality (Element const& elem) const override;
 
 private:
     double checkTriangle (MathLib::Point3d const& a,
@@ -44,9 +44,9 @@ private:
                              MathLib::Point3d const& b,
                              MathLib::Point3d const& c,
                              MathLib::Point3d const& d) const;
-    double checkPrism (std::vector<const MathLib::Point3d*> const& pnts) const;
-    double checkPyramid (std::vector<const MathLib::Point3d*> const& pnts) const;
-    double checkHexahedron (std::vector<const MathLib::Point3d*> const& pnts) const;
+    double checkPrism (Node const* const* pnts) const;
+    double checkPyramid (Node const* const* pnts) const;
+    double checkHexahedron (Node const* const* pnts) const;
 };
 }
 
@@ -23,7 +23,26 @@ namespace MeshLib
 ElementQualityMetric::ElementQualityMetric(Mesh const& mesh) :
     _min (std::numeric_limits<double>::max()), _max (0), _mesh (mesh)
 {
-    _element_quality_metric.resize (_mesh.getNumberOfElements(), -1.0);
+}
+
+void ElementQualityMetric::calculateQuality()
+{
+    std::vector<MeshLib::Element*> const& elements(_mesh.getElements());
+    std::size_t const n_elements(elements.size());
+    _element_quality_metric.resize(n_elements);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_elements; ++k)
+#else
+    for (std::size_t k = 0; k < n_elements; ++k)
+#endif
+        _element_quality_metric[k] = computeElementQuality(*elements[k]);
+
+    for (double const q : _element_quality_metric)
+    {
+        if (_min > q) _min = q;
+        if (_max < q) _max = q;
+    }
 }
 
 BaseLib::Histogram<double> ElementQualityMetric::getHistogram (std::size_t n_bins) const
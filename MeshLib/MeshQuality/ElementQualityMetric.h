@@ -37,8 +37,12 @@ public:
 
     virtual ~ElementQualityMetric () {}
 
-    /// Calculates the quality metric for each element of the mesh
-    virtual void calculateQuality () = 0;
+    /// Calculates the quality metric for each element of the mesh. The
+    /// elements are processed in parallel if OpenMP is enabled.
+    virtual void calculateQuality ();
+
+    /// Calculates the quality metric of a single element of the mesh.
+    virtual double computeElementQuality (Element const& elem) const = 0;
 
     /// Returns the result vector
     std::vector<double> const& getElementQuality () const;
@@ -29,12 +29,9 @@ public:
     ElementSizeMetric(Mesh const& mesh);
     virtual ~ElementSizeMetric() {}
 
-    virtual void calculateQuality ();
+    void calculateQuality () override;
 
-private:
-    std::size_t calc1dQuality();
-    std::size_t calc2dQuality();
-    std::size_t calc3dQuality();
+    double computeElementQuality (Element const& elem) const override;
 };
 }
 
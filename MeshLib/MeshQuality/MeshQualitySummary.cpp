@@ -0,0 +1,82 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "MeshQualitySummary.h"
+
+#include <cmath>
+#include <memory>
+
+#include "BaseLib/Error.h"
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshQuality/AngleSkewMetric.h"
+#include "MeshLib/MeshQuality/EdgeRatioMetric.h"
+#include "MeshLib/MeshQuality/ElementSizeMetric.h"
+#include "MeshLib/MeshQuality/RadiusEdgeRatioMetric.h"
+#include "MeshLib/MeshQuality/SizeDifferenceMetric.h"
+
+namespace MeshLib
+{
+MeshQualitySummary::MeshQualitySummary(Mesh const& mesh)
+{
+    // Same order as in MeshQualityType.
+    std::array<std::unique_ptr<ElementQualityMetric>, n_metrics> const metrics =
+        {{std::unique_ptr<ElementQualityMetric>(new ElementSizeMetric(mesh)),
+          std::unique_ptr<ElementQualityMetric>(new SizeDifferenceMetric(mesh)),
+          std::unique_ptr<ElementQualityMetric>(new EdgeRatioMetric(mesh)),
+          std::unique_ptr<ElementQualityMetric>(new AngleSkewMetric(mesh)),
+          std::unique_ptr<ElementQualityMetric>(
+              new RadiusEdgeRatioMetric(mesh))}};
+
+    std::vector<MeshLib::Element*> const& elements(mesh.getElements());
+    std::size_t const n_elements(elements.size());
+    _error_codes.resize(n_elements);
+    for (auto& quality : _element_quality)
+        quality.resize(n_elements);
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_elements; ++k)
+#else
+    for (std::size_t k = 0; k < n_elements; ++k)
+#endif
+    {
+        Element const& elem(*elements[k]);
+        _error_codes[k] = elem.validate();
+        for (std::size_t m = 0; m < n_metrics; ++m)
+            _element_quality[m][k] = metrics[m]->computeElementQuality(elem);
+    }
+}
+
+std::size_t MeshQualitySummary::getMetricIndex(MeshQualityType t)
+{
+    if (t == MeshQualityType::INVALID)
+        OGS_FATAL("MeshQualitySummary: invalid mesh quality type.");
+    return static_cast<std::size_t>(t) - 1;
+}
+
+std::vector<double> const& MeshQualitySummary::getElementQuality(
+    MeshQualityType t) const
+{
+    return _element_quality[getMetricIndex(t)];
+}
+
+BaseLib::Histogram<double> MeshQualitySummary::getHistogram(
+    MeshQualityType t, std::size_t n_bins) const
+{
+    std::vector<double> const& quality(getElementQuality(t));
+    if (n_bins == 0)
+        n_bins = static_cast<std::size_t>(
+            1 + 3.3 * std::log(static_cast<float>(quality.size())));
+
+    return BaseLib::Histogram<double>(quality, n_bins, true);
+}
+
+}  // namespace MeshLib
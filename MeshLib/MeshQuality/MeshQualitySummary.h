@@ -0,0 +1,67 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef MESHQUALITYSUMMARY_H_
+#define MESHQUALITYSUMMARY_H_
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "BaseLib/Histogram.h"
+
+#include "MeshLib/Elements/ElementErrorCode.h"
+#include "MeshLib/MeshEnums.h"
+
+namespace MeshLib
+{
+class Mesh;
+
+/**
+ * Computes the geometric error codes (see Element::validate()) and the
+ * values of all element quality metrics (see MeshQualityType) of a mesh.
+ *
+ * In contrast to running MeshValidation::testElementGeometry() and each
+ * ElementQualityMetric on its own, all checks are done in a single sweep
+ * over the elements, i.e. the nodes of an element are loaded only once.
+ * The elements are processed in parallel if OpenMP is enabled.
+ */
+class MeshQualitySummary final
+{
+public:
+    explicit MeshQualitySummary(Mesh const& mesh);
+
+    /// Returns the error codes of all elements.
+    std::vector<ElementErrorCode> const& getElementErrorCodes() const
+    {
+        return _error_codes;
+    }
+
+    /// Returns the quality of all elements w.r.t. the given metric.
+    std::vector<double> const& getElementQuality(MeshQualityType t) const;
+
+    /// Returns a histogram of the quality vector of the given metric
+    /// separated into the given number of bins. If no number of bins is
+    /// specified, one will be calculated based on the Sturges criterium.
+    BaseLib::Histogram<double> getHistogram(MeshQualityType t,
+                                            std::size_t n_bins = 0) const;
+
+    /// Number of metrics, i.e. valid values of MeshQualityType.
+    static std::size_t const n_metrics = 5;
+
+private:
+    static std::size_t getMetricIndex(MeshQualityType t);
+
+    std::vector<ElementErrorCode> _error_codes;
+    std::array<std::vector<double>, n_metrics> _element_quality;
+};
+
+}  // namespace MeshLib
+
+#endif  // MESHQUALITYSUMMARY_H_
@@ -55,20 +55,23 @@ std::vector<ElementErrorCode> MeshValidation::testElementGeometry(const MeshLib:
     std::fill_n(error_count, 4, 0);
     const std::size_t nElements (mesh.getNumberOfElements());
     const std::vector<MeshLib::Element*> &elements (mesh.getElements());
-    std::vector<ElementErrorCode> error_code_vector;
-    error_code_vector.reserve(nElements);
+    std::vector<ElementErrorCode> error_code_vector(nElements);
 
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE i = 0; i < nElements; ++i)
+#else
     for (std::size_t i=0; i<nElements; ++i)
+#endif
+        error_code_vector[i] = elements[i]->validate();
+
+    // increment error statistics
+    for (auto const& e : error_code_vector)
     {
-        const ElementErrorCode e = elements[i]->validate();
-        error_code_vector.push_back(e);
         if (e.none())
             continue;
-
-        // increment error statistics
-        const std::bitset< static_cast<std::size_t>(ElementErrorFlag::MaxValue) > flags (static_cast< std::bitset<static_cast<std::size_t>(ElementErrorFlag::MaxValue)> >(e));
         for (unsigned j=0; j<nErrorCodes; ++j)
-            error_count[j] += flags[j];
+            error_count[j] += e.test(j);
     }
 
     // if a larger volume threshold is given, evaluate elements again to add them even if they are formally okay
@@ -140,7 +143,8 @@ unsigned MeshValidation::detectHoles(MeshLib::Mesh const& mesh)
     {
         std::size_t const idx = static_cast<std::size_t>(std::distance(sfc_idx.cbegin(), it));
         trackSurface(elements[idx], sfc_idx, current_surface_id++);
-        it = std::find(sfc_idx.cbegin(), sfc_idx.cend(), std::numeric_limits<unsigned>::max());
+        // All elements before it have been assigned to a surface already.
+        it = std::find(it, sfc_idx.cend(), std::numeric_limits<unsigned>::max());
     }
     delete boundary_mesh;
 
@@ -24,21 +24,15 @@ RadiusEdgeRatioMetric::RadiusEdgeRatioMetric(Mesh const& mesh)
 : ElementQualityMetric(mesh)
 {}
 
-void RadiusEdgeRatioMetric::calculateQuality ()
+double RadiusEdgeRatioMetric::computeElementQuality (Element const& elem) const
 {
-    std::vector<MeshLib::Element*> const& elements(_mesh.getElements());
-    std::size_t const nElements (_mesh.getNumberOfElements());
-    for (std::size_t k(0); k < nElements; k++)
-    {
-        Element const& elem (*elements[k]);
-        std::size_t const n_nodes (elem.getNumberOfBaseNodes());
-        std::vector<MathLib::Point3d*> pnts(n_nodes);
-        std::copy_n(elem.getNodes(), n_nodes, pnts.begin());
-        GeoLib::MinimalBoundingSphere const s(pnts);
-        double min, max;
-        elem.computeSqrEdgeLengthRange(min, max);
-        _element_quality_metric[k] = sqrt(min)/(2*s.getRadius());
-    }
+    std::size_t const n_nodes (elem.getNumberOfBaseNodes());
+    std::vector<MathLib::Point3d*> pnts(n_nodes);
+    std::copy_n(elem.getNodes(), n_nodes, pnts.begin());
+    GeoLib::MinimalBoundingSphere const s(pnts);
+    double min, max;
+    elem.computeSqrEdgeLengthRange(min, max);
+    return sqrt(min)/(2*s.getRadius());
 }
 
 } // end namespace MeshLib
@@ -30,7 +30,7 @@ public:
     RadiusEdgeRatioMetric(Mesh const& mesh);
     virtual ~RadiusEdgeRatioMetric() {}
 
-    virtual void calculateQuality ();
+    double computeElementQuality (Element const& elem) const override;
 };
 }
 
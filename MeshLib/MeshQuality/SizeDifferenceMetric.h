@@ -30,7 +30,7 @@ public:
     SizeDifferenceMetric(Mesh const& mesh);
     virtual ~SizeDifferenceMetric() {}
 
-    virtual void calculateQuality ();
+    double computeElementQuality (Element const& elem) const override;
 };
 }
 
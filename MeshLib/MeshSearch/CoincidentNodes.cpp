@@ -0,0 +1,232 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "CoincidentNodes.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <unordered_map>
+
+#include "MathLib/MathTools.h"
+
+#include "MeshLib/Node.h"
+
+namespace
+{
+/// Union-find structure that can be updated concurrently. A root is always
+/// linked below the smaller root, i.e. the root of each set is its smallest
+/// element independent of the order of the unite() calls.
+class ConcurrentUnionFind
+{
+public:
+    explicit ConcurrentUnionFind(std::size_t const n) : _parent(n)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            _parent[i].store(i, std::memory_order_relaxed);
+    }
+
+    std::size_t find(std::size_t i)
+    {
+        while (true)
+        {
+            std::size_t p = _parent[i].load();
+            if (p == i)
+                return i;
+            std::size_t const grand_parent = _parent[p].load();
+            // Path halving. If the exchange fails another thread has
+            // already shortened the path.
+            if (p != grand_parent)
+                _parent[i].compare_exchange_weak(p, grand_parent);
+            i = grand_parent;
+        }
+    }
+
+    void unite(std::size_t a, std::size_t b)
+    {
+        while (true)
+        {
+            a = find(a);
+            b = find(b);
+            if (a == b)
+                return;
+            if (a < b)
+                std::swap(a, b);
+            // a is the larger root; retry if it got linked meanwhile
+            std::size_t expected = a;
+            if (_parent[a].compare_exchange_strong(expected, b))
+                return;
+        }
+    }
+
+private:
+    std::vector<std::atomic<std::size_t>> _parent;
+};
+
+/// Maximum number of grid cells per dimension; bounds the cell keys for
+/// very small eps.
+const std::size_t max_cells_per_dimension = std::size_t(1) << 20;
+
+}  // anonymous namespace
+
+namespace MeshLib
+{
+std::vector<std::size_t> findCoincidentNodes(std::vector<Node*> const& nodes,
+                                             double const eps)
+{
+    std::size_t const n_nodes(nodes.size());
+    std::vector<std::size_t> id_map(n_nodes);
+    std::iota(id_map.begin(), id_map.end(), 0);
+    if (n_nodes < 2 || !(eps > 0))
+        return id_map;
+
+    // grid of cells with an edge length of at least eps
+    std::array<double, 3> min_pnt = {{(*nodes[0])[0], (*nodes[0])[1],
+                                      (*nodes[0])[2]}};
+    std::array<double, 3> max_pnt(min_pnt);
+    for (auto const* node : nodes)
+        for (unsigned d = 0; d < 3; ++d)
+        {
+            min_pnt[d] = std::min(min_pnt[d], (*node)[d]);
+            max_pnt[d] = std::max(max_pnt[d], (*node)[d]);
+        }
+    double max_extent = 0;
+    for (unsigned d = 0; d < 3; ++d)
+        max_extent = std::max(max_extent, max_pnt[d] - min_pnt[d]);
+    double const cell_size =
+        std::max(eps, max_extent / max_cells_per_dimension);
+    std::array<std::uint64_t, 3> n_cells;
+    for (unsigned d = 0; d < 3; ++d)
+        n_cells[d] = static_cast<std::uint64_t>(
+                         std::floor((max_pnt[d] - min_pnt[d]) / cell_size)) +
+                     1;
+
+    auto const cell_coordinate = [&](MeshLib::Node const& node,
+                                     unsigned d) -> std::uint64_t
+    {
+        auto const c = static_cast<std::uint64_t>(
+            std::floor((node[d] - min_pnt[d]) / cell_size));
+        return std::min(c, n_cells[d] - 1);
+    };
+
+    std::vector<std::uint64_t> node_keys(n_nodes);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_nodes; ++k)
+#else
+    for (std::size_t k = 0; k < n_nodes; ++k)
+#endif
+    {
+        Node const& node(*nodes[k]);
+        node_keys[k] = (cell_coordinate(node, 0) * n_cells[1] +
+                        cell_coordinate(node, 1)) * n_cells[2] +
+                       cell_coordinate(node, 2);
+    }
+
+    // sort the nodes by cell and store the range of each non-empty cell
+    std::vector<std::size_t> sorted_nodes(id_map);
+    std::sort(sorted_nodes.begin(), sorted_nodes.end(),
+              [&node_keys](std::size_t a, std::size_t b)
+              {
+                  return node_keys[a] < node_keys[b] ||
+                         (node_keys[a] == node_keys[b] && a < b);
+              });
+    std::vector<std::size_t> cell_begin;
+    std::unordered_map<std::uint64_t, std::size_t> cell_index;
+    for (std::size_t k = 0; k < n_nodes; ++k)
+    {
+        std::uint64_t const key(node_keys[sorted_nodes[k]]);
+        if (k == 0 || key != node_keys[sorted_nodes[k - 1]])
+        {
+            cell_index[key] = cell_begin.size();
+            cell_begin.push_back(k);
+        }
+    }
+    std::size_t const n_non_empty_cells(cell_begin.size());
+    cell_begin.push_back(n_nodes);
+
+    double const sqr_eps(eps * eps);
+    ConcurrentUnionFind groups(n_nodes);
+    auto const compareNodes = [&](std::size_t const cell_a,
+                                  std::size_t const cell_b)
+    {
+        for (std::size_t i = cell_begin[cell_a]; i < cell_begin[cell_a + 1];
+             ++i)
+        {
+            std::size_t const a(sorted_nodes[i]);
+            std::size_t const j_begin =
+                (cell_a == cell_b) ? i + 1 : cell_begin[cell_b];
+            for (std::size_t j = j_begin; j < cell_begin[cell_b + 1]; ++j)
+            {
+                std::size_t const b(sorted_nodes[j]);
+                if (MathLib::sqrDist(nodes[a]->getCoords(),
+                                     nodes[b]->getCoords()) < sqr_eps)
+                    groups.unite(a, b);
+            }
+        }
+    };
+
+    // Each pair of neighbouring cells is visited once: every cell is
+    // compared with itself and the 13 neighbours with a larger offset.
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 256)
+    for (OPENMP_LOOP_TYPE c = 0; c < n_non_empty_cells; ++c)
+#else
+    for (std::size_t c = 0; c < n_non_empty_cells; ++c)
+#endif
+    {
+        compareNodes(c, c);
+
+        std::uint64_t const key(node_keys[sorted_nodes[cell_begin[c]]]);
+        std::array<std::uint64_t, 3> const ijk = {
+            {key / (n_cells[1] * n_cells[2]), (key / n_cells[2]) % n_cells[1],
+             key % n_cells[2]}};
+        for (int dx = -1; dx <= 1; ++dx)
+            for (int dy = -1; dy <= 1; ++dy)
+                for (int dz = -1; dz <= 1; ++dz)
+                {
+                    if (9 * dx + 3 * dy + dz <= 0)
+                        continue;
+                    std::array<int, 3> const offset = {{dx, dy, dz}};
+                    std::uint64_t neighbor_key = 0;
+                    bool inside = true;
+                    for (unsigned d = 0; d < 3; ++d)
+                    {
+                        if ((offset[d] < 0 && ijk[d] == 0) ||
+                            (offset[d] > 0 && ijk[d] + 1 == n_cells[d]))
+                        {
+                            inside = false;
+                            break;
+                        }
+                        neighbor_key = neighbor_key * n_cells[d] + ijk[d] +
+                                       offset[d];
+                    }
+                    if (!inside)
+                        continue;
+                    auto const neighbor = cell_index.find(neighbor_key);
+                    if (neighbor != cell_index.end())
+                        compareNodes(c, neighbor->second);
+                }
+    }
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_nodes; ++k)
+#else
+    for (std::size_t k = 0; k < n_nodes; ++k)
+#endif
+        id_map[k] = groups.find(k);
+
+    return id_map;
+}
+
+}  // namespace MeshLib
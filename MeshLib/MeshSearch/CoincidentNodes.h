@@ -0,0 +1,42 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef COINCIDENTNODES_H_
+#define COINCIDENTNODES_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace MeshLib
+{
+class Node;
+
+/**
+ * Finds groups of nodes that have to be merged because their distance is
+ * smaller than \c eps.
+ *
+ * Two nodes belong to the same group if they are closer than \c eps or if
+ * they are connected by a chain of such nodes. The nodes are sorted into
+ * the cells of a regular grid with a cell size of at least \c eps, such
+ * that only nodes of neighbouring cells have to be compared. The groups are
+ * built by a union-find structure; if OpenMP is enabled, the grid cells are
+ * processed in parallel.
+ *
+ * \param nodes the nodes to be tested; the node ids are not used
+ * \param eps   nodes with a distance smaller than eps are merged
+ * \return a vector that maps the index of each node to the smallest index
+ * of a node within its group, i.e. nodes that are not merged are mapped to
+ * themselves. The result does not depend on the number of threads.
+ */
+std::vector<std::size_t> findCoincidentNodes(std::vector<Node*> const& nodes,
+                                             double eps);
+
+}  // namespace MeshLib
+
+#endif  // COINCIDENTNODES_H_
@@ -0,0 +1,635 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ElementBVH.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "MathLib/MathTools.h"
+#include "MathLib/Vector3.h"
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+/// Maximum number of elements in a leaf of the hierarchy.
+const std::size_t max_leaf_size = 4;
+
+/// Maximum depth of the hierarchy; the median split halves the number of
+/// elements in each level.
+const std::size_t max_depth = 64;
+
+/// Evaluates the shape functions of the linear element of the given type and
+/// their derivatives with respect to the natural coordinates r, cf. the
+/// corresponding shape functions in NumLib/Fem/ShapeFunction.
+void computeLinearShapeFunctions(MeshLib::MeshElemType const type,
+                                 std::array<double, 3> const& r,
+                                 std::array<double, 8>& N,
+                                 std::array<std::array<double, 3>, 8>& dN)
+{
+    // signs of the natural coordinates of the corner nodes of the
+    // quadrilateral/hexahedral reference element
+    static const double hex_signs[8][3] = {{-1, -1, -1}, {1, -1, -1},
+                                           {1, 1, -1},   {-1, 1, -1},
+                                           {-1, -1, 1},  {1, -1, 1},
+                                           {1, 1, 1},    {-1, 1, 1}};
+    switch (type)
+    {
+        case MeshLib::MeshElemType::LINE:
+            N[0] = 0.5 * (1 - r[0]);
+            N[1] = 0.5 * (1 + r[0]);
+            dN[0] = {{-0.5, 0, 0}};
+            dN[1] = {{0.5, 0, 0}};
+            break;
+        case MeshLib::MeshElemType::TRIANGLE:
+            N[0] = 1 - r[0] - r[1];
+            N[1] = r[0];
+            N[2] = r[1];
+            dN[0] = {{-1, -1, 0}};
+            dN[1] = {{1, 0, 0}};
+            dN[2] = {{0, 1, 0}};
+            break;
+        case MeshLib::MeshElemType::QUAD:
+        {
+            // the first node of the quad is located at (1, 1)
+            static const double quad_signs[4][2] = {
+                {1, 1}, {-1, 1}, {-1, -1}, {1, -1}};
+            for (unsigned i = 0; i < 4; ++i)
+            {
+                double const a = 1 + quad_signs[i][0] * r[0];
+                double const b = 1 + quad_signs[i][1] * r[1];
+                N[i] = 0.25 * a * b;
+                dN[i] = {{0.25 * quad_signs[i][0] * b,
+                          0.25 * quad_signs[i][1] * a, 0}};
+            }
+            break;
+        }
+        case MeshLib::MeshElemType::TETRAHEDRON:
+            N[0] = 1 - r[0] - r[1] - r[2];
+            N[1] = r[0];
+            N[2] = r[1];
+            N[3] = r[2];
+            dN[0] = {{-1, -1, -1}};
+            dN[1] = {{1, 0, 0}};
+            dN[2] = {{0, 1, 0}};
+            dN[3] = {{0, 0, 1}};
+            break;
+        case MeshLib::MeshElemType::HEXAHEDRON:
+            for (unsigned i = 0; i < 8; ++i)
+            {
+                double const a = 1 + hex_signs[i][0] * r[0];
+                double const b = 1 + hex_signs[i][1] * r[1];
+                double const c = 1 + hex_signs[i][2] * r[2];
+                N[i] = 0.125 * a * b * c;
+                dN[i] = {{0.125 * hex_signs[i][0] * b * c,
+                          0.125 * hex_signs[i][1] * a * c,
+                          0.125 * hex_signs[i][2] * a * b}};
+            }
+            break;
+        case MeshLib::MeshElemType::PRISM:
+        {
+            double const L0 = 1 - r[0] - r[1];
+            double const bottom = 0.5 * (1 - r[2]);
+            double const top = 0.5 * (1 + r[2]);
+            N[0] = L0 * bottom;
+            N[1] = r[0] * bottom;
+            N[2] = r[1] * bottom;
+            N[3] = L0 * top;
+            N[4] = r[0] * top;
+            N[5] = r[1] * top;
+            dN[0] = {{-bottom, -bottom, -0.5 * L0}};
+            dN[1] = {{bottom, 0, -0.5 * r[0]}};
+            dN[2] = {{0, bottom, -0.5 * r[1]}};
+            dN[3] = {{-top, -top, 0.5 * L0}};
+            dN[4] = {{top, 0, 0.5 * r[0]}};
+            dN[5] = {{0, top, 0.5 * r[1]}};
+            break;
+        }
+        case MeshLib::MeshElemType::PYRAMID:
+            for (unsigned i = 0; i < 4; ++i)
+            {
+                double const a = 1 + hex_signs[i][0] * r[0];
+                double const b = 1 + hex_signs[i][1] * r[1];
+                double const c = 1 - r[2];
+                N[i] = 0.125 * a * b * c;
+                dN[i] = {{0.125 * hex_signs[i][0] * b * c,
+                          0.125 * hex_signs[i][1] * a * c,
+                          -0.125 * a * b}};
+            }
+            N[4] = 0.5 * (1 + r[2]);
+            dN[4] = {{0, 0, 0.5}};
+            break;
+        default:
+            N[0] = 1;
+            dN[0] = {{0, 0, 0}};
+    }
+}
+
+/// Natural coordinates of the centre of the reference element.
+std::array<double, 3> getReferenceCentre(MeshLib::MeshElemType const type)
+{
+    switch (type)
+    {
+        case MeshLib::MeshElemType::TRIANGLE:
+            return {{1. / 3, 1. / 3, 0}};
+        case MeshLib::MeshElemType::TETRAHEDRON:
+            return {{0.25, 0.25, 0.25}};
+        case MeshLib::MeshElemType::PRISM:
+            return {{1. / 3, 1. / 3, 0}};
+        default:
+            return {{0, 0, 0}};
+    }
+}
+
+/// Solves the symmetric positive definite system A x = b of size n <= 3 by
+/// Gaussian elimination with partial pivoting.
+/// @return false if the matrix is singular
+bool solveSmallSystem(unsigned const n, std::array<std::array<double, 3>, 3> A,
+                      std::array<double, 3> b, std::array<double, 3>& x)
+{
+    double max_entry = 0;
+    for (unsigned i = 0; i < n; ++i)
+        for (unsigned j = 0; j < n; ++j)
+            max_entry = std::max(max_entry, std::abs(A[i][j]));
+    double const tolerance =
+        max_entry * std::numeric_limits<double>::epsilon() * 16;
+
+    for (unsigned k = 0; k < n; ++k)
+    {
+        unsigned pivot = k;
+        for (unsigned i = k + 1; i < n; ++i)
+            if (std::abs(A[i][k]) > std::abs(A[pivot][k]))
+                pivot = i;
+        if (!(std::abs(A[pivot][k]) > tolerance))
+            return false;
+        std::swap(A[k], A[pivot]);
+        std::swap(b[k], b[pivot]);
+        for (unsigned i = k + 1; i < n; ++i)
+        {
+            double const f = A[i][k] / A[k][k];
+            for (unsigned j = k; j < n; ++j)
+                A[i][j] -= f * A[k][j];
+            b[i] -= f * b[k];
+        }
+    }
+    for (unsigned k = n; k-- > 0;)
+    {
+        double s = b[k];
+        for (unsigned j = k + 1; j < n; ++j)
+            s -= A[k][j] * x[j];
+        x[k] = s / A[k][k];
+    }
+    return true;
+}
+
+double sqrDistPointSegment(MathLib::Point3d const& p, MathLib::Point3d const& a,
+                           MathLib::Point3d const& b)
+{
+    MathLib::Vector3 const ab(a, b);
+    MathLib::Vector3 const ap(a, p);
+    double const sqr_length = ab.getSqrLength();
+    double t = (sqr_length > 0) ? MathLib::scalarProduct(ab, ap) / sqr_length
+                                : 0.0;
+    t = std::max(0.0, std::min(1.0, t));
+    return (ap - ab * t).getSqrLength();
+}
+
+/// Computes the squared distance between p and the closest point of the
+/// triangle (a, b, c), cf. Ericson, Real-Time Collision Detection, 5.1.5.
+double sqrDistPointTriangle(MathLib::Point3d const& p,
+                            MathLib::Point3d const& a,
+                            MathLib::Point3d const& b,
+                            MathLib::Point3d const& c)
+{
+    MathLib::Vector3 const ab(a, b);
+    MathLib::Vector3 const ac(a, c);
+    MathLib::Vector3 const ap(a, p);
+    double const d1 = MathLib::scalarProduct(ab, ap);
+    double const d2 = MathLib::scalarProduct(ac, ap);
+    if (d1 <= 0 && d2 <= 0)
+        return ap.getSqrLength();
+
+    MathLib::Vector3 const bp(b, p);
+    double const d3 = MathLib::scalarProduct(ab, bp);
+    double const d4 = MathLib::scalarProduct(ac, bp);
+    if (d3 >= 0 && d4 <= d3)
+        return bp.getSqrLength();
+
+    double const vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0)
+        return sqrDistPointSegment(p, a, b);
+
+    MathLib::Vector3 const cp(c, p);
+    double const d5 = MathLib::scalarProduct(ab, cp);
+    double const d6 = MathLib::scalarProduct(ac, cp);
+    if (d6 >= 0 && d5 <= d6)
+        return cp.getSqrLength();
+
+    double const vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0)
+        return sqrDistPointSegment(p, a, c);
+
+    double const va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+        return sqrDistPointSegment(p, b, c);
+
+    // the projection of p is located in the interior of the triangle
+    double const denom = va + vb + vc;
+    if (!(denom > 0))  // degenerated triangle
+        return std::min({sqrDistPointSegment(p, a, b),
+                         sqrDistPointSegment(p, a, c),
+                         sqrDistPointSegment(p, b, c)});
+    double const v = vb / denom;
+    double const w = vc / denom;
+    return (ap - ab * v - ac * w).getSqrLength();
+}
+
+/// Squared distance to a triangle or to a quadrilateral split into two
+/// triangles, given by its corner nodes.
+double sqrDistPointPolygon(MathLib::Point3d const& p,
+                           MeshLib::Node* const* nodes,
+                           unsigned const n_nodes)
+{
+    double d = sqrDistPointTriangle(p, *nodes[0], *nodes[1], *nodes[2]);
+    if (n_nodes == 4)
+        d = std::min(d,
+                     sqrDistPointTriangle(p, *nodes[0], *nodes[2], *nodes[3]));
+    return d;
+}
+
+template <typename Box>
+double sqrDistPointBox(MathLib::Point3d const& p, Box const& box)
+{
+    double d = 0;
+    for (unsigned k = 0; k < 3; ++k)
+    {
+        if (p[k] < box.min[k])
+            d += (box.min[k] - p[k]) * (box.min[k] - p[k]);
+        else if (p[k] > box.max[k])
+            d += (p[k] - box.max[k]) * (p[k] - box.max[k]);
+    }
+    return d;
+}
+
+template <typename Box>
+bool containsPoint(Box const& box, MathLib::Point3d const& p, double eps)
+{
+    for (unsigned k = 0; k < 3; ++k)
+        if (p[k] < box.min[k] - eps || p[k] > box.max[k] + eps)
+            return false;
+    return true;
+}
+
+}  // anonymous namespace
+
+namespace MeshLib
+{
+ElementBVH::ElementBVH(MeshLib::Mesh const& mesh)
+    : ElementBVH(mesh.getElements())
+{
+}
+
+ElementBVH::ElementBVH(std::vector<MeshLib::Element*> const& elements)
+{
+    std::size_t const n_elements(elements.size());
+    if (n_elements == 0)
+        return;
+
+    std::vector<BoundingBox> boxes(n_elements);
+    std::vector<std::array<double, 3>> centres(n_elements);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_elements; ++k)
+#else
+    for (std::size_t k = 0; k < n_elements; ++k)
+#endif
+    {
+        Element const& e(*elements[k]);
+        BoundingBox& box(boxes[k]);
+        for (unsigned d = 0; d < 3; ++d)
+            box.min[d] = box.max[d] = (*e.getNode(0))[d];
+        for (unsigned i = 1; i < e.getNumberOfNodes(); ++i)
+            for (unsigned d = 0; d < 3; ++d)
+            {
+                box.min[d] = std::min(box.min[d], (*e.getNode(i))[d]);
+                box.max[d] = std::max(box.max[d], (*e.getNode(i))[d]);
+            }
+        for (unsigned d = 0; d < 3; ++d)
+            centres[k][d] = 0.5 * (box.min[d] + box.max[d]);
+    }
+
+    std::vector<std::size_t> order(n_elements);
+    for (std::size_t k = 0; k < n_elements; ++k)
+        order[k] = k;
+    _tree.reserve(2 * (n_elements / max_leaf_size + 1));
+    buildSubtree(0, n_elements, order, boxes, centres);
+
+    _elements.resize(n_elements);
+    _element_boxes.resize(n_elements);
+    for (std::size_t k = 0; k < n_elements; ++k)
+    {
+        _elements[k] = elements[order[k]];
+        _element_boxes[k] = boxes[order[k]];
+    }
+}
+
+std::size_t ElementBVH::buildSubtree(
+    std::size_t const begin, std::size_t const end,
+    std::vector<std::size_t>& order, std::vector<BoundingBox> const& boxes,
+    std::vector<std::array<double, 3>> const& centres)
+{
+    std::size_t const node_index = _tree.size();
+    _tree.emplace_back();
+    BoundingBox box(boxes[order[begin]]);
+    std::array<double, 3> centre_min(centres[order[begin]]);
+    std::array<double, 3> centre_max(centre_min);
+    for (std::size_t k = begin + 1; k < end; ++k)
+        for (unsigned d = 0; d < 3; ++d)
+        {
+            box.min[d] = std::min(box.min[d], boxes[order[k]].min[d]);
+            box.max[d] = std::max(box.max[d], boxes[order[k]].max[d]);
+            centre_min[d] = std::min(centre_min[d], centres[order[k]][d]);
+            centre_max[d] = std::max(centre_max[d], centres[order[k]][d]);
+        }
+    _tree[node_index].box = box;
+    _tree[node_index].begin = begin;
+    _tree[node_index].end = end;
+    _tree[node_index].second_child = 0;
+    if (end - begin <= max_leaf_size)
+        return node_index;
+
+    unsigned axis = 0;
+    for (unsigned d = 1; d < 3; ++d)
+        if (centre_max[d] - centre_min[d] > centre_max[axis] - centre_min[axis])
+            axis = d;
+    std::size_t const mid = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + mid,
+                     order.begin() + end,
+                     [&centres, axis](std::size_t a, std::size_t b)
+                     {
+                         return centres[a][axis] < centres[b][axis] ||
+                                (centres[a][axis] == centres[b][axis] && a < b);
+                     });
+    buildSubtree(begin, mid, order, boxes, centres);
+    std::size_t const second_child =
+        buildSubtree(mid, end, order, boxes, centres);
+    _tree[node_index].second_child = second_child;
+    return node_index;
+}
+
+std::vector<MeshLib::Element const*> ElementBVH::getElementsInVolume(
+    MathLib::Point3d const& min, MathLib::Point3d const& max) const
+{
+    std::vector<MeshLib::Element const*> result;
+    if (_tree.empty())
+        return result;
+
+    auto const intersects = [&min, &max](BoundingBox const& box) -> bool
+    {
+        for (unsigned d = 0; d < 3; ++d)
+            if (box.max[d] < min[d] || box.min[d] > max[d])
+                return false;
+        return true;
+    };
+
+    std::array<std::size_t, max_depth> stack;
+    std::size_t stack_size = 0;
+    stack[stack_size++] = 0;
+    while (stack_size > 0)
+    {
+        TreeNode const& node(_tree[stack[--stack_size]]);
+        if (!intersects(node.box))
+            continue;
+        if (node.second_child != 0)
+        {
+            stack[stack_size++] = node.second_child;
+            stack[stack_size++] = &node - _tree.data() + 1;
+            continue;
+        }
+        for (std::size_t k = node.begin; k < node.end; ++k)
+            if (intersects(_element_boxes[k]))
+                result.push_back(_elements[k]);
+    }
+    std::sort(result.begin(), result.end(),
+              [](Element const* a, Element const* b)
+              {
+                  return a->getID() < b->getID();
+              });
+    return result;
+}
+
+ElementLocation ElementBVH::locatePoint(MathLib::Point3d const& pnt,
+                                        double const eps) const
+{
+    ElementLocation location;
+    if (_tree.empty())
+        return location;
+
+    std::array<std::size_t, max_depth> stack;
+    std::size_t stack_size = 0;
+    stack[stack_size++] = 0;
+    while (stack_size > 0)
+    {
+        TreeNode const& node(_tree[stack[--stack_size]]);
+        if (!containsPoint(node.box, pnt, eps))
+            continue;
+        if (node.second_child != 0)
+        {
+            stack[stack_size++] = node.second_child;
+            stack[stack_size++] = &node - _tree.data() + 1;
+            continue;
+        }
+        for (std::size_t k = node.begin; k < node.end; ++k)
+        {
+            Element const* const e = _elements[k];
+            if (location.element && location.element->getID() < e->getID())
+                continue;
+            if (containsPoint(_element_boxes[k], pnt, eps) &&
+                e->isPntInElement(pnt, eps))
+                location.element = e;
+        }
+    }
+
+    if (location.element)
+    {
+        location.natural_coordinates =
+            computeNaturalCoordinates(*location.element, pnt);
+        location.distance = 0;
+    }
+    return location;
+}
+
+ElementLocation ElementBVH::findNearestElement(
+    MathLib::Point3d const& pnt) const
+{
+    ElementLocation location;
+    if (_tree.empty())
+        return location;
+
+    double sqr_best = std::numeric_limits<double>::max();
+    std::array<std::size_t, max_depth> stack;
+    std::size_t stack_size = 0;
+    stack[stack_size++] = 0;
+    while (stack_size > 0)
+    {
+        TreeNode const& node(_tree[stack[--stack_size]]);
+        if (sqrDistPointBox(pnt, node.box) > sqr_best)
+            continue;
+        if (node.second_child != 0)
+        {
+            // visit the closer child first
+            std::size_t first = &node - _tree.data() + 1;
+            std::size_t second = node.second_child;
+            if (sqrDistPointBox(pnt, _tree[first].box) >
+                sqrDistPointBox(pnt, _tree[second].box))
+                std::swap(first, second);
+            stack[stack_size++] = second;
+            stack[stack_size++] = first;
+            continue;
+        }
+        for (std::size_t k = node.begin; k < node.end; ++k)
+        {
+            if (sqrDistPointBox(pnt, _element_boxes[k]) > sqr_best)
+                continue;
+            Element const* const e = _elements[k];
+            double const distance = computeDistance(*e, pnt);
+            if (distance < location.distance ||
+                (distance == location.distance && location.element &&
+                 e->getID() < location.element->getID()))
+            {
+                location.element = e;
+                location.distance = distance;
+                sqr_best = distance * distance;
+            }
+        }
+    }
+
+    location.natural_coordinates =
+        computeNaturalCoordinates(*location.element, pnt);
+    return location;
+}
+
+std::vector<ElementLocation> ElementBVH::locatePoints(
+    std::vector<MathLib::Point3d> const& pnts, double const eps) const
+{
+    std::size_t const n_pnts(pnts.size());
+    std::vector<ElementLocation> locations(n_pnts);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_pnts; ++k)
+#else
+    for (std::size_t k = 0; k < n_pnts; ++k)
+#endif
+        locations[k] = locatePoint(pnts[k], eps);
+    return locations;
+}
+
+std::vector<ElementLocation> ElementBVH::findNearestElements(
+    std::vector<MathLib::Point3d> const& pnts) const
+{
+    std::size_t const n_pnts(pnts.size());
+    std::vector<ElementLocation> locations(n_pnts);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_pnts; ++k)
+#else
+    for (std::size_t k = 0; k < n_pnts; ++k)
+#endif
+        locations[k] = findNearestElement(pnts[k]);
+    return locations;
+}
+
+std::array<double, 3> computeNaturalCoordinates(MeshLib::Element const& e,
+                                                MathLib::Point3d const& pnt)
+{
+    MeshElemType const type(e.getGeomType());
+    unsigned const dim(e.getDimension());
+    unsigned const n_nodes(e.getNumberOfBaseNodes());
+    std::array<double, 3> r(getReferenceCentre(type));
+    if (dim == 0)
+        return r;
+
+    std::array<double, 8> N;
+    std::array<std::array<double, 3>, 8> dN;
+    // Gauss-Newton iterations minimising |x(r) - pnt|; for cells and affine
+    // elements this is Newton's method for x(r) = pnt.
+    for (unsigned iteration = 0; iteration < 25; ++iteration)
+    {
+        computeLinearShapeFunctions(type, r, N, dN);
+        std::array<double, 3> residual = {{pnt[0], pnt[1], pnt[2]}};
+        std::array<std::array<double, 3>, 3> J = {};  // J[spatial][natural]
+        for (unsigned i = 0; i < n_nodes; ++i)
+        {
+            Node const& node(*e.getNode(i));
+            for (unsigned d = 0; d < 3; ++d)
+            {
+                residual[d] -= N[i] * node[d];
+                for (unsigned j = 0; j < dim; ++j)
+                    J[d][j] += node[d] * dN[i][j];
+            }
+        }
+
+        std::array<std::array<double, 3>, 3> JtJ = {};
+        std::array<double, 3> Jtr = {};
+        for (unsigned i = 0; i < dim; ++i)
+        {
+            for (unsigned j = 0; j < dim; ++j)
+                for (unsigned d = 0; d < 3; ++d)
+                    JtJ[i][j] += J[d][i] * J[d][j];
+            for (unsigned d = 0; d < 3; ++d)
+                Jtr[i] += J[d][i] * residual[d];
+        }
+        std::array<double, 3> delta = {};
+        if (!solveSmallSystem(dim, JtJ, Jtr, delta))
+            break;
+
+        double max_delta = 0;
+        for (unsigned j = 0; j < dim; ++j)
+        {
+            r[j] += delta[j];
+            max_delta = std::max(max_delta, std::abs(delta[j]));
+        }
+        if (max_delta < 1e-13)
+            break;
+    }
+    return r;
+}
+
+double computeDistance(MeshLib::Element const& e, MathLib::Point3d const& pnt)
+{
+    switch (e.getDimension())
+    {
+        case 0:
+            return std::sqrt(MathLib::sqrDist(pnt, *e.getNode(0)));
+        case 1:
+            return std::sqrt(
+                sqrDistPointSegment(pnt, *e.getNode(0), *e.getNode(1)));
+        case 2:
+            return std::sqrt(sqrDistPointPolygon(pnt, e.getNodes(),
+                                                 e.getNumberOfBaseNodes()));
+        default:
+        {
+            if (e.isPntInElement(pnt))
+                return 0.0;
+            double d = std::numeric_limits<double>::max();
+            for (unsigned i = 0; i < e.getNumberOfFaces(); ++i)
+            {
+                BoundaryView const face(e.getFaceView(i));
+                d = std::min(d, sqrDistPointPolygon(pnt, face.getNodes(),
+                                                    face.getNumberOfBaseNodes()));
+            }
+            return std::sqrt(d);
+        }
+    }
+}
+
+}  // namespace MeshLib
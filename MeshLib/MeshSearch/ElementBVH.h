@@ -0,0 +1,141 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef ELEMENTBVH_H_
+#define ELEMENTBVH_H_
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "MathLib/Point3d.h"
+
+namespace MeshLib
+{
+class Element;
+class Mesh;
+
+/// Result of a point location query.
+struct ElementLocation
+{
+    /// The found element or nullptr if no element was found.
+    Element const* element = nullptr;
+    /// The natural coordinates of the point with respect to the linear
+    /// geometry of the element. Unused components are zero.
+    std::array<double, 3> natural_coordinates = {{0.0, 0.0, 0.0}};
+    /// The distance between the point and the element; zero if the point is
+    /// located in the element.
+    double distance = std::numeric_limits<double>::max();
+};
+
+/**
+ * Bounding volume hierarchy over the elements of a mesh of arbitrary
+ * dimension. The axis aligned bounding boxes of the elements are stored in a
+ * binary tree that is built by splitting the element set at the median of
+ * the element centres along the longest extent. A query visits only the
+ * subtrees whose bounding boxes are close to the query point.
+ *
+ * The queries are const and can be called concurrently; the batched versions
+ * process the points in parallel if OpenMP is enabled.
+ * @attention The user has to ensure the validity of the mesh while the
+ * ElementBVH instance lives.
+ */
+class ElementBVH final
+{
+public:
+    /// Builds the hierarchy over all elements of the given mesh.
+    explicit ElementBVH(MeshLib::Mesh const& mesh);
+
+    /// Builds the hierarchy over the given elements.
+    explicit ElementBVH(std::vector<MeshLib::Element*> const& elements);
+
+    /// Returns the elements whose bounding boxes intersect the box given by
+    /// \c min and \c max, sorted by their ids.
+    std::vector<MeshLib::Element const*> getElementsInVolume(
+        MathLib::Point3d const& min, MathLib::Point3d const& max) const;
+
+    /// Searches the element containing the point \c pnt, see
+    /// Element::isPntInElement(). If the point is located in several elements,
+    /// e.g. on a common face, the element with the smallest id is returned.
+    /// @return the location of the point, whose element is nullptr if no
+    /// element contains the point
+    ElementLocation locatePoint(
+        MathLib::Point3d const& pnt,
+        double eps = std::numeric_limits<double>::epsilon()) const;
+
+    /// Searches the element with the smallest distance to the point \c pnt.
+    /// Elements containing the point have the distance zero. The distance to
+    /// a cell is the distance to its faces, where quadrilaterals are split
+    /// into two triangles. Ties are broken by the smallest element id.
+    ElementLocation findNearestElement(MathLib::Point3d const& pnt) const;
+
+    /// Batched version of locatePoint().
+    std::vector<ElementLocation> locatePoints(
+        std::vector<MathLib::Point3d> const& pnts,
+        double eps = std::numeric_limits<double>::epsilon()) const;
+
+    /// Batched version of findNearestElement().
+    std::vector<ElementLocation> findNearestElements(
+        std::vector<MathLib::Point3d> const& pnts) const;
+
+    /// Returns the number of elements in the hierarchy.
+    std::size_t size() const { return _elements.size(); }
+
+private:
+    struct BoundingBox
+    {
+        std::array<double, 3> min;
+        std::array<double, 3> max;
+    };
+
+    struct TreeNode
+    {
+        BoundingBox box;
+        /// Range of the elements of a leaf in _elements.
+        std::size_t begin;
+        std::size_t end;
+        /// Index of the second child of an inner node; the first child is
+        /// stored directly behind its parent. Zero for leaves.
+        std::size_t second_child;
+    };
+
+    /// Recursively builds the subtree of the elements order[begin:end] and
+    /// returns the index of its root in _tree.
+    std::size_t buildSubtree(std::size_t begin, std::size_t end,
+                             std::vector<std::size_t>& order,
+                             std::vector<BoundingBox> const& boxes,
+                             std::vector<std::array<double, 3>> const& centres);
+
+    /// Elements in the order of the leaves.
+    std::vector<MeshLib::Element const*> _elements;
+    /// Bounding boxes of the elements in the order of _elements.
+    std::vector<BoundingBox> _element_boxes;
+    std::vector<TreeNode> _tree;
+};
+
+/**
+ * Computes the natural coordinates of the point \c pnt with respect to the
+ * element by inverting the isoparametric mapping of the element's base nodes
+ * by Newton iterations, using the node numbering and reference elements of
+ * the shape functions in NumLib. For elements whose dimension is smaller
+ * than three, the point is projected onto the element in the least squares
+ * sense. Points outside of the element give natural coordinates outside of
+ * the reference element.
+ */
+std::array<double, 3> computeNaturalCoordinates(MeshLib::Element const& e,
+                                                MathLib::Point3d const& pnt);
+
+/// Computes the distance between the point and the element, which is zero if
+/// the point is located in the element; cf. ElementBVH::findNearestElement().
+double computeDistance(MeshLib::Element const& e, MathLib::Point3d const& pnt);
+
+}  // namespace MeshLib
+
+#endif  // ELEMENTBVH_H_
@@ -14,17 +14,56 @@
 
 #include "MeshSurfaceExtraction.h"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
 #include <boost/math/constants/constants.hpp>
 
 #include <logog/include/logog.hpp>
 
 #include "MeshLib/Mesh.h"
-#include "MeshLib/Elements/Line.h"
+#include "MeshLib/Node.h"
 #include "MeshLib/Elements/Tri.h"
 #include "MeshLib/Elements/Quad.h"
-#include "MeshLib/MeshEditing/DuplicateMeshComponents.h"
-#include "MeshLib/MeshSearch/NodeSearch.h"
-#include "MeshLib/MeshEditing/RemoveMeshComponents.h"
+
+namespace
+{
+/// The sorted ids of the corner nodes of a face; unused entries are set to
+/// the maximal value.
+using FaceKey = std::array<std::size_t, 4>;
+
+struct FaceRecord
+{
+    FaceKey key;
+    MeshLib::BoundaryFace face;
+};
+
+FaceKey getFaceKey(MeshLib::BoundaryView const& view)
+{
+    FaceKey key;
+    key.fill(std::numeric_limits<std::size_t>::max());
+    unsigned const n_base_nodes(view.getNumberOfBaseNodes());
+    for (unsigned i = 0; i < n_base_nodes; ++i)
+        key[i] = view.getNode(i)->getID();
+    std::sort(key.begin(), key.begin() + n_base_nodes);
+    return key;
+}
+
+/// FNV-1a hash of the node ids.
+std::uint64_t hashFaceKey(FaceKey const& key)
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    for (auto const id : key)
+    {
+        hash ^= id;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+}  // anonymous namespace
 
 namespace MeshLib {
 
@@ -132,39 +171,76 @@ MeshLib::Mesh* MeshSurfaceExtraction::getMeshBoundary(const MeshLib::Mesh &mesh)
     if (mesh.getDimension()==1)
         return nullptr;
 
-    // For 3D meshes return the 2D surface
-    if (mesh.getDimension()==3)
+    std::vector<BoundaryFace> const boundary_faces(getBoundaryFaces(mesh));
+    std::vector<MeshLib::Element*> const& bulk_elements(mesh.getElements());
+    bool const use_edges(mesh.getDimension() == 2);
+    auto const getView = [&](BoundaryFace const& face) -> MeshLib::BoundaryView
     {
-        MathLib::Vector3 dir(0,0,0);
-        return getMeshSurface(mesh, dir, 90);
+        MeshLib::Element const& bulk_element(*bulk_elements[face.element_id]);
+        return use_edges ? bulk_element.getEdgeView(face.face_id)
+                         : bulk_element.getFaceView(face.face_id);
+    };
+
+    // The boundary nodes keep the order of the bulk nodes.
+    std::vector<MeshLib::Node*> const& bulk_nodes(mesh.getNodes());
+    std::vector<char> is_boundary_node(bulk_nodes.size(), false);
+    for (auto const& face : boundary_faces)
+    {
+        MeshLib::BoundaryView const view(getView(face));
+        for (unsigned i = 0; i < view.getNumberOfNodes(); ++i)
+            is_boundary_node[view.getNode(i)->getID()] = true;
     }
-
-    // For 2D meshes return the boundary lines
-    std::vector<MeshLib::Node*> nodes = MeshLib::copyNodeVector(mesh.getNodes());
-    std::vector<MeshLib::Element*> boundary_elements;
-
-    std::vector<MeshLib::Element*> const& org_elems (mesh.getElements());
-    for (auto it=org_elems.begin(); it!=org_elems.end(); ++it)
+    std::vector<std::size_t> bulk_node_ids;
+    for (std::size_t k = 0; k < bulk_nodes.size(); ++k)
+        if (is_boundary_node[k])
+            bulk_node_ids.push_back(k);
+
+    std::size_t const n_boundary_nodes(bulk_node_ids.size());
+    std::vector<MeshLib::Node*> nodes(n_boundary_nodes);
+    // boundary nodes at the positions of the bulk node ids
+    std::vector<MeshLib::Node*> bulk_id_to_node(bulk_nodes.size(), nullptr);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_boundary_nodes; ++k)
+#else
+    for (std::size_t k = 0; k < n_boundary_nodes; ++k)
+#endif
     {
-        MeshLib::Element* elem (*it);
-        std::size_t const n_edges (elem->getNumberOfEdges());
-        for (std::size_t i=0; i<n_edges; ++i)
-            if (elem->getNeighbor(i) == nullptr)
-            {
-                MeshLib::Element const*const edge (elem->getEdge(i));
-                boundary_elements.push_back(MeshLib::copyElement(edge, nodes));
-                delete edge;
-            }
+        MeshLib::Node const& bulk_node(*bulk_nodes[bulk_node_ids[k]]);
+        nodes[k] = new MeshLib::Node(bulk_node[0], bulk_node[1], bulk_node[2], k);
+        bulk_id_to_node[bulk_node_ids[k]] = nodes[k];
     }
-    MeshLib::Mesh* result = new MeshLib::Mesh("Boundary Mesh", nodes, boundary_elements);
-    MeshLib::NodeSearch ns(*result);
-    if (ns.searchUnused() == 0) {
-        return result;
-    } else {
-        auto removed = MeshLib::removeNodes(*result, ns.getSearchedNodeIDs(), result->getName());
-        delete result;
-        return removed;
+
+    std::size_t const n_boundary_elements(boundary_faces.size());
+    std::vector<MeshLib::Element*> elements(n_boundary_elements);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_boundary_elements; ++k)
+#else
+    for (std::size_t k = 0; k < n_boundary_elements; ++k)
+#endif
+        elements[k] = getView(boundary_faces[k]).createElement(bulk_id_to_node);
+
+    MeshLib::Properties properties;
+    auto bulk_node_id_property = properties.createNewPropertyVector<std::size_t>(
+        "bulk_node_ids", MeshLib::MeshItemType::Node, 1);
+    bulk_node_id_property->resize(n_boundary_nodes);
+    std::copy(bulk_node_ids.cbegin(), bulk_node_ids.cend(),
+              bulk_node_id_property->begin());
+    auto bulk_element_id_property = properties.createNewPropertyVector<std::size_t>(
+        "bulk_element_ids", MeshLib::MeshItemType::Cell, 1);
+    auto bulk_face_id_property = properties.createNewPropertyVector<std::size_t>(
+        "bulk_face_ids", MeshLib::MeshItemType::Cell, 1);
+    bulk_element_id_property->reserve(n_boundary_elements);
+    bulk_face_id_property->reserve(n_boundary_elements);
+    for (auto const& face : boundary_faces)
+    {
+        bulk_element_id_property->push_back(face.element_id);
+        bulk_face_id_property->push_back(face.face_id);
     }
+
+    return new MeshLib::Mesh(mesh.getName() + "-Boundary", nodes, elements,
+                             properties);
 }
 
 void MeshSurfaceExtraction::get2DSurfaceElements(const std::vector<MeshLib::Element*> &all_elements, std::vector<MeshLib::Element*> &sfc_elements, const MathLib::Vector3 &dir, double angle, unsigned mesh_dimension)
@@ -204,18 +280,21 @@ void MeshSurfaceExtraction::get2DSurfaceElements(const std::vector<MeshLib::Elem
                 if ((*elem)->getNeighbor(j) != nullptr)
                     continue;
 
-                auto const face = std::unique_ptr<MeshLib::Element const>{(*elem)->getFace(j)};
+                MeshLib::BoundaryView const face((*elem)->getFaceView(j));
                 if (!complete_surface)
                 {
-                    if (MathLib::scalarProduct(FaceRule::getSurfaceNormal(face.get()).getNormalizedVector(), norm_dir) < cos_theta)
+                    if (MathLib::scalarProduct(FaceRule::getSurfaceNormal(face.getNodes()).getNormalizedVector(), norm_dir) < cos_theta)
                     {
                         continue;
                     }
                 }
-                if (face->getGeomType() == MeshElemType::TRIANGLE)
-                    sfc_elements.push_back(new MeshLib::Tri(*static_cast<const MeshLib::Tri*>(face.get())));
+                // The surface consists of linear elements only.
+                if (face.getGeomType() == MeshElemType::TRIANGLE)
+                    sfc_elements.push_back(new MeshLib::Tri(std::array<MeshLib::Node*, 3>{
+                        {face.getNode(0), face.getNode(1), face.getNode(2)}}));
                 else
-                    sfc_elements.push_back(new MeshLib::Quad(*static_cast<const MeshLib::Quad*>(face.get())));
+                    sfc_elements.push_back(new MeshLib::Quad(std::array<MeshLib::Node*, 4>{
+                        {face.getNode(0), face.getNode(1), face.getNode(2), face.getNode(3)}}));
             }
         }
     }
@@ -265,4 +344,108 @@ std::vector<MeshLib::Node*> MeshSurfaceExtraction::getSurfaceNodes(
     return sfc_nodes;
 }
 
+std::vector<BoundaryFace> getBoundaryFaces(MeshLib::Mesh const& mesh)
+{
+    unsigned const dimension(mesh.getDimension());
+    std::vector<MeshLib::Element*> const& elements(mesh.getElements());
+    std::size_t const n_elements(elements.size());
+
+    // The faces of the elements of the mesh dimension, i.e. the edges in
+    // case of 2D meshes, are stored element by element.
+    auto const getNumberOfFaces = [dimension](MeshLib::Element const& e) -> unsigned
+    {
+        if (e.getDimension() != dimension)
+            return 0;
+        return (dimension == 2) ? e.getNumberOfEdges() : e.getNumberOfFaces();
+    };
+    std::vector<std::size_t> record_offsets(n_elements + 1, 0);
+    for (std::size_t k = 0; k < n_elements; ++k)
+        record_offsets[k + 1] = record_offsets[k] + getNumberOfFaces(*elements[k]);
+    std::size_t const n_records(record_offsets.back());
+
+    std::vector<FaceRecord> records(n_records);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_elements; ++k)
+#else
+    for (std::size_t k = 0; k < n_elements; ++k)
+#endif
+    {
+        MeshLib::Element const& e(*elements[k]);
+        unsigned const n_faces(getNumberOfFaces(e));
+        for (unsigned i = 0; i < n_faces; ++i)
+        {
+            FaceRecord& record(records[record_offsets[k] + i]);
+            record.key = getFaceKey((dimension == 2) ? e.getEdgeView(i)
+                                                     : e.getFaceView(i));
+            record.face = {static_cast<std::size_t>(k), i};
+        }
+    }
+
+    // Distribute the records to buckets by the hash of their keys, such
+    // that equal faces are found in the same bucket.
+    std::size_t n_buckets = 1;
+    while (n_buckets * 1024 < n_records && n_buckets < 4096)
+        n_buckets *= 2;
+    std::vector<std::size_t> record_bucket(n_records);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_records; ++k)
+#else
+    for (std::size_t k = 0; k < n_records; ++k)
+#endif
+        record_bucket[k] = hashFaceKey(records[k].key) & (n_buckets - 1);
+
+    std::vector<std::size_t> bucket_begin(n_buckets + 1, 0);
+    for (auto const b : record_bucket)
+        ++bucket_begin[b + 1];
+    std::partial_sum(bucket_begin.begin(), bucket_begin.end(),
+                     bucket_begin.begin());
+    std::vector<FaceRecord> bucketed_records(n_records);
+    {
+        std::vector<std::size_t> position(bucket_begin.begin(),
+                                          bucket_begin.end() - 1);
+        for (std::size_t k = 0; k < n_records; ++k)
+            bucketed_records[position[record_bucket[k]]++] = records[k];
+    }
+    std::vector<FaceRecord>().swap(records);
+
+    // Within each bucket the records are sorted by key; a face is on the
+    // boundary if its key occurs only once.
+    std::vector<char> is_boundary(n_records, false);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic)
+    for (OPENMP_LOOP_TYPE b = 0; b < n_buckets; ++b)
+#else
+    for (std::size_t b = 0; b < n_buckets; ++b)
+#endif
+    {
+        auto const begin = bucketed_records.begin() + bucket_begin[b];
+        auto const end = bucketed_records.begin() + bucket_begin[b + 1];
+        std::sort(begin, end, [](FaceRecord const& a, FaceRecord const& b)
+                  {
+                      return a.key < b.key;
+                  });
+        for (auto it = begin; it != end; ++it)
+        {
+            bool const equals_previous(it != begin && (it - 1)->key == it->key);
+            bool const equals_next(it + 1 != end && (it + 1)->key == it->key);
+            is_boundary[it - bucketed_records.begin()] =
+                !equals_previous && !equals_next;
+        }
+    }
+
+    std::vector<BoundaryFace> boundary_faces;
+    for (std::size_t k = 0; k < n_records; ++k)
+        if (is_boundary[k])
+            boundary_faces.push_back(bucketed_records[k].face);
+    std::sort(boundary_faces.begin(), boundary_faces.end(),
+              [](BoundaryFace const& a, BoundaryFace const& b)
+              {
+                  return a.element_id < b.element_id ||
+                         (a.element_id == b.element_id && a.face_id < b.face_id);
+              });
+    return boundary_faces;
+}
+
 } // end namespace MeshLib
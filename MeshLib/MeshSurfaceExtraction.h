@@ -26,6 +26,23 @@ class Mesh;
 class Element;
 class Node;
 
+/// A face of a bulk element given by the element id and the local face id,
+/// which is the local edge id in case of 2D elements.
+struct BoundaryFace
+{
+    std::size_t element_id;
+    unsigned face_id;
+};
+
+/**
+ * Returns the faces of the elements of the mesh dimension which are not
+ * shared with another element, i.e. the faces of 3D elements or the edges of
+ * 2D elements. The faces are matched by a hash of their sorted corner node
+ * ids, the element neighbours are not used. The work is done in parallel if
+ * OpenMP is enabled. The result is sorted by element id and face id.
+ */
+std::vector<BoundaryFace> getBoundaryFaces(Mesh const& mesh);
+
 /**
  * \brief A set of tools concerned with extracting nodes and elements from a mesh surface
  */
@@ -60,8 +77,16 @@ public:
 
     /**
      * Returns the boundary of mesh, i.e. lines for 2D meshes and surfaces for 3D meshes.
-     * Note, that this method also returns inner boundaries and might give unexpected results
-     * when the mesh geometry is not strict (e.g. more than two triangles sharing an edge).
+     * Note, that this method also returns inner boundaries. A face belongs to
+     * the boundary if it is a face of exactly one element, i.e. faces shared
+     * by more than two elements are not part of the boundary either. The
+     * boundary elements have the same order (linear or quadratic) as the
+     * bulk elements; see getBoundaryFaces() for the face detection.
+     *
+     * The boundary mesh has the properties "bulk_node_ids" (on nodes),
+     * "bulk_element_ids" and "bulk_face_ids" (on cells) mapping the boundary
+     * nodes and elements to the nodes, the elements and their local faces
+     * (edges for 2D meshes) in the original mesh.
      * \param mesh The original mesh of dimension d
      * \return     A mesh of dimension (d-1) representing the boundary of the mesh.
      */
@@ -13,6 +13,9 @@
  */
 
 #include "MeshLib/Node.h"
+
+#include <algorithm>
+
 #include "Elements/Element.h"
 
 namespace MeshLib {
@@ -49,5 +52,32 @@ void Node::updateCoordinates(double x, double y, double z)
         _elements[i]->computeVolume();
 }
 
+void Node::computeConnectedNodes() const
+{
+    std::size_t n_adjacent_nodes = 0;
+    for (Element const* const element : _elements)
+        n_adjacent_nodes += element->getNumberOfBaseNodes();
+
+    _connected_nodes.clear();
+    _connected_nodes.reserve(n_adjacent_nodes);
+    for (Element const* const element : _elements)
+    {
+        Node* const* const element_nodes = element->getNodes();
+        std::size_t const n_nodes = element->getNumberOfBaseNodes();
+        _connected_nodes.insert(_connected_nodes.end(), element_nodes,
+                                element_nodes + n_nodes);
+    }
+
+    // Make nodes unique and sorted by their ids.
+    std::sort(_connected_nodes.begin(), _connected_nodes.end(),
+              [](Node const* a, Node const* b) {
+                  return a->getID() < b->getID();
+              });
+    auto const last =
+        std::unique(_connected_nodes.begin(), _connected_nodes.end());
+    _connected_nodes.erase(last, _connected_nodes.end());
+    _connected_nodes_set = true;
+}
+
 }
 
@@ -41,6 +41,7 @@ class Node final : public MathLib::Point3dWithID
     friend class NodePartitionedMesh;
     friend class MeshRevision;
     friend class MeshLayerMapper;
+    friend class MeshInformation;
     friend class ApplicationUtils::NodeWiseMeshPartitioner;
 
 public:
@@ -56,8 +57,17 @@ public:
     /// Copy constructor
     Node(const Node &node);
 
-    /// Return all the nodes connected to this one
-    const std::vector<MeshLib::Node*>& getConnectedNodes() const { return _connected_nodes; }
+    /// Return all the nodes connected to this one.
+    /// Unless set explicitly, e.g. by Mesh::setNodesConnectedByElements(),
+    /// the connected nodes are computed from the elements of this node on
+    /// first call.
+    /// \attention The first call is not thread-safe.
+    const std::vector<MeshLib::Node*>& getConnectedNodes() const
+    {
+        if (!_connected_nodes_set)
+            computeConnectedNodes();
+        return _connected_nodes;
+    }
 
     /// Get an element the node is part of.
     const Element* getElement(std::size_t idx) const { return _elements[idx]; }
@@ -83,10 +93,18 @@ protected:
      * Add an element the node is part of.
      * This method is called by Mesh::addElement(Element*), see friend definition.
      */
-    void addElement(Element* elem) { _elements.push_back(elem); }
+    void addElement(Element* elem)
+    {
+        _elements.push_back(elem);
+        _connected_nodes_set = false;
+    }
 
     /// clear stored elements connecting to this node
-    void clearElements() { _elements.clear(); }
+    void clearElements()
+    {
+        _elements.clear();
+        _connected_nodes_set = false;
+    }
 
     /// Resets the connected nodes of this node. The connected nodes are
     /// generated by Mesh::setNodesConnectedByEdges() and
@@ -94,12 +112,17 @@ protected:
     void setConnectedNodes(std::vector<Node*> &connected_nodes)
     {
         _connected_nodes = connected_nodes;
+        _connected_nodes_set = true;
     }
 
+    /// Collects the base nodes of all elements of this node, sorted by ids.
+    void computeConnectedNodes() const;
+
     /// Sets the ID of a node to the given value.
     void setID(std::size_t id) { _id = id; }
 
-    std::vector<Node*> _connected_nodes;
+    mutable std::vector<Node*> _connected_nodes;
+    mutable bool _connected_nodes_set = false;
     std::vector<Element*> _elements;
 }; /* class */
 
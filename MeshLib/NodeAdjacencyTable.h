@@ -27,8 +27,8 @@ namespace MeshLib
 /// This information is represented by the NodeAdjacenceTable.
 ///
 /// The topological adjacency of nodes is created by
-/// Mesh::setNodesConnectedByElements() which is usually called upon mesh
-/// construction.
+/// Mesh::setNodesConnectedByElements() or on first use of
+/// Node::getConnectedNodes().
 class
 NodeAdjacencyTable
 {
@@ -39,24 +39,10 @@ class NodePartitionedMesh : public Mesh
               _n_active_base_nodes(mesh.getNumberOfBaseNodes()),
               _n_active_nodes(mesh.getNumberOfNodes())
         {
-            const auto& mesh_nodes = mesh.getNodes();
+            // The connected nodes of the copied nodes are computed on first
+            // use from the copied elements.
             for (std::size_t i = 0; i < _nodes.size(); i++)
-            {
                 _global_node_ids[i] = _nodes[i]->getID();
-
-                // TODO To add copying of the connected nodes (and elements)
-                //      in the copy constructor of class Node in order to
-                //      drop the following lines.
-                auto node = _nodes[i];
-                // Copy constructor of Mesh does not copy the connected
-                // nodes to node.
-                if (node->_connected_nodes.size() == 0)
-                {
-                    std::copy(mesh_nodes[i]->_connected_nodes.begin(),
-                              mesh_nodes[i]->_connected_nodes.end(),
-                              std::back_inserter(node->_connected_nodes));
-                }
-            }
         }
 
         /*!
@@ -142,21 +128,6 @@ class NodePartitionedMesh : public Mesh
             return _n_base_nodes + _n_active_nodes - _n_active_base_nodes;
         }
 
-        // TODO I guess that is a simplified version of computeSparsityPattern()
-        /// Get the maximum number of connected nodes to node.
-        std::size_t getMaximumNConnectedNodesToNode() const
-        {
-            std::vector<Node *>::const_iterator it_max_ncn = std::max_element(
-                _nodes.cbegin(), _nodes.cend(),
-                [](Node const *const node_a, Node const *const node_b)
-                {
-                    return (node_a->getConnectedNodes().size() <
-                            node_b->getConnectedNodes().size());
-                });
-            // Return the number of connected nodes +1 for the node itself.
-            return (*it_max_ncn)->getConnectedNodes().size() + 1;
-        }
-
     private:
         /// Global IDs of nodes of a partition
         std::vector<std::size_t> _global_node_ids;
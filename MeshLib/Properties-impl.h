@@ -17,7 +17,7 @@ Properties::createNewPropertyVector(std::string const& name,
     MeshItemType mesh_item_type,
     std::size_t n_components)
 {
-    std::map<std::string, PropertyVectorBase*>::const_iterator it(
+    auto const it(
         _properties.find(name)
     );
     if (it != _properties.end()) {
@@ -28,12 +28,13 @@ Properties::createNewPropertyVector(std::string const& name,
     auto entry_info(
         _properties.insert(
             std::make_pair(
-                name, new PropertyVector<T>(name, mesh_item_type, n_components)
+                name, std::shared_ptr<PropertyVectorBase>(
+                    new PropertyVector<T>(name, mesh_item_type, n_components))
             )
         )
     );
     return boost::optional<PropertyVector<T> &>(*(
-            static_cast<PropertyVector<T>*>((entry_info.first)->second)
+            static_cast<PropertyVector<T>*>((entry_info.first)->second.get())
         )
     );
 }
@@ -48,7 +49,7 @@ Properties::createNewPropertyVector(std::string const& name,
 {
     // check if there is already a PropertyVector with the same name and
     // mesh_item_type
-    std::map<std::string, PropertyVectorBase*>::const_iterator it(
+    auto const it(
         _properties.find(name)
     );
     if (it != _properties.end()) {
@@ -68,22 +69,23 @@ Properties::createNewPropertyVector(std::string const& name,
 
     auto entry_info(
         _properties.insert(
-            std::pair<std::string, PropertyVectorBase*>(
+            std::make_pair(
                 name,
-                new PropertyVector<T>(n_prop_groups,
-                    item2group_mapping, name, mesh_item_type, n_components)
+                std::shared_ptr<PropertyVectorBase>(
+                    new PropertyVector<T>(n_prop_groups,
+                        item2group_mapping, name, mesh_item_type, n_components))
             )
         )
     );
     return boost::optional<PropertyVector<T> &>
-        (*(static_cast<PropertyVector<T>*>((entry_info.first)->second)));
+        (*(static_cast<PropertyVector<T>*>((entry_info.first)->second.get())));
 }
 
 template <typename T>
 boost::optional<PropertyVector<T> const&>
 Properties::getPropertyVector(std::string const& name) const
 {
-    std::map<std::string, PropertyVectorBase*>::const_iterator it(
+    auto const it(
         _properties.find(name)
     );
     if (it == _properties.end()) {
@@ -92,7 +94,7 @@ Properties::getPropertyVector(std::string const& name) const
         return boost::optional<PropertyVector<T> const&>();
     }
 
-    PropertyVector<T> const* t=dynamic_cast<PropertyVector<T>const*>(it->second);
+    PropertyVector<T> const* t=dynamic_cast<PropertyVector<T>const*>(it->second.get());
     if (!t) {
         return boost::optional<PropertyVector<T> const&>();
     }
@@ -101,9 +103,9 @@ Properties::getPropertyVector(std::string const& name) const
 
 template <typename T>
 boost::optional<PropertyVector<T>&>
-Properties::getPropertyVector(std::string const& name)
+Properties::getMutablePropertyVector(std::string const& name)
 {
-    std::map<std::string, PropertyVectorBase*>::iterator it(
+    auto it(
         _properties.find(name)
     );
     if (it == _properties.end()) {
@@ -112,10 +114,12 @@ Properties::getPropertyVector(std::string const& name)
         return boost::optional<PropertyVector<T>&>();
     }
 
-    PropertyVector<T> *t=dynamic_cast<PropertyVector<T>*>(it->second);
-    if (!t) {
+    if (!dynamic_cast<PropertyVector<T>*>(it->second.get())) {
         return boost::optional<PropertyVector<T> &>();
     }
-    return *t;
+    // copy on write: the vector could be modified through the returned
+    // reference, hence it is detached from other Properties objects first
+    detachPropertyVector(it->second);
+    return *static_cast<PropertyVector<T>*>(it->second.get());
 }
 
@@ -18,29 +18,39 @@ namespace MeshLib
 
 void Properties::removePropertyVector(std::string const& name)
 {
-    std::map<std::string, PropertyVectorBase*>::const_iterator it(
-        _properties.find(name)
-    );
+    auto const it(_properties.find(name));
     if (it == _properties.end()) {
         WARN("A property of the name \"%s\" does not exist.",
             name.c_str());
         return;
     }
-    delete it->second;
     _properties.erase(it);
 }
 
 bool Properties::hasPropertyVector(std::string const& name) const
 {
-    std::map<std::string, PropertyVectorBase*>::const_iterator it(
-        _properties.find(name)
-    );
+    auto const it(_properties.find(name));
     if (it == _properties.end()) {
         return false;
     }
     return true;
 }
 
+bool Properties::isSharedPropertyVector(std::string const& name) const
+{
+    auto const it(_properties.find(name));
+    return it != _properties.end() && it->second.use_count() > 1;
+}
+
+void Properties::detachPropertyVector(
+    std::shared_ptr<PropertyVectorBase>& property_vector)
+{
+    if (property_vector.use_count() == 1)
+        return;
+    std::vector<std::size_t> const exclude_positions;
+    property_vector.reset(property_vector->clone(exclude_positions));
+}
+
 std::vector<std::string> Properties::getPropertyVectorNames() const
 {
     std::vector<std::string> names;
@@ -49,44 +59,64 @@ std::vector<std::string> Properties::getPropertyVectorNames() const
     return names;
 }
 
+std::size_t Properties::getMemoryUsage() const
+{
+    std::size_t bytes = 0;
+    for (auto p : _properties)
+        bytes += p.second->getMemoryUsage();
+    return bytes;
+}
+
 Properties Properties::excludeCopyProperties(
     std::vector<std::size_t> const& exclude_elem_ids,
     std::vector<std::size_t> const& exclude_node_ids) const
 {
     Properties exclude_copy;
-    for (auto property_vector : _properties) {
-        if (property_vector.second->getMeshItemType() == MeshItemType::Cell) {
-            exclude_copy._properties.insert(
-                std::make_pair(property_vector.first,
-                property_vector.second->clone(exclude_elem_ids))
-            );
-        }
+    for (auto const& property_vector : _properties) {
+        std::vector<std::size_t> const* exclude_ids = nullptr;
+        if (property_vector.second->getMeshItemType() == MeshItemType::Cell)
+            exclude_ids = &exclude_elem_ids;
         else if (property_vector.second->getMeshItemType() == MeshItemType::Node)
-        {
-            exclude_copy._properties.insert(
-                std::make_pair(property_vector.first,
-                property_vector.second->clone(exclude_node_ids))
-            );
-        }
+            exclude_ids = &exclude_node_ids;
+        else
+            continue;
+
+        if (exclude_ids->empty())
+            exclude_copy._properties.insert(property_vector);
+        else
+            exclude_copy._properties.insert(std::make_pair(
+                property_vector.first,
+                std::shared_ptr<PropertyVectorBase>(
+                    property_vector.second->clone(*exclude_ids))));
     }
     return exclude_copy;
 }
 
-Properties::Properties(Properties const& properties)
-    : _properties(properties._properties)
+Properties Properties::permuteCopyProperties(
+    std::vector<std::size_t> const& new_to_old_elem_ids,
+    std::vector<std::size_t> const& new_to_old_node_ids) const
 {
-    std::vector<std::size_t> exclude_positions;
-    for (auto it(_properties.begin()); it != _properties.end(); ++it) {
-        PropertyVectorBase *t(it->second->clone(exclude_positions));
-        it->second = t;
-    }
-}
+    Properties permuted_copy;
+    for (auto const& property_vector : _properties) {
+        std::vector<std::size_t> const* new_to_old = nullptr;
+        if (property_vector.second->getMeshItemType() == MeshItemType::Cell)
+            new_to_old = &new_to_old_elem_ids;
+        else if (property_vector.second->getMeshItemType() == MeshItemType::Node)
+            new_to_old = &new_to_old_node_ids;
+        else {
+            WARN(
+                "The property \"%s\" is neither a node nor a cell property "
+                "and is not copied to the permuted properties.",
+                property_vector.first.c_str());
+            continue;
+        }
 
-Properties::~Properties()
-{
-    for (auto property_vector : _properties) {
-        delete property_vector.second;
+        permuted_copy._properties.insert(std::make_pair(
+            property_vector.first,
+            std::shared_ptr<PropertyVectorBase>(
+                property_vector.second->clonePermuted(*new_to_old))));
     }
+    return permuted_copy;
 }
 
 } // end namespace MeshLib
@@ -15,8 +15,9 @@
 #define PROPERTIES_H_
 
 #include <cstdlib>
-#include <string>
 #include <map>
+#include <memory>
+#include <string>
 
 #include <boost/optional.hpp>
 
@@ -37,6 +38,24 @@ namespace MeshLib
 /// PropertyVector of template type T (scalar, vector or matrix).
 /// This class stores the PropertyVector, accessible by a combination of the
 /// name and the type of the mesh item (Node or Element).
+///
+/// Copies of a Properties object share the stored PropertyVector objects
+/// (copy on write), e.g. a mesh created from the properties of another mesh
+/// does not duplicate the property data. getPropertyVector() gives read-only
+/// access and never copies. A shared PropertyVector is copied only if it is
+/// requested for modification by getMutablePropertyVector(); the copy then
+/// belongs to this Properties object alone.
+///
+/// The sharing is not visible to references taken before a copy: a
+/// reference returned by createNewPropertyVector(), getPropertyVector() or
+/// getMutablePropertyVector() refers to the stored vector itself. After the
+/// Properties object has been copied, the vector is shared with the copy
+/// and writing through such a reference modifies the vector of all copies.
+/// Only getMutablePropertyVector() detaches a shared vector, hence a vector
+/// has to be requested by getMutablePropertyVector() after the copy in
+/// order to modify it for one Properties object alone. Likewise, a
+/// reference obtained before getMutablePropertyVector() detached the vector
+/// still refers to the vector of the other copies.
 class Properties
 {
 public:
@@ -53,7 +72,9 @@ public:
     /// @param mesh_item_type for instance node or element assigned properties
     /// @param n_components number of components for each tuple
     /// @return On success a reference to a PropertyVector packed into a
-    ///   boost::optional else an empty boost::optional.
+    ///   boost::optional else an empty boost::optional. The reference is
+    ///   shared with copies of this object made later, see the class
+    ///   documentation.
     template <typename T>
     boost::optional<PropertyVector<T> &>
     createNewPropertyVector(std::string const& name,
@@ -90,10 +111,14 @@ public:
     boost::optional<PropertyVector<T> const&>
     getPropertyVector(std::string const& name) const;
 
-    /// Method to get a vector of property values.
+    /// Method to get a vector of property values for modification. If the
+    /// vector is shared with other Properties objects, it is copied first.
+    /// The returned vector is owned by this Properties object alone until
+    /// the object is copied again; from then on the reference refers to the
+    /// vector shared with the copy.
     template <typename T>
     boost::optional<PropertyVector<T>&>
-    getPropertyVector(std::string const& name);
+    getMutablePropertyVector(std::string const& name);
 
     void removePropertyVector(std::string const& name);
 
@@ -104,24 +129,47 @@ public:
 
     std::vector<std::string> getPropertyVectorNames() const;
 
+    /// Heap memory in bytes held by all stored property vectors. Vectors
+    /// shared with other Properties objects are included.
+    std::size_t getMemoryUsage() const;
+
+    /// Returns true if the named PropertyVector is shared with another
+    /// Properties object.
+    bool isSharedPropertyVector(std::string const& name) const;
+
     /** copy all PropertyVector objects stored in the (internal) map but only
      * those nodes/elements of a PropertyVector whose ids are not in the vectors
-     * exclude_*_ids.
+     * exclude_*_ids. If nothing is excluded for the mesh item type of a
+     * PropertyVector, the vector is shared instead of copied.
      */
     Properties excludeCopyProperties(
         std::vector<std::size_t> const& exclude_elem_ids,
         std::vector<std::size_t> const& exclude_node_ids) const;
 
-    Properties() {}
+    /** copy all PropertyVector objects stored in the (internal) map with
+     * their tuples reordered, i.e. the tuple of the i-th node (element) of
+     * the copy is the tuple of the node (element) new_to_old_*_ids[i] of the
+     * original. Edge and face properties are not copied, since there is no
+     * permutation for them; a warning is issued for each of them.
+     */
+    Properties permuteCopyProperties(
+        std::vector<std::size_t> const& new_to_old_elem_ids,
+        std::vector<std::size_t> const& new_to_old_node_ids) const;
 
-    Properties(Properties const& properties);
+    Properties() = default;
 
-    ~Properties();
+    Properties(Properties const& properties) = default;
+    Properties& operator=(Properties const& properties) = default;
 
 private:
+    /// Replaces a PropertyVector shared with other Properties objects by a
+    /// copy.
+    static void detachPropertyVector(
+        std::shared_ptr<PropertyVectorBase>& property_vector);
+
     /// A mapping from property's name to the stored object of any type.
     /// See addProperty() and getProperty() documentation.
-    std::map<std::string, PropertyVectorBase*> _properties;
+    std::map<std::string, std::shared_ptr<PropertyVectorBase>> _properties;
 }; // end class
 
 #include "Properties-impl.h"
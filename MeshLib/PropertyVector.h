@@ -11,6 +11,7 @@
 #ifndef PROPERTYVECTOR_H_
 #define PROPERTYVECTOR_H_
 
+#include <algorithm>
 #include <iterator>
 #include <ostream>
 #include <string>
@@ -30,8 +31,15 @@ public:
     virtual PropertyVectorBase* clone(
         std::vector<std::size_t> const& exclude_positions
     ) const = 0;
+    /// Creates a copy whose i-th tuple is the tuple \c new_to_old[i] of this
+    /// property vector.
+    virtual PropertyVectorBase* clonePermuted(
+        std::vector<std::size_t> const& new_to_old) const = 0;
     virtual ~PropertyVectorBase() = default;
 
+    /// Heap memory in bytes held by the property values.
+    virtual std::size_t getMemoryUsage() const = 0;
+
     MeshItemType getMeshItemType() const { return _mesh_item_type; }
     std::string const& getPropertyName() const { return _property_name; }
     std::size_t getNumberOfComponents() const { return _n_components; }
@@ -74,12 +82,29 @@ public:
         return t;
     }
 
+    PropertyVectorBase* clonePermuted(
+        std::vector<std::size_t> const& new_to_old) const override
+    {
+        PropertyVector<PROP_VAL_TYPE>* t(new PropertyVector<PROP_VAL_TYPE>(
+            new_to_old.size(), _property_name, _mesh_item_type,
+            _n_components));
+        for (std::size_t i = 0; i < new_to_old.size(); ++i)
+            std::copy_n(this->cbegin() + new_to_old[i] * _n_components,
+                        _n_components, t->begin() + i * _n_components);
+        return t;
+    }
+
     /// Method returns the number of tuples times the number of tuple components.
     std::size_t size() const
     {
         return std::vector<PROP_VAL_TYPE>::size();
     }
 
+    std::size_t getMemoryUsage() const override
+    {
+        return std::vector<PROP_VAL_TYPE>::capacity() * sizeof(PROP_VAL_TYPE);
+    }
+
 protected:
     /// @brief The constructor taking meta information for the data.
     /// @param property_name a string describing the property
@@ -158,6 +183,12 @@ public:
         return _n_components * std::vector<std::size_t>::size();
     }
 
+    std::size_t getMemoryUsage() const override
+    {
+        return std::vector<std::size_t>::capacity() * sizeof(std::size_t) +
+               _values.capacity() * (sizeof(T*) + sizeof(T));
+    }
+
     PropertyVectorBase* clone(std::vector<std::size_t> const& exclude_positions) const
     {
         // create new PropertyVector with modified mapping
@@ -175,6 +206,23 @@ public:
         return t;
     }
 
+    PropertyVectorBase* clonePermuted(
+        std::vector<std::size_t> const& new_to_old) const override
+    {
+        // only the item to group mapping is permuted
+        std::vector<std::size_t> item2group_mapping(new_to_old.size());
+        for (std::size_t i = 0; i < new_to_old.size(); ++i)
+            item2group_mapping[i] =
+                std::vector<std::size_t>::operator[](new_to_old[i]);
+        PropertyVector<T*>* t(new PropertyVector<T*>(
+            _values.size() / _n_components, item2group_mapping,
+            _property_name, _mesh_item_type, _n_components));
+        for (std::size_t j(0); j<_values.size(); j++) {
+            t->initPropertyValue(j, *(_values[j]));
+        }
+        return t;
+    }
+
 #ifndef NDEBUG
     std::ostream& print(std::ostream &os) const
     {
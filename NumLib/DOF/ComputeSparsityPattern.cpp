@@ -10,9 +10,13 @@
 #include "ComputeSparsityPattern.h"
 
 #include "LocalToGlobalIndexMap.h"
-#include "MeshLib/NodeAdjacencyTable.h"
 
 #ifdef USE_PETSC
+#include <algorithm>
+#include <limits>
+
+#include "MeshLib/CompactMesh.h"
+#include "MeshLib/Elements/Element.h"
 #include "MeshLib/NodePartitionedMesh.h"
 
 GlobalSparsityPattern computeSparsityPatternPETSc(
@@ -23,20 +27,168 @@ GlobalSparsityPattern computeSparsityPatternPETSc(
     auto const& npmesh =
         *static_cast<MeshLib::NodePartitionedMesh const*>(&mesh);
 
-    auto const max_nonzeroes =   dof_table.getNumberOfComponents()
-                               * npmesh.getMaximumNConnectedNodesToNode();
+    // A mapping   mesh node id -> global indices
+    // It acts as a cache for dof table queries. The global indices of ghost
+    // nodes are negative, i.e. they are the columns of the off-diagonal
+    // block of the local rows.
+    std::vector<std::vector<GlobalIndexType>> global_idcs;
+    global_idcs.reserve(npmesh.getNumberOfNodes());
+    GlobalIndexType range_begin = std::numeric_limits<GlobalIndexType>::max();
+    for (std::size_t n = 0; n < npmesh.getNumberOfNodes(); ++n)
+    {
+        MeshLib::Location l(npmesh.getID(), MeshLib::MeshItemType::Node, n);
+        global_idcs.push_back(dof_table.getGlobalIndices(l));
+        for (auto const r : global_idcs.back())
+            if (r >= 0)
+                range_begin = std::min(range_begin, r);
+    }
+
+    // The numbers of nonzeros in the diagonal block of the local rows are
+    // followed by the numbers of nonzeros in the off-diagonal block.
+    std::size_t const n_local_rows = dof_table.dofSizeWithoutGhosts();
+    GlobalSparsityPattern sparsity_pattern(2 * n_local_rows);
+
+    // The elements are registered with all of their nodes. The elements of
+    // a MeshLib::Node only contain the elements of which the node is a base
+    // node, such that the mid-edge nodes of high order elements would have
+    // no entries.
+    auto const node_elements = MeshLib::createNodeElementTable(npmesh, true);
+    auto const& elements = npmesh.getElements();
+    std::size_t const n_nodes = npmesh.getNumberOfNodes();
+#ifdef _OPENMP
+    #pragma omp parallel
+#endif
+    {
+        std::vector<std::size_t> adjacent_nodes;
+#ifdef _OPENMP
+        #pragma omp for schedule(dynamic, 1024)
+        for (OPENMP_LOOP_TYPE n = 0; n < n_nodes; ++n)
+#else
+        for (std::size_t n = 0; n < n_nodes; ++n)
+#endif
+        {
+            if (npmesh.isGhostNode(n))
+                continue;
+
+            // All nodes of the elements of the node, including the nodes
+            // for high order interpolation.
+            adjacent_nodes.clear();
+            for (auto const e : node_elements.getElements(n))
+            {
+                auto const& element = *elements[e];
+                for (unsigned i = 0; i < element.getNumberOfNodes(); ++i)
+                    adjacent_nodes.push_back(element.getNodeIndex(i));
+            }
+            std::sort(adjacent_nodes.begin(), adjacent_nodes.end());
+            auto const adjacent_nodes_end =
+                std::unique(adjacent_nodes.begin(), adjacent_nodes.end());
+
+            GlobalIndexType n_diagonal = 0;
+            GlobalIndexType n_off_diagonal = 0;
+            for (auto an = adjacent_nodes.begin(); an != adjacent_nodes_end;
+                 ++an)
+            {
+                for (auto const c : global_idcs[*an])
+                {
+                    if (c >= 0)
+                        ++n_diagonal;
+                    else
+                        ++n_off_diagonal;
+                }
+            }
 
-    // The sparsity pattern is misused here in the sense that it will only
-    // contain a single value.
-    return GlobalSparsityPattern(1, max_nonzeroes);
+            // Each component leads to a row with the same entries.
+            for (auto const r : global_idcs[n])
+            {
+                if (r < 0)
+                    continue;
+                std::size_t const local_row = r - range_begin;
+                assert(local_row < n_local_rows);
+                sparsity_pattern[local_row] = n_diagonal;
+                sparsity_pattern[n_local_rows + local_row] = n_off_diagonal;
+            }
+        }
+    }
+
+    return sparsity_pattern;
 }
 #else
-GlobalSparsityPattern computeSparsityPatternNonPETSc(
-    NumLib::LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh)
+#include <algorithm>
+
+#include "MeshLib/CompactMesh.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+
+namespace
+{
+/// Topology access of a MeshLib::Mesh through a temporary node-to-element
+/// table. Only the CSR arrays of the table are allocated, the connected
+/// nodes stored in every MeshLib::Node are not needed.
+class MeshTopology
 {
-    MeshLib::NodeAdjacencyTable node_adjacency_table;
-    node_adjacency_table.createTable(mesh.getNodes());
+public:
+    explicit MeshTopology(MeshLib::Mesh const& mesh)
+        : _mesh(mesh),
+          _node_elements(MeshLib::createNodeElementTable(mesh, false))
+    {
+    }
+
+    std::size_t getNumberOfNodes() const { return _mesh.getNumberOfNodes(); }
+
+    MeshLib::IndexRange getElementsConnectedToNode(std::size_t const n) const
+    {
+        return _node_elements.getElements(n);
+    }
+
+    void appendBaseNodes(std::size_t const e,
+                         std::vector<std::size_t>& nodes) const
+    {
+        auto const& element = *_mesh.getElement(e);
+        for (unsigned i = 0; i < element.getNumberOfBaseNodes(); ++i)
+            nodes.push_back(element.getNodeIndex(i));
+    }
 
+private:
+    MeshLib::Mesh const& _mesh;
+    MeshLib::NodeElementTable const _node_elements;
+};
+
+/// Topology access of a MeshLib::CompactMesh.
+class CompactMeshTopology
+{
+public:
+    explicit CompactMeshTopology(MeshLib::CompactMesh const& mesh)
+        : _mesh(mesh)
+    {
+    }
+
+    std::size_t getNumberOfNodes() const { return _mesh.getNumberOfNodes(); }
+
+    MeshLib::IndexRange getElementsConnectedToNode(std::size_t const n) const
+    {
+        return _mesh.getElementsConnectedToNode(n);
+    }
+
+    void appendBaseNodes(std::size_t const e,
+                         std::vector<std::size_t>& nodes) const
+    {
+        auto const node_ids = _mesh.getElementNodeIDs(e);
+        unsigned const n_base_nodes =
+            MeshLib::getCellTypeNumberOfBaseNodes(_mesh.getCellType(e));
+        nodes.insert(nodes.end(), node_ids.begin(),
+                     node_ids.begin() + n_base_nodes);
+    }
+
+private:
+    MeshLib::CompactMesh const& _mesh;
+};
+}  // anonymous namespace
+
+template <typename Topology>
+GlobalSparsityPattern computeSparsityPatternNonPETSc(
+    NumLib::LocalToGlobalIndexMap const& dof_table, Topology const& mesh,
+    std::size_t const mesh_id)
+{
     // A mapping   mesh node id -> global indices
     // It acts as a cache for dof table queries.
     std::vector<std::vector<GlobalIndexType>> global_idcs;
@@ -44,19 +196,27 @@ GlobalSparsityPattern computeSparsityPatternNonPETSc(
     global_idcs.reserve(mesh.getNumberOfNodes());
     for (std::size_t n = 0; n < mesh.getNumberOfNodes(); ++n)
     {
-        MeshLib::Location l(mesh.getID(), MeshLib::MeshItemType::Node, n);
+        MeshLib::Location l(mesh_id, MeshLib::MeshItemType::Node, n);
         global_idcs.push_back(dof_table.getGlobalIndices(l));
     }
 
     GlobalSparsityPattern sparsity_pattern(dof_table.dofSizeWithGhosts());
 
-    // Map adjacent mesh nodes to "adjacent global indices".
+    // Two nodes are adjacent if they are base nodes of a common element.
+    std::vector<std::size_t> adjacent_nodes;
     for (std::size_t n = 0; n < mesh.getNumberOfNodes(); ++n)
     {
-        auto const& node_ids = node_adjacency_table.getAdjacentNodes(n);
-        for (auto an : node_ids)
+        adjacent_nodes.clear();
+        for (auto const e : mesh.getElementsConnectedToNode(n))
+            mesh.appendBaseNodes(e, adjacent_nodes);
+        std::sort(adjacent_nodes.begin(), adjacent_nodes.end());
+        auto const adjacent_nodes_end =
+            std::unique(adjacent_nodes.begin(), adjacent_nodes.end());
+
+        // Map adjacent mesh nodes to "adjacent global indices".
+        for (auto an = adjacent_nodes.begin(); an != adjacent_nodes_end; ++an)
         {
-            auto const& row_ids = global_idcs[an];
+            auto const& row_ids = global_idcs[*an];
             auto const num_components = row_ids.size();
             for (auto r : row_ids)
             {
@@ -80,8 +240,19 @@ GlobalSparsityPattern computeSparsityPattern(
 #ifdef USE_PETSC
     return computeSparsityPatternPETSc(dof_table, mesh);
 #else
-    return computeSparsityPatternNonPETSc(dof_table, mesh);
+    return computeSparsityPatternNonPETSc(dof_table, MeshTopology(mesh),
+                                          mesh.getID());
 #endif
 }
 
+#ifndef USE_PETSC
+GlobalSparsityPattern computeSparsityPattern(
+    LocalToGlobalIndexMap const& dof_table, MeshLib::CompactMesh const& mesh,
+    std::size_t const mesh_id)
+{
+    return computeSparsityPatternNonPETSc(
+        dof_table, CompactMeshTopology(mesh), mesh_id);
+}
+#endif
+
 }
@@ -16,6 +16,7 @@
 
 namespace MeshLib
 {
+class CompactMesh;
 class Mesh;
 }
 
@@ -29,10 +30,24 @@ class LocalToGlobalIndexMap;
  * @param dof_table            maps mesh nodes to global indices
  * @param mesh                 mesh for which the two parameters above are defined
  *
- * @return The computed sparsity pattern.
+ * @return The computed sparsity pattern, i.e. the number of nonzeros of each
+ * row. For PETSc it contains the numbers of nonzeros in the diagonal block
+ * of each local row followed by the numbers of nonzeros in the off-diagonal
+ * block (the columns of ghost nodes) of each local row.
  */
 GlobalSparsityPattern computeSparsityPattern(
     LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh);
+
+#ifndef USE_PETSC
+/**
+ * Computes the sparsity pattern from the topology of a compact mesh, see
+ * computeSparsityPattern() above. The \c dof_table refers to the mesh by
+ * \c mesh_id.
+ */
+GlobalSparsityPattern computeSparsityPattern(
+    LocalToGlobalIndexMap const& dof_table, MeshLib::CompactMesh const& mesh,
+    std::size_t const mesh_id);
+#endif
 }
 
 #endif // NUMLIB_COMPUTESPARSITYPATTERN_H
@@ -132,6 +132,24 @@ LocalToGlobalIndexMap::dofSizeWithGhosts() const
     return _mesh_component_map.dofSizeWithGhosts();
 }
 
+std::size_t
+LocalToGlobalIndexMap::getMemoryUsage() const
+{
+    std::size_t bytes = _rows.size() * sizeof(LineIndex);
+    for (std::size_t i = 0; i < static_cast<std::size_t>(_rows.size()); ++i)
+        bytes += _rows.data()[i].capacity() * sizeof(GlobalIndexType);
+
+    // The mesh component map is a boost::multi_index_container with four
+    // ordered indices; each of them adds a node of three pointers per entry.
+    bytes += _mesh_component_map.dofSizeWithGhosts() *
+             (sizeof(detail::Line) + 4 * 3 * sizeof(void*));
+
+    bytes += _mesh_component_map.getGhostIndices().capacity() *
+             sizeof(GlobalIndexType);
+
+    return bytes;
+}
+
 std::size_t
 LocalToGlobalIndexMap::size() const
 {
@@ -63,6 +63,10 @@ public:
     /// the ghost nodes.
     std::size_t dofSizeWithGhosts() const;
 
+    /// Returns an estimate of the heap memory in bytes held by the index
+    /// table and the mesh component map.
+    std::size_t getMemoryUsage() const;
+
     /// Returns total number of local degrees of freedom of the present rank,
     /// which does not count the unknowns associated with ghost nodes (for DDC
     /// with node-wise mesh partitioning).
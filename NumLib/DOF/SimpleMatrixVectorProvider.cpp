@@ -13,6 +13,7 @@
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/Error.h"
+#include "BaseLib/MemoryAccounting.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
 
@@ -51,6 +52,46 @@ transfer(std::map<MatVec*, std::size_t>& from_used,
     from_used.erase(it);
 }
 
+using MemoryUsageMap = std::map<void const*, std::size_t>;
+
+template <typename... Args>
+std::size_t estimateMemoryUsage(GlobalVector const& x, MemoryUsageMap const&,
+                                Args const&...)
+{
+    return x.size() * sizeof(double);
+}
+
+std::size_t estimateMemoryUsage(GlobalMatrix const&, MemoryUsageMap const&)
+{
+    // Default constructed matrices are resized later; that is not tracked.
+    return 0;
+}
+
+std::size_t estimateMemoryUsage(GlobalMatrix const&, MemoryUsageMap const&,
+                                MathLib::MatrixSpecifications const& ms)
+{
+    std::size_t nnz = 0;
+    if (ms.sparsity_pattern)
+    {
+        for (auto const n : *ms.sparsity_pattern)
+            nnz += n;
+    }
+    // Compressed row storage: values, column indices and row offsets.
+    return nnz * (sizeof(double) + sizeof(GlobalIndexType)) +
+           ms.nrows * sizeof(GlobalIndexType);
+}
+
+std::size_t estimateMemoryUsage(GlobalMatrix const&,
+                                MemoryUsageMap const& memory_usage,
+                                GlobalMatrix const& A)
+{
+    auto const it = memory_usage.find(&A);
+    return it == memory_usage.end() ? 0 : it->second;
+}
+
+char const* getMemoryCategory(GlobalMatrix const&) { return "global matrices"; }
+char const* getMemoryCategory(GlobalVector const&) { return "global vectors"; }
+
 } // detail
 
 
@@ -85,6 +126,14 @@ get_(std::size_t& id,
         MathLib::MatrixVectorTraits<MatVec>::newInstance(std::forward<Args>(args)...).release(),
         id);
     assert(res.second && "Emplacement failed.");
+
+    auto const& new_object = *res.first->first;
+    auto const bytes =
+        ::detail::estimateMemoryUsage(new_object, _memory_usage, args...);
+    _memory_usage[&new_object] = bytes;
+    BaseLib::MemoryAccounting::instance().add(
+        ::detail::getMemoryCategory(new_object), bytes);
+
     return { res.first->first, true };
 }
 
@@ -236,6 +285,26 @@ releaseVector(GlobalVector const& x)
     }
 }
 
+template <typename MatVec>
+void SimpleMatrixVectorProvider::destroy(MatVec* const object)
+{
+    auto const it = _memory_usage.find(object);
+    if (it != _memory_usage.end())
+    {
+        try
+        {
+            BaseLib::MemoryAccounting::instance().subtract(
+                ::detail::getMemoryCategory(*object), it->second);
+        }
+        catch (std::exception const& e)
+        {
+            WARN("%s", e.what());
+        }
+        _memory_usage.erase(it);
+    }
+    delete object;
+}
+
 SimpleMatrixVectorProvider::
 ~SimpleMatrixVectorProvider()
 {
@@ -245,16 +314,16 @@ SimpleMatrixVectorProvider::
     }
 
     for (auto& id_ptr : _unused_matrices)
-        delete id_ptr.second;
+        destroy(id_ptr.second);
 
     for (auto& ptr_id : _used_matrices)
-        delete ptr_id.first;
+        destroy(ptr_id.first);
 
     for (auto& id_ptr : _unused_vectors)
-        delete id_ptr.second;
+        destroy(id_ptr.second);
 
     for (auto& ptr_id : _used_vectors)
-        delete ptr_id.first;
+        destroy(ptr_id.first);
 }
 
 } // MathLib
@@ -76,6 +76,11 @@ private:
          std::map<MatVec*, std::size_t>& used_map,
          Args&&... args);
 
+    /// Deletes the object and releases its memory from the
+    /// BaseLib::MemoryAccounting.
+    template <typename MatVec>
+    void destroy(MatVec* const object);
+
     std::size_t _next_id = 1;
 
     std::map<std::size_t, GlobalMatrix*> _unused_matrices;
@@ -83,6 +88,9 @@ private:
 
     std::map<std::size_t, GlobalVector*> _unused_vectors;
     std::map<GlobalVector*, std::size_t> _used_vectors;
+
+    /// Estimated memory of each matrix and vector created by this provider.
+    std::map<void const*, std::size_t> _memory_usage;
 };
 
 
@@ -14,6 +14,7 @@
 #include <Eigen/Core>
 #include <logog/include/logog.hpp>
 
+#include "BaseLib/Error.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
 #include "NumLib/Assembler/SerialExecutor.h"
@@ -46,6 +47,15 @@ LocalLinearLeastSquaresExtrapolator::LocalLinearLeastSquaresExtrapolator(
     assert(dof_table.getNumberOfComponents() == 1 &&
            "The d.o.f. table passed must be for one variable that has "
            "only one component!");
+
+#ifdef USE_PETSC
+    // The ghost entries follow the local entries in the local form of the
+    // nodal values vector.
+    auto const& ghost_indices = dof_table.getGhostIndices();
+    for (std::size_t k = 0; k < ghost_indices.size(); ++k)
+        _ghost_local_indices.emplace(
+            ghost_indices[k], dof_table.dofSizeWithoutGhosts() + k);
+#endif
 }
 
 void LocalLinearLeastSquaresExtrapolator::extrapolate(
@@ -64,19 +74,42 @@ void LocalLinearLeastSquaresExtrapolator::extrapolate(
         extrapolateElement(i, extrapolatables, *counts);
     }
 
+    // Under PETSc the contributions to ghost nodes (negative indices) are
+    // dropped by VecSetValues. This is intended: every element adjacent to a
+    // node is present on the rank owning that node, either as a regular or as
+    // a ghost element, such that each node is summed up completely by its
+    // owner.
+    MathLib::LinAlg::finalizeAssembly(_nodal_values);
+    MathLib::LinAlg::finalizeAssembly(*counts);
+
     MathLib::LinAlg::componentwiseDivide(_nodal_values, _nodal_values, *counts);
+
+#ifdef USE_PETSC
+    // Fetch the values of the ghost nodes from their owners; they are needed
+    // for the residuals of the elements at the partition boundaries.
+    _nodal_values_with_ghosts.resize(_nodal_values.getLocalSize() +
+                                     _nodal_values.getGhostSize());
+    _nodal_values.copyValues(_nodal_values_with_ghosts);
+#endif
 }
 
 void LocalLinearLeastSquaresExtrapolator::calculateResiduals(
     ExtrapolatableElementCollection const& extrapolatables)
 {
+#ifndef USE_PETSC
     assert(static_cast<std::size_t>(_residuals.size()) ==
            extrapolatables.size());
+#else
+    assert(static_cast<std::size_t>(_residuals.getLocalSize()) ==
+           extrapolatables.size());
+#endif
 
     auto const size = extrapolatables.size();
     for (std::size_t i=0; i<size; ++i) {
         calculateResidualElement(i, extrapolatables);
     }
+
+    MathLib::LinAlg::finalizeAssembly(_residuals);
 }
 
 void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
@@ -131,8 +164,7 @@ void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
     // TODO: for now always zeroth component is used
     auto const& global_indices = _local_to_global(element_index, 0).rows;
 
-    _nodal_values.add(global_indices,
-                      tmp);  // TODO does that give rise to PETSc problems?
+    _nodal_values.add(global_indices, tmp);
     counts.add(global_indices, std::vector<double>(global_indices.size(), 1.0));
 }
 
@@ -151,8 +183,7 @@ void LocalLinearLeastSquaresExtrapolator::calculateResidualElement(
     std::vector<double> nodal_vals_element;
     nodal_vals_element.resize(global_indices.size());
     for (unsigned i = 0; i < global_indices.size(); ++i) {
-        // TODO PETSc negative indices?
-        nodal_vals_element[i] = _nodal_values[global_indices[i]];
+        nodal_vals_element[i] = getNodalValue(global_indices[i]);
     }
 
     double residual = 0.0;
@@ -167,7 +198,33 @@ void LocalLinearLeastSquaresExtrapolator::calculateResidualElement(
         residual += ax_m_b * ax_m_b;
     }
 
+#ifndef USE_PETSC
     _residuals.set(element_index, std::sqrt(residual / ni));
+#else
+    // The residuals vector holds the local elements of this rank only.
+    _residuals.set(_residuals.getRangeBegin() + element_index,
+                   std::sqrt(residual / ni));
+#endif
+}
+
+double LocalLinearLeastSquaresExtrapolator::getNodalValue(
+    GlobalIndexType const global_index) const
+{
+#ifndef USE_PETSC
+    return _nodal_values[global_index];
+#else
+    if (global_index >= 0)
+        return _nodal_values_with_ghosts[global_index -
+                                         _nodal_values.getRangeBegin()];
+
+    // Ghost node; the global index 0 is encoded as minus the global size.
+    GlobalIndexType const ghost_index =
+        (-global_index == _nodal_values.size()) ? 0 : -global_index;
+    auto const it = _ghost_local_indices.find(ghost_index);
+    if (it == _ghost_local_indices.end())
+        OGS_FATAL("index %d not found in ghost_indices", ghost_index);
+    return _nodal_values_with_ghosts[it->second];
+#endif
 }
 
 }  // namespace NumLib
@@ -10,6 +10,9 @@
 #ifndef NUMLIB_LOCAL_LLSQ_EXTRAPOLATOR_H
 #define NUMLIB_LOCAL_LLSQ_EXTRAPOLATOR_H
 
+#include <unordered_map>
+#include <vector>
+
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "NumLib/DOF/GlobalMatrixProviders.h"
 #include "Extrapolator.h"
@@ -88,12 +91,25 @@ private:
         std::size_t const element_index,
         ExtrapolatableElementCollection const& extrapolatables);
 
+    //! Returns the extrapolated value at the given global index, which may
+    //! refer to a ghost node when running with PETSc.
+    double getNodalValue(GlobalIndexType const global_index) const;
+
     GlobalVector& _nodal_values;  //!< extrapolated nodal values
     GlobalVector _residuals;      //!< extrapolation residuals
 
     //! DOF table used for writing to global vectors.
     NumLib::LocalToGlobalIndexMap const& _local_to_global;
 
+#ifdef USE_PETSC
+    //! Local and ghost entries of \c _nodal_values after extrapolation.
+    std::vector<double> _nodal_values_with_ghosts;
+
+    //! Maps the global index of each ghost node to its position in
+    //! \c _nodal_values_with_ghosts.
+    std::unordered_map<GlobalIndexType, std::size_t> _ghost_local_indices;
+#endif
+
     //! Avoids frequent reallocations.
     Eigen::MatrixXd _local_matrix_cache;
 
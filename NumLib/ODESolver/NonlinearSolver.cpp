@@ -16,7 +16,7 @@
 
 #include "BaseLib/ConfigTree.h"
 #include "BaseLib/Error.h"
-#include "BaseLib/RunTime.h"
+#include "BaseLib/Profiler.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "MathLib/LinAlg/VectorNorms.h"
 #include "NumLib/DOF/GlobalMatrixProviders.h"
@@ -52,28 +52,28 @@ bool NonlinearSolver<NonlinearSolverTag::Picard>::solve(
     unsigned iteration = 1;
     for (; iteration <= _maxiter; ++iteration)
     {
-        BaseLib::RunTime time_iteration;
-        time_iteration.start();
+        OGS_PROFILE_SCOPE("nonlinear iteration");
 
         sys.preIteration(iteration, x);
 
-        BaseLib::RunTime time_assembly;
-        time_assembly.start();
-        sys.assembleMatricesPicard(x);
-        sys.getA(A);
-        sys.getRhs(rhs);
-        INFO("[time] Assembly took %g s.", time_assembly.elapsed());
+        {
+            OGS_PROFILE_SCOPE("assembly");
+            sys.assembleMatricesPicard(x);
+            sys.getA(A);
+            sys.getRhs(rhs);
+        }
 
-        BaseLib::RunTime time_dirichlet;
-        time_dirichlet.start();
-        // Here _x_new has to be used and it has to be equal to x!
-        sys.applyKnownSolutionsPicard(A, rhs, x_new);
-        INFO("[time] Applying Dirichlet BCs took %g s.", time_dirichlet.elapsed());
+        {
+            OGS_PROFILE_SCOPE("Dirichlet BCs");
+            // Here _x_new has to be used and it has to be equal to x!
+            sys.applyKnownSolutionsPicard(A, rhs, x_new);
+        }
 
-        BaseLib::RunTime time_linear_solver;
-        time_linear_solver.start();
-        bool iteration_succeeded = _linear_solver.solve(A, rhs, x_new);
-        INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
+        bool iteration_succeeded;
+        {
+            OGS_PROFILE_SCOPE("linear solver");
+            iteration_succeeded = _linear_solver.solve(A, rhs, x_new);
+        }
 
         if (!iteration_succeeded)
         {
@@ -127,9 +127,6 @@ bool NonlinearSolver<NonlinearSolverTag::Picard>::solve(
         // Update x s.t. in the next iteration we will compute the right delta x
         LinAlg::copy(x_new, x);
 
-        INFO("[time] Iteration #%u took %g s.", iteration,
-             time_iteration.elapsed());
-
         if (error_dx < _tol)
         {
             error_norms_met = true;
@@ -191,30 +188,30 @@ bool NonlinearSolver<NonlinearSolverTag::Newton>::solve(
     unsigned iteration = 1;
     for (; iteration <= _maxiter; ++iteration)
     {
-        BaseLib::RunTime time_iteration;
-        time_iteration.start();
+        OGS_PROFILE_SCOPE("nonlinear iteration");
 
         sys.preIteration(iteration, x);
 
-        BaseLib::RunTime time_assembly;
-        time_assembly.start();
-        sys.assembleResidualNewton(x);
-        sys.getResidual(x, res);
-        sys.assembleJacobian(x);
-        sys.getJacobian(J);
-        INFO("[time] Assembly took %g s.", time_assembly.elapsed());
+        {
+            OGS_PROFILE_SCOPE("assembly");
+            sys.assembleResidualNewton(x);
+            sys.getResidual(x, res);
+            sys.assembleJacobian(x);
+            sys.getJacobian(J);
+        }
 
-        BaseLib::RunTime time_dirichlet;
-        time_dirichlet.start();
-        sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
-        INFO("[time] Applying Dirichlet BCs took %g s.", time_dirichlet.elapsed());
+        {
+            OGS_PROFILE_SCOPE("Dirichlet BCs");
+            sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
+        }
 
         auto const error_res = LinAlg::norm2(res);
 
-        BaseLib::RunTime time_linear_solver;
-        time_linear_solver.start();
-        bool iteration_succeeded = _linear_solver.solve(J, res, minus_delta_x);
-        INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
+        bool iteration_succeeded;
+        {
+            OGS_PROFILE_SCOPE("linear solver");
+            iteration_succeeded = _linear_solver.solve(J, res, minus_delta_x);
+        }
 
         if (!iteration_succeeded)
         {
@@ -275,9 +272,6 @@ bool NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             " tolerance(dx)=%.4e",
             iteration, error_dx, error_res, norm_x, error_dx / norm_x, _tol);
 
-        INFO("[time] Iteration #%u took %g s.", iteration,
-             time_iteration.elapsed());
-
         if (error_dx < _tol)
         {
             error_norms_met = true;
@@ -36,8 +36,7 @@ std::unique_ptr<Process> createGroundwaterFlowProcess(
          "process_variable"});
 
     // Hydraulic conductivity parameter.
-    auto& hydraulic_conductivity = findParameter<double,
-                                                 MeshLib::Element const&>(
+    auto& hydraulic_conductivity = findSpatialParameter<double>(
         config,
         //! \ogs_file_param_special{process__GROUNDWATER_FLOW__hydraulic_conductivity}
         "hydraulic_conductivity",
@@ -46,6 +45,18 @@ std::unique_ptr<Process> createGroundwaterFlowProcess(
     DBUG("Use \'%s\' as hydraulic conductivity parameter.",
          hydraulic_conductivity.name.c_str());
 
+    // The conductivity is either isotropic or a full tensor.
+    unsigned const dim = mesh.getDimension();
+    unsigned const n_k_components =
+        hydraulic_conductivity.getNumberOfComponents();
+    if (n_k_components != 1 && n_k_components != dim * dim)
+    {
+        OGS_FATAL(
+            "The hydraulic conductivity parameter \'%s\' has %d components, "
+            "but a scalar or a %dx%d tensor is required.",
+            hydraulic_conductivity.name.c_str(), n_k_components, dim, dim);
+    }
+
     GroundwaterFlowProcessData process_data{hydraulic_conductivity};
 
     SecondaryVariableCollection secondary_variables{
@@ -12,6 +12,7 @@
 
 #include <vector>
 
+#include "BaseLib/MemoryAccounting.h"
 #include "NumLib/Extrapolation/ExtrapolatableElement.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
@@ -52,6 +53,7 @@ class LocalAssemblerData
 {
     using ShapeMatricesType = ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
     using ShapeMatrices = typename ShapeMatricesType::ShapeMatrices;
+    using GlobalDimMatrixType = typename ShapeMatricesType::GlobalDimMatrixType;
 
     using LocalAssemblerTraits = ProcessLib::LocalAssemblerTraits<
         ShapeMatricesType, ShapeFunction::NPOINTS, NUM_NODAL_DOF, GlobalDim>;
@@ -80,7 +82,7 @@ public:
     }
 
     void assembleConcrete(
-        double const /*t*/, std::vector<double> const& local_x,
+        double const /*t*/, std::vector<double> const& /*local_x*/,
         NumLib::LocalToGlobalIndexMap::RowColumnIndices const& indices,
         GlobalMatrix& /*M*/, GlobalMatrix& K, GlobalVector& b) override
     {
@@ -90,22 +92,30 @@ public:
         IntegrationMethod integration_method(_integration_order);
         unsigned const n_integration_points = integration_method.getNumberOfPoints();
 
+        // Evaluate the conductivity for all integration points at once; for
+        // constant and element-wise values the stride is zero.
+        auto const& k_parameter = _process_data.hydraulic_conductivity;
+        std::size_t const k_stride = evaluateAtIntegrationPoints(
+            k_parameter, _element, _shape_matrices, _k_values);
+        bool const k_is_isotropic = k_parameter.getNumberOfComponents() == 1;
+
         for (std::size_t ip(0); ip < n_integration_points; ip++)
         {
             auto const& sm = _shape_matrices[ip];
             auto const& wp = integration_method.getWeightedPoint(ip);
-            auto const k = _process_data.hydraulic_conductivity(_element);
-
-            _localA.noalias() += sm.dNdx.transpose() * k * sm.dNdx *
-                                 sm.detJ * wp.getWeight();
-
-            // Darcy velocity only computed for output.
-            auto const darcy_velocity = -(k * sm.dNdx *
-                Eigen::Map<const NodalVectorType>(local_x.data(), ShapeFunction::NPOINTS)
-                ).eval();
+            double const* const k_ip = _k_values.data() + ip * k_stride;
 
-            for (unsigned d=0; d<GlobalDim; ++d) {
-                _darcy_velocities[d][ip] = darcy_velocity[d];
+            if (k_is_isotropic)
+            {
+                _localA.noalias() += sm.dNdx.transpose() * (*k_ip) * sm.dNdx *
+                                     sm.detJ * wp.getWeight();
+            }
+            else
+            {
+                auto const k = Eigen::Map<const GlobalDimMatrixType>(
+                    k_ip, GlobalDim, GlobalDim);
+                _localA.noalias() += sm.dNdx.transpose() * k * sm.dNdx *
+                                     sm.detJ * wp.getWeight();
             }
         }
 
@@ -113,6 +123,44 @@ public:
         b.add(indices.rows, _localRhs);
     }
 
+    /// Computes the Darcy velocities at the integration points. They are only
+    /// needed for output and therefore not computed during the assembly.
+    void computeSecondaryVariableConcrete(
+        double const /*t*/, std::vector<double> const& local_x) override
+    {
+        auto const& k_parameter = _process_data.hydraulic_conductivity;
+        std::size_t const k_stride = evaluateAtIntegrationPoints(
+            k_parameter, _element, _shape_matrices, _k_values);
+        bool const k_is_isotropic = k_parameter.getNumberOfComponents() == 1;
+
+        auto const x = Eigen::Map<const NodalVectorType>(
+            local_x.data(), ShapeFunction::NPOINTS);
+
+        auto const n_integration_points = _shape_matrices.size();
+        for (std::size_t ip(0); ip < n_integration_points; ip++)
+        {
+            auto const& sm = _shape_matrices[ip];
+            double const* const k_ip = _k_values.data() + ip * k_stride;
+
+            if (k_is_isotropic)
+            {
+                auto const darcy_velocity = -((*k_ip) * sm.dNdx * x).eval();
+                for (unsigned d=0; d<GlobalDim; ++d) {
+                    _darcy_velocities[d][ip] = darcy_velocity[d];
+                }
+            }
+            else
+            {
+                auto const k = Eigen::Map<const GlobalDimMatrixType>(
+                    k_ip, GlobalDim, GlobalDim);
+                auto const darcy_velocity = -(k * sm.dNdx * x).eval();
+                for (unsigned d=0; d<GlobalDim; ++d) {
+                    _darcy_velocities[d][ip] = darcy_velocity[d];
+                }
+            }
+        }
+    }
+
     Eigen::Map<const Eigen::RowVectorXd>
     getShapeMatrix(const unsigned integration_point) const override
     {
@@ -122,6 +170,17 @@ public:
         return Eigen::Map<const Eigen::RowVectorXd>(N.data(), N.size());
     }
 
+    LocalAssemblerMemoryUsage getMemoryUsage() const override
+    {
+        LocalAssemblerMemoryUsage usage;
+        usage.shape_matrices = getShapeMatricesMemoryUsage(_shape_matrices);
+        usage.integration_point_data = BaseLib::getMemoryUsage(_k_values) +
+            BaseLib::getMemoryUsage(_darcy_velocities);
+        for (auto const& v : _darcy_velocities)
+            usage.integration_point_data += BaseLib::getMemoryUsage(v);
+        return usage;
+    }
+
     std::vector<double> const&
     getIntPtDarcyVelocityX(std::vector<double>& /*cache*/) const override
     {
@@ -153,6 +212,9 @@ private:
 
     unsigned const _integration_order;
 
+    /// Buffer for the hydraulic conductivity values at the integration points.
+    std::vector<double> _k_values;
+
     std::vector<std::vector<double>> _darcy_velocities
         = std::vector<std::vector<double>>(
             GlobalDim, std::vector<double>(ShapeFunction::NPOINTS));
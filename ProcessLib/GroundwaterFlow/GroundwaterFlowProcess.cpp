@@ -52,6 +52,8 @@ void GroundwaterFlowProcess::initializeConcreteProcess(
     ProcessLib::createLocalAssemblers<LocalAssemblerData>(
         mesh.getDimension(), mesh.getElements(), dof_table, integration_order,
         _local_assemblers, _process_data);
+    ProcessLib::accountLocalAssemblerMemory(_local_assemblers,
+                                            _accounted_memory);
 
     _secondary_variables.addSecondaryVariable(
         "darcy_velocity_x", 1,
@@ -89,5 +91,24 @@ void GroundwaterFlowProcess::assembleConcreteProcess(const double t,
         _local_assemblers, *_local_to_global_index_map, t, x, M, K, b);
 }
 
+void GroundwaterFlowProcess::computeSecondaryVariableConcrete(
+    double const t, GlobalVector const& x)
+{
+    DBUG("Compute the Darcy velocities for GroundwaterFlowProcess.");
+
+    // The local assemblers only write their own integration point data.
+    std::size_t const n_local_assemblers = _local_assemblers.size();
+#ifdef _OPENMP
+    #pragma omp parallel for
+    for (OPENMP_LOOP_TYPE i = 0; i < n_local_assemblers; ++i)
+#else
+    for (std::size_t i = 0; i < n_local_assemblers; ++i)
+#endif
+    {
+        _local_assemblers[i]->computeSecondaryVariable(
+            i, *_local_to_global_index_map, t, x);
+    }
+}
+
 }   // namespace GroundwaterFlow
 }   // namespace ProcessLib
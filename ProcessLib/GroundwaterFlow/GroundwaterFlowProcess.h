@@ -51,6 +51,9 @@ private:
                                  GlobalMatrix& M, GlobalMatrix& K,
                                  GlobalVector& b) override;
 
+    void computeSecondaryVariableConcrete(double const t,
+                                          GlobalVector const& x) override;
+
     GroundwaterFlowProcessData _process_data;
 
     std::vector<std::unique_ptr<GroundwaterFlowLocalAssemblerInterface>>
@@ -10,17 +10,11 @@
 #ifndef PROCESSLIB_GROUNDWATERFLOW_GROUNDWATERFLOWPROCESSDATA_H
 #define PROCESSLIB_GROUNDWATERFLOW_GROUNDWATERFLOWPROCESSDATA_H
 
-namespace MeshLib
-{
-    class Element;
-}
-
-
 namespace ProcessLib
 {
 
-template <typename ReturnType, typename... Args>
-struct Parameter;
+template <typename ReturnType>
+struct SpatialParameter;
 
 namespace GroundwaterFlow
 {
@@ -28,8 +22,7 @@ namespace GroundwaterFlow
 struct GroundwaterFlowProcessData
 {
     GroundwaterFlowProcessData(
-            ProcessLib::Parameter<double, MeshLib::Element const&> const&
-            hydraulic_conductivity_
+            ProcessLib::SpatialParameter<double> const& hydraulic_conductivity_
             )
         : hydraulic_conductivity(hydraulic_conductivity_)
     {}
@@ -47,7 +40,8 @@ struct GroundwaterFlowProcessData
     //! Assignments are not needed.
     void operator=(GroundwaterFlowProcessData&&) = delete;
 
-    Parameter<double, MeshLib::Element const&> const& hydraulic_conductivity;
+    /// Either a scalar or a GlobalDim x GlobalDim tensor stored row-major.
+    SpatialParameter<double> const& hydraulic_conductivity;
 };
 
 } // namespace GroundwaterFlow
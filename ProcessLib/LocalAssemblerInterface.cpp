@@ -70,4 +70,15 @@ void LocalAssemblerInterface::postTimestep(
     postTimestepConcrete(local_x);
 }
 
+void LocalAssemblerInterface::computeSecondaryVariable(
+    std::size_t const mesh_item_id,
+    NumLib::LocalToGlobalIndexMap const& dof_table, double const t,
+    GlobalVector const& x)
+{
+    auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
+    auto const local_x = x.get(indices);
+
+    computeSecondaryVariableConcrete(t, local_x);
+}
+
 }  // namespace ProcessLib
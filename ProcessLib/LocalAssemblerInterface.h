@@ -16,6 +16,13 @@
 namespace ProcessLib
 {
 
+/// Heap memory in bytes held by a local assembler.
+struct LocalAssemblerMemoryUsage
+{
+    std::size_t shape_matrices = 0;
+    std::size_t integration_point_data = 0;
+};
+
 /*! Common interface for local assemblers
  * NumLib::ODESystemTag::FirstOrderImplicitQuasilinear ODE systems.
  *
@@ -45,6 +52,17 @@ public:
                               NumLib::LocalToGlobalIndexMap const& dof_table,
                               GlobalVector const& x);
 
+    /// Computes quantities which are not needed for the assembly, e.g.,
+    /// integration point values which are only used for output.
+    void computeSecondaryVariable(
+        std::size_t const mesh_item_id,
+        NumLib::LocalToGlobalIndexMap const& dof_table, double const t,
+        GlobalVector const& x);
+
+    /// Returns an estimate of the memory held by this local assembler for
+    /// memory accounting purposes.
+    virtual LocalAssemblerMemoryUsage getMemoryUsage() const { return {}; }
+
 protected:
     virtual void assembleConcrete(
             double const t, std::vector<double> const& local_x,
@@ -62,6 +80,11 @@ protected:
     }
 
     virtual void postTimestepConcrete(std::vector<double> const& /*local_x*/) {}
+
+    virtual void computeSecondaryVariableConcrete(
+        double const /*t*/, std::vector<double> const& /*local_x*/)
+    {
+    }
 };
 
 } // namespace ProcessLib
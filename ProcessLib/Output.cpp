@@ -16,7 +16,7 @@
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/FileTools.h"
-#include "BaseLib/RunTime.h"
+#include "BaseLib/Profiler.h"
 
 namespace
 {
@@ -52,10 +52,28 @@ newInstance(const BaseLib::ConfigTree &config, std::string const& output_directo
         //! \ogs_file_param{prj__output__output_iteration_results}
         config.getConfigParameterOptional<bool>("output_iteration_results");
 
+    auto const type_name =
+        //! \ogs_file_param{prj__output__type}
+        config.getConfigParameter<std::string>("type");
+    OutputType type = OutputType::VTK;
+    if (type_name == "XDMF")
+    {
+#ifdef USE_PETSC
+        OGS_FATAL("XDMF output is not available for parallel computations.");
+#endif
+        type = OutputType::XDMF;
+    }
+    else if (type_name != "VTK")
+    {
+        OGS_FATAL("Unknown output type `%s'; expected VTK or XDMF.",
+                  type_name.c_str());
+    }
+
     std::unique_ptr<Output> out{new Output{
         BaseLib::joinPaths(output_directory,
                            //! \ogs_file_param{prj__output__prefix}
                            config.getConfigParameter<std::string>("prefix")),
+        type,
         output_iteration_results ? *output_iteration_results : false}};
 
     //! \ogs_file_param{prj__output__timesteps}
@@ -92,22 +110,20 @@ initialize(Output::ProcessIter first, const Output::ProcessIter& last)
     for (unsigned pcs_idx = 0; first != last; ++first, ++pcs_idx)
     {
         auto const filename = _output_file_prefix
-                              + "_pcs_" + std::to_string(pcs_idx)
-                              + ".pvd";
+                              + "_pcs_" + std::to_string(pcs_idx);
         _single_process_data.emplace(std::piecewise_construct,
                 std::forward_as_tuple(&**first),
-                std::forward_as_tuple(pcs_idx, filename));
+                std::forward_as_tuple(pcs_idx, filename, _output_type));
     }
 }
 
 void Output::
-doOutputAlways(Process const& process,
+doOutputAlways(Process& process,
                unsigned timestep,
                const double t,
                GlobalVector const& x)
 {
-    BaseLib::RunTime time_output;
-    time_output.start();
+    OGS_PROFILE_SCOPE("output");
 
     auto spd_it = _single_process_data.find(&process);
     if (spd_it == _single_process_data.end()) {
@@ -116,20 +132,27 @@ doOutputAlways(Process const& process,
     }
     auto& spd = spd_it->second;
 
-    std::string const output_file_name =
-            _output_file_prefix + "_pcs_" + std::to_string(spd.process_index)
-            + "_ts_" + std::to_string(timestep)
-            + "_t_"  + std::to_string(t)
-            + ".vtu";
-    DBUG("output to %s", output_file_name.c_str());
-    process.output(output_file_name, timestep, x);
-    spd.pvd_file.addVTUFile(output_file_name, t);
-
-    INFO("[time] Output took %g s.", time_output.elapsed());
+    if (spd.xdmf_writer)
+    {
+        DBUG("output of timestep %u to the xdmf time series", timestep);
+        process.prepareOutput(t, x);
+        spd.xdmf_writer->addTimeStep(process.getMesh(), t);
+    }
+    else
+    {
+        std::string const output_file_name =
+                _output_file_prefix + "_pcs_" + std::to_string(spd.process_index)
+                + "_ts_" + std::to_string(timestep)
+                + "_t_"  + std::to_string(t)
+                + ".vtu";
+        DBUG("output to %s", output_file_name.c_str());
+        process.output(output_file_name, timestep, t, x);
+        spd.pvd_file.addVTUFile(output_file_name, t);
+    }
 }
 
 void Output::
-doOutput(Process const& process,
+doOutput(Process& process,
          unsigned timestep,
          const double t,
          GlobalVector const& x)
@@ -139,7 +162,7 @@ doOutput(Process const& process,
 }
 
 void Output::
-doOutputLastTimestep(Process const& process,
+doOutputLastTimestep(Process& process,
                      unsigned timestep,
                      const double t,
                      GlobalVector const& x)
@@ -148,15 +171,14 @@ doOutputLastTimestep(Process const& process,
         doOutputAlways(process, timestep, t, x);
 }
 
-void Output::doOutputNonlinearIteration(Process const& process,
+void Output::doOutputNonlinearIteration(Process& process,
                                         const unsigned timestep, const double t,
                                         GlobalVector const& x,
                                         const unsigned iteration) const
 {
     if (!_output_nonlinear_iteration_results) return;
 
-    BaseLib::RunTime time_output;
-    time_output.start();
+    OGS_PROFILE_SCOPE("output");
 
     auto spd_it = _single_process_data.find(&process);
     if (spd_it == _single_process_data.end()) {
@@ -172,9 +194,7 @@ void Output::doOutputNonlinearIteration(Process const& process,
             + "_nliter_" + std::to_string(iteration)
             + ".vtu";
     DBUG("output iteration results to %s", output_file_name.c_str());
-    process.output(output_file_name, timestep, x);
-
-    INFO("[time] Output took %g s.", time_output.elapsed());
+    process.output(output_file_name, timestep, t, x);
 }
 
 }
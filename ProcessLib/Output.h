@@ -12,6 +12,7 @@
 
 #include "BaseLib/ConfigTree.h"
 #include "MeshLib/IO/VtkIO/PVDFile.h"
+#include "MeshLib/IO/XDMF/XdmfTimeSeriesWriter.h"
 #include "Process.h"
 
 namespace ProcessLib
@@ -32,13 +33,20 @@ public:
     using ProcessIter = std::vector<std::unique_ptr<ProcessLib::Process>>
                         ::const_iterator;
 
-    //! Opens a PVD file for each process.
+    //! Output file formats.
+    enum class OutputType
+    {
+        VTK,    //!< a vtu file per timestep and a pvd file
+        XDMF    //!< a single xdmf file, unchanged data is written only once
+    };
+
+    //! Opens a PVD or XDMF file for each process.
     void initialize(ProcessIter first, const ProcessIter& last);
 
     //! Writes output for the given \c process if it should be written in the
     //! given \c timestep.
     void doOutput(
-            Process const& process, unsigned timestep,
+            Process& process, unsigned timestep,
             const double t,
             GlobalVector const& x);
 
@@ -46,7 +54,7 @@ public:
     //! This method is intended for doing output after the last timestep in order
     //! to make sure that its results are written.
     void doOutputLastTimestep(
-            Process const& process, unsigned timestep,
+            Process& process, unsigned timestep,
             const double t,
             GlobalVector const& x);
 
@@ -54,13 +62,13 @@ public:
     //! This method will always write.
     //! It is intended to write output in error handling routines.
     void doOutputAlways(
-            Process const& process, unsigned timestep,
+            Process& process, unsigned timestep,
             const double t,
             GlobalVector const& x);
 
     //! Writes output for the given \c process.
     //! To be used for debug output after an iteration of the nonlinear solver.
-    void doOutputNonlinearIteration(Process const& process,
+    void doOutputNonlinearIteration(Process& process,
                                     const unsigned timestep, const double t,
                                     GlobalVector const& x,
                                     const unsigned iteration) const;
@@ -78,22 +86,32 @@ private:
     struct SingleProcessData
     {
         SingleProcessData(unsigned process_index_,
-                          std::string const& filename)
+                          std::string const& filename,
+                          OutputType const type)
             : process_index(process_index_)
-            , pvd_file(filename)
+            , pvd_file(filename + ".pvd")
+            , xdmf_writer(type == OutputType::XDMF
+                              ? new MeshLib::IO::XdmfTimeSeriesWriter(
+                                    filename + ".xdmf")
+                              : nullptr)
         {}
 
         const unsigned process_index;
         MeshLib::IO::PVDFile pvd_file;
+        //! Only set for XDMF output.
+        std::unique_ptr<MeshLib::IO::XdmfTimeSeriesWriter> xdmf_writer;
     };
 
-    Output(std::string const& prefix, bool output_nonlinear_iteration_results)
+    Output(std::string const& prefix, OutputType const type,
+           bool output_nonlinear_iteration_results)
         : _output_file_prefix(prefix),
+          _output_type(type),
           _output_nonlinear_iteration_results(
               output_nonlinear_iteration_results)
     {}
 
     std::string const _output_file_prefix;
+    OutputType const _output_type;
     bool const _output_nonlinear_iteration_results;
 
     //! Describes after which timesteps to write output.
@@ -23,10 +23,22 @@ std::unique_ptr<ParameterBase> createConstParameter(
     //! \ogs_file_param{parameter__type}
     config.checkConfigParameter("type", "Constant");
     //! \ogs_file_param{parameter__Constant__value}
-    auto value = config.getConfigParameter<double>("value");
-    DBUG("Using value %g", value);
+    if (auto const value = config.getConfigParameterOptional<double>("value"))
+    {
+        DBUG("Using value %g", *value);
+        return std::unique_ptr<ParameterBase>(
+            new ConstParameter<double>(*value));
+    }
 
-    return std::unique_ptr<ParameterBase>(new ConstParameter<double>(value));
+    // Tuple-valued constant, e.g. an anisotropic tensor.
+    //! \ogs_file_param{parameter__Constant__values}
+    auto values = config.getConfigParameter<std::vector<double>>("values");
+    if (values.empty())
+        OGS_FATAL("No values given for the constant parameter.");
+    DBUG("Using %lu values.", static_cast<unsigned long>(values.size()));
+
+    return std::unique_ptr<ParameterBase>(
+        new ConstParameter<double>(std::move(values)));
 }
 
 std::unique_ptr<ParameterBase> createMeshPropertyParameter(
@@ -51,7 +63,31 @@ std::unique_ptr<ParameterBase> createMeshPropertyParameter(
             field_name.c_str());
     }
 
+    // Cell properties can store several tuples per element, one for each
+    // integration point.
+    unsigned n_integration_points = 0;
+    //! \ogs_file_param{parameter__MeshProperty__integration_points}
+    if (auto const n_ips = config.getConfigParameterOptional<unsigned>(
+            "integration_points"))
+    {
+        if (property->getMeshItemType() != MeshLib::MeshItemType::Cell)
+        {
+            OGS_FATAL(
+                "Integration point resolved parameters must be given by a "
+                "cell property, but %s is not.",
+                field_name.c_str());
+        }
+        if (*n_ips == 0 || property->getNumberOfComponents() % *n_ips != 0)
+        {
+            OGS_FATAL(
+                "The number of components (%d) of the property %s is not a "
+                "multiple of the given number of integration points (%d).",
+                property->getNumberOfComponents(), field_name.c_str(), *n_ips);
+        }
+        n_integration_points = *n_ips;
+    }
+
     return std::unique_ptr<ParameterBase>(
-        new MeshPropertyParameter<double>(*property));
+        new MeshPropertyParameter<double>(*property, n_integration_points));
 }
 }  // namespace ProcessLib
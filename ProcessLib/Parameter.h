@@ -10,19 +10,17 @@
 #ifndef PROCESS_LIB_PARAMETER_H_
 #define PROCESS_LIB_PARAMETER_H_
 
+#include <cassert>
 #include <memory>
+#include <vector>
 
 #include <logog/include/logog.hpp>
 #include <boost/optional.hpp>
 
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
 #include "MeshLib/Elements/Element.h"
-
-namespace MeshLib
-{
-template <typename T>
-class PropertyVector;
-}
+#include "MeshLib/PropertyVector.h"
 
 namespace ProcessLib
 {
@@ -48,43 +46,229 @@ struct Parameter : public ParameterBase
     virtual ReturnType operator()(Args&&... args) const = 0;
 };
 
-/// Single, constant value parameter.
+/// Describes to which mesh items the values of a SpatialParameter belong.
+enum class ParameterResolution
+{
+    Constant,         ///< One value tuple for the whole domain.
+    Element,          ///< One value tuple per element.
+    Node,             ///< One value tuple per mesh node.
+    IntegrationPoint  ///< One value tuple per integration point of an element.
+};
+
+/// A parameter distributed in space, which can be evaluated for a whole
+/// element at once.
+///
+/// Each value is a tuple of getNumberOfComponents() entries, e.g. one entry
+/// for a scalar or \f$d \times d\f$ entries for a tensor stored in row-major
+/// order.
+/// Local assemblers should use evaluateAtIntegrationPoints() once per element
+/// instead of calling operator() inside of their integration point loops.
+template <typename ReturnType>
+struct SpatialParameter : public Parameter<ReturnType, MeshLib::Element const&>
+{
+    virtual ParameterResolution getResolution() const = 0;
+
+    virtual unsigned getNumberOfComponents() const = 0;
+
+    /// Copies all value tuples associated with the given element to \c values
+    /// overwriting its previous contents. Depending on getResolution() these
+    /// are one, one per element node or one per integration point tuples.
+    virtual void getElementValues(MeshLib::Element const& e,
+                                  std::vector<ReturnType>& values) const = 0;
+};
+
+/// Evaluates the \c parameter at all integration points of the element \c e.
+///
+/// The shape matrices are used to interpolate node-resolved parameters to the
+/// integration points. The result is stored in the caller-provided buffer
+/// \c values, which is reused between calls to avoid allocations.
+///
+/// \return the stride between the value tuples of two consecutive integration
+/// points, i.e., the tuple of integration point \c ip starts at
+/// <tt>values[ip * stride]</tt>. For constant and element-wise parameters the
+/// stride is zero since all integration points share a single tuple.
+template <typename ReturnType, typename ShapeMatricesVector>
+std::size_t evaluateAtIntegrationPoints(
+    SpatialParameter<ReturnType> const& parameter,
+    MeshLib::Element const& e,
+    ShapeMatricesVector const& shape_matrices,
+    std::vector<ReturnType>& values)
+{
+    parameter.getElementValues(e, values);
+
+    std::size_t const n_components = parameter.getNumberOfComponents();
+    switch (parameter.getResolution())
+    {
+        case ParameterResolution::Constant:
+        case ParameterResolution::Element:
+            return 0;
+        case ParameterResolution::IntegrationPoint:
+            assert(values.size() == shape_matrices.size() * n_components);
+            return n_components;
+        case ParameterResolution::Node:
+            break;
+    }
+
+    // Interpolate the nodal values to the integration points. The results are
+    // appended to the nodal values, which are removed afterwards.
+    std::size_t const n_nodal_values = values.size();
+    std::size_t const n_nodes = n_nodal_values / n_components;
+    values.resize(n_nodal_values + shape_matrices.size() * n_components);
+    for (std::size_t ip = 0; ip < shape_matrices.size(); ++ip)
+    {
+        auto const& N = shape_matrices[ip].N;
+        for (std::size_t c = 0; c < n_components; ++c)
+        {
+            ReturnType v = 0;
+            for (std::size_t n = 0; n < n_nodes; ++n)
+                v += N[n] * values[n * n_components + c];
+            values[n_nodal_values + ip * n_components + c] = v;
+        }
+    }
+    values.erase(values.begin(), values.begin() + n_nodal_values);
+
+    return n_components;
+}
+
+/// Single, constant value parameter. The value can be a tuple, e.g. an
+/// anisotropic tensor.
 template <typename ReturnType>
-struct ConstParameter final
-    : public Parameter<ReturnType, MeshLib::Element const&>
+struct ConstParameter final : public SpatialParameter<ReturnType>
 {
-    ConstParameter(ReturnType value) : _value(value)
+    ConstParameter(ReturnType value) : _values(1, value)
     {
     }
 
+    ConstParameter(std::vector<ReturnType> values) : _values(std::move(values))
+    {
+        assert(!_values.empty());
+    }
+
+    /// Returns the value of a scalar parameter. Parameters with several
+    /// components have to be evaluated by getElementValues().
     ReturnType operator()(MeshLib::Element const&) const override
     {
-        return _value;
+        if (_values.size() != 1)
+            OGS_FATAL(
+                "The constant parameter has %lu components and cannot be "
+                "evaluated as a scalar.",
+                static_cast<unsigned long>(_values.size()));
+        return _values.front();
+    }
+
+    ParameterResolution getResolution() const override
+    {
+        return ParameterResolution::Constant;
+    }
+
+    unsigned getNumberOfComponents() const override
+    {
+        return static_cast<unsigned>(_values.size());
+    }
+
+    void getElementValues(MeshLib::Element const&,
+                          std::vector<ReturnType>& values) const override
+    {
+        values.assign(_values.cbegin(), _values.cend());
     }
 
 private:
-    ReturnType _value;
+    std::vector<ReturnType> const _values;
 };
 
 std::unique_ptr<ParameterBase> createConstParameter(BaseLib::ConfigTree const& config);
 
 /// A parameter represented by a mesh property vector.
+///
+/// Cell properties provide one tuple per element, or one tuple per
+/// integration point if the number of integration points per element is
+/// given. Node properties provide one tuple per node, which is interpolated
+/// to the integration points by evaluateAtIntegrationPoints().
 template <typename ReturnType>
-struct MeshPropertyParameter final
-    : public Parameter<ReturnType, MeshLib::Element const&>
+struct MeshPropertyParameter final : public SpatialParameter<ReturnType>
 {
-    MeshPropertyParameter(MeshLib::PropertyVector<ReturnType> const& property)
-        : _property(property)
+    /// \param n_integration_points number of integration points per element
+    /// for integration point resolved cell properties; zero otherwise.
+    MeshPropertyParameter(MeshLib::PropertyVector<ReturnType> const& property,
+                          unsigned const n_integration_points = 0)
+        : _property(property),
+          _resolution(property.getMeshItemType() == MeshLib::MeshItemType::Node
+                          ? ParameterResolution::Node
+                          : n_integration_points == 0
+                                ? ParameterResolution::Element
+                                : ParameterResolution::IntegrationPoint),
+          _n_tuples_per_element(
+              n_integration_points == 0 ? 1 : n_integration_points),
+          _n_components(static_cast<unsigned>(property.getNumberOfComponents() /
+                                              _n_tuples_per_element))
     {
+        assert(_n_components * _n_tuples_per_element ==
+               property.getNumberOfComponents());
     }
 
+    /// Returns the value of a scalar parameter for the element. Node and
+    /// integration point resolved parameters return the average over the
+    /// element's nodes or integration points, respectively. Parameters with
+    /// several components have to be evaluated by getElementValues().
     ReturnType operator()(MeshLib::Element const& e) const override
     {
-        return _property[e.getID()];
+        if (_n_components != 1)
+            OGS_FATAL(
+                "The mesh property parameter `%s' has %u components and "
+                "cannot be evaluated as a scalar.",
+                this->name.c_str(), _n_components);
+
+        if (_resolution == ParameterResolution::Element)
+            return _property[e.getID()];
+
+        ReturnType sum = 0;
+        if (_resolution == ParameterResolution::Node)
+        {
+            unsigned const n_nodes = e.getNumberOfNodes();
+            for (unsigned n = 0; n < n_nodes; ++n)
+                sum += _property[e.getNodeIndex(n)];
+            return sum / n_nodes;
+        }
+
+        std::size_t const offset =
+            static_cast<std::size_t>(e.getID()) * _n_tuples_per_element;
+        for (std::size_t i = 0; i < _n_tuples_per_element; ++i)
+            sum += _property[offset + i];
+        return sum / _n_tuples_per_element;
+    }
+
+    ParameterResolution getResolution() const override { return _resolution; }
+
+    unsigned getNumberOfComponents() const override { return _n_components; }
+
+    void getElementValues(MeshLib::Element const& e,
+                          std::vector<ReturnType>& values) const override
+    {
+        if (_resolution == ParameterResolution::Node)
+        {
+            unsigned const n_nodes = e.getNumberOfNodes();
+            values.resize(n_nodes * _n_components);
+            for (unsigned n = 0; n < n_nodes; ++n)
+            {
+                auto const first =
+                    _property.cbegin() + e.getNodeIndex(n) * _n_components;
+                std::copy(first, first + _n_components,
+                          values.begin() + n * _n_components);
+            }
+            return;
+        }
+
+        std::size_t const tuple_size =
+            static_cast<std::size_t>(_n_tuples_per_element) * _n_components;
+        auto const first = _property.cbegin() + e.getID() * tuple_size;
+        values.assign(first, first + tuple_size);
     }
 
 private:
     MeshLib::PropertyVector<ReturnType> const& _property;
+    ParameterResolution const _resolution;
+    unsigned const _n_tuples_per_element;
+    unsigned const _n_components;
 };
 
 std::unique_ptr<ParameterBase> createMeshPropertyParameter(BaseLib::ConfigTree const& config, MeshLib::Mesh const& mesh);
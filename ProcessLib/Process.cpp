@@ -33,10 +33,29 @@ Process::Process(
 
 void Process::output(std::string const& file_name,
                      const unsigned /*timestep*/,
-                     GlobalVector const& x) const
+                     const double t,
+                     GlobalVector const& x)
 {
+    computeSecondaryVariable(t, x);
+
     doProcessOutput(file_name, x, _mesh, *_local_to_global_index_map,
-                    _process_variables, _secondary_variables, _process_output);
+                    getSingleComponentDOFTable(), _process_variables,
+                    _secondary_variables, _process_output);
+}
+
+void Process::prepareOutput(const double t, GlobalVector const& x)
+{
+    computeSecondaryVariable(t, x);
+
+    processOutputData(x, _mesh, *_local_to_global_index_map,
+                      getSingleComponentDOFTable(), _process_variables,
+                      _secondary_variables, _process_output);
+}
+
+void Process::computeSecondaryVariable(const double t, GlobalVector const& x)
+{
+    DBUG("Compute secondary variables.");
+    computeSecondaryVariableConcrete(t, x);
 }
 
 void Process::initialize()
@@ -150,6 +169,9 @@ void Process::constructDofTable()
 
     _local_to_global_index_map.reset(new NumLib::LocalToGlobalIndexMap(
         std::move(all_mesh_subsets), NumLib::ComponentOrder::BY_LOCATION));
+
+    _accounted_memory.add("DOF tables",
+                          _local_to_global_index_map->getMemoryUsage());
 }
 
 void Process::initializeExtrapolator()
@@ -177,6 +199,9 @@ void Process::initializeExtrapolator()
             // by location order is needed for output
             NumLib::ComponentOrder::BY_LOCATION);
         manage_storage = true;
+
+        _accounted_memory.add("DOF tables",
+                              dof_table_single_component->getMemoryUsage());
     }
 
     std::unique_ptr<NumLib::Extrapolator> extrapolator(
@@ -220,6 +245,9 @@ void Process::computeSparsityPattern()
 {
     _sparsity_pattern =
         NumLib::computeSparsityPattern(*_local_to_global_index_map, _mesh);
+
+    _accounted_memory.add("sparsity patterns",
+                          BaseLib::getMemoryUsage(_sparsity_pattern));
 }
 
 ProcessVariable& findProcessVariable(
@@ -10,6 +10,7 @@
 #ifndef PROCESS_LIB_PROCESS_H_
 #define PROCESS_LIB_PROCESS_H_
 
+#include "BaseLib/MemoryAccounting.h"
 #include "NumLib/ODESolver/NonlinearSolver.h"
 #include "NumLib/ODESolver/ODESystem.h"
 #include "NumLib/ODESolver/TimeDiscretization.h"
@@ -54,9 +55,23 @@ public:
     virtual void postTimestep(GlobalVector const& /*x*/) {}
     /// Process output.
     /// The file_name is indicating the name of possible output file.
+    /// Secondary variables are computed for the given solution beforehand.
     void output(std::string const& file_name,
                 const unsigned /*timestep*/,
-                GlobalVector const& x) const;
+                const double t,
+                GlobalVector const& x);
+
+    /// Computes the secondary variables for the given solution and stores
+    /// all output variables in property vectors of the process' mesh, e.g.
+    /// for writing them with a time series writer.
+    void prepareOutput(const double t, GlobalVector const& x);
+
+    MeshLib::Mesh const& getMesh() const { return _mesh; }
+
+    /// Computes secondary variables, e.g. integration point values which are
+    /// only needed for output, for the given solution. This is done on output
+    /// steps only and not in every assembly.
+    void computeSecondaryVariable(const double t, GlobalVector const& x);
 
     void initialize();
 
@@ -109,6 +124,11 @@ private:
                                          GlobalMatrix& M, GlobalMatrix& K,
                                          GlobalVector& b) = 0;
 
+    virtual void computeSecondaryVariableConcrete(const double /*t*/,
+                                                  GlobalVector const& /*x*/)
+    {
+    }
+
     virtual void assembleJacobianConcreteProcess(
         const double /*t*/, GlobalVector const& /*x*/,
         GlobalVector const& /*xdot*/, const double /*dxdot_dx*/,
@@ -139,6 +159,11 @@ protected:
     SecondaryVariableCollection _secondary_variables;
     ProcessOutput _process_output;
 
+    /// Memory of the DOF tables, the sparsity pattern and the local
+    /// assemblers attributed to the BaseLib::MemoryAccounting while the
+    /// process exists.
+    BaseLib::AccountedMemory _accounted_memory;
+
 private:
     unsigned const _integration_order = 2;
     GlobalSparsityPattern _sparsity_pattern;
@@ -224,6 +249,26 @@ Parameter<ParameterArgs...>& findParameter(
     return *parameter;
 }
 
+/// Find a spatially distributed parameter for a name given in the process
+/// configuration under the tag, like findParameter() does. Additionally checks
+/// that the found parameter can be evaluated for whole elements at once.
+template <typename ReturnType>
+SpatialParameter<ReturnType>& findSpatialParameter(
+    BaseLib::ConfigTree const& process_config, std::string const& tag,
+    std::vector<std::unique_ptr<ParameterBase>> const& parameters)
+{
+    auto& parameter = findParameter<ReturnType, MeshLib::Element const&>(
+        process_config, tag, parameters);
+
+    auto* const spatial_parameter =
+        dynamic_cast<SpatialParameter<ReturnType>*>(&parameter);
+    if (!spatial_parameter) {
+        OGS_FATAL("The parameter '%s' is not a spatial parameter.",
+                  parameter.name.c_str());
+    }
+    return *spatial_parameter;
+}
+
 }  // namespace ProcessLib
 
 #endif  // PROCESS_LIB_PROCESS_H_
@@ -9,9 +9,25 @@
 
 #include "ProcessOutput.h"
 
+#include "MeshLib/IO/VtkIO/StreamingVtuWriter.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 
+namespace
+{
+//! Copies the local entries of \c x, including the ghost entries under PETSc.
+std::vector<double> copyLocalValues(GlobalVector const& x)
+{
+#ifdef USE_PETSC
+    std::vector<double> x_copy(x.getLocalSize() + x.getGhostSize());
+#else
+    std::vector<double> x_copy(x.size());
+#endif
+    x.copyValues(x_copy);
+    return x_copy;
+}
+}  // anonymous namespace
+
 namespace ProcessLib
 {
 
@@ -67,28 +83,23 @@ ProcessOutput::ProcessOutput(BaseLib::ConfigTree const& output_config,
 }
 
 
-void doProcessOutput(
-        std::string const& file_name,
+void processOutputData(
         GlobalVector const& x,
         MeshLib::Mesh& mesh,
         NumLib::LocalToGlobalIndexMap const& dof_table,
+        NumLib::LocalToGlobalIndexMap const& dof_table_single_component,
         std::vector<std::reference_wrapper<ProcessVariable>> const&
         process_variables,
-        SecondaryVariableCollection secondary_variables,
+        SecondaryVariableCollection const& secondary_variables,
         ProcessOutput const& process_output)
 {
-    DBUG("Process output.");
+    DBUG("Process output data.");
 
     // Copy result
-#ifdef USE_PETSC
     // TODO It is also possible directly to copy the data for single process
     // variable to a mesh property. It needs a vector of global indices and
     // some PETSc magic to do so.
-    std::vector<double> x_copy(x.getLocalSize() + x.getGhostSize());
-#else
-    std::vector<double> x_copy(x.size());
-#endif
-    x.copyValues(x_copy);
+    auto const x_copy = copyLocalValues(x);
 
     auto const& output_variables = process_output.output_variables;
 
@@ -130,7 +141,6 @@ void doProcessOutput(
         }
     }
 
-#ifndef USE_PETSC
     // the following section is for the output of secondary variables
 
     auto count_mesh_items = [](
@@ -183,12 +193,19 @@ void doProcessOutput(
             std::unique_ptr<GlobalVector> result_cache;
             auto const& nodal_values =
                     var.fcts.eval_field(x, dof_table, result_cache);
+            // Under PETSc this also fetches the values of the ghost nodes.
+            auto const nodal_values_copy = copyLocalValues(nodal_values);
 
             // Copy result
             for (std::size_t i = 0; i < mesh.getNumberOfNodes(); ++i)
             {
-                assert(!std::isnan(nodal_values[i]));
-                (*result)[i] = nodal_values[i];
+                MeshLib::Location const l(mesh.getID(),
+                                          MeshLib::MeshItemType::Node, i);
+                auto const index = dof_table_single_component.getLocalIndex(
+                    l, 0, nodal_values.getRangeBegin(),
+                    nodal_values.getRangeEnd());
+                assert(!std::isnan(nodal_values_copy[index]));
+                (*result)[i] = nodal_values_copy[index];
             }
         }
 
@@ -204,12 +221,16 @@ void doProcessOutput(
             std::unique_ptr<GlobalVector> result_cache;
             auto const& residuals =
                     var.fcts.eval_residuals(x, dof_table, result_cache);
+            // The residuals are stored for the local elements in their
+            // order in the mesh.
+            auto const residuals_copy = copyLocalValues(residuals);
+            assert(residuals_copy.size() == mesh.getNumberOfElements());
 
             // Copy result
             for (std::size_t i = 0; i < mesh.getNumberOfElements(); ++i)
             {
-                assert(!std::isnan(residuals[i]));
-                (*result)[i] = residuals[i];
+                assert(!std::isnan(residuals_copy[i]));
+                (*result)[i] = residuals_copy[i];
             }
         }
     };
@@ -224,14 +245,34 @@ void doProcessOutput(
     }
 
     // secondary variables output end
-#else
-    (void) secondary_variables;
-#endif // USE_PETSC
+}
+
+void doProcessOutput(
+        std::string const& file_name,
+        GlobalVector const& x,
+        MeshLib::Mesh& mesh,
+        NumLib::LocalToGlobalIndexMap const& dof_table,
+        NumLib::LocalToGlobalIndexMap const& dof_table_single_component,
+        std::vector<std::reference_wrapper<ProcessVariable>> const&
+        process_variables,
+        SecondaryVariableCollection secondary_variables,
+        ProcessOutput const& process_output)
+{
+    DBUG("Process output.");
+
+    processOutputData(x, mesh, dof_table, dof_table_single_component,
+                      process_variables, secondary_variables, process_output);
 
     // Write output file
     DBUG("Writing output to \'%s\'.", file_name.c_str());
+#ifdef USE_PETSC
     MeshLib::IO::VtuInterface vtu_interface(&mesh, vtkXMLWriter::Binary, true);
     vtu_interface.writeToFile(file_name);
+#else
+    MeshLib::IO::StreamingVtuWriter vtu_writer(
+        mesh, MeshLib::IO::VtuDataMode::Appended, true);
+    vtu_writer.writeToFile(file_name);
+#endif
 }
 
 } // ProcessLib
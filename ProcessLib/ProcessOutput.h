@@ -35,12 +35,27 @@ struct ProcessOutput final
 };
 
 
+//! Copies the output variables, i.e. the primary variables from \c x and
+//! the secondary variables, to property vectors of the \c mesh.
+//! The nodal values of the secondary variables are indexed by the
+//! \c dof_table_single_component.
+void processOutputData(
+        GlobalVector const& x,
+        MeshLib::Mesh& mesh,
+        NumLib::LocalToGlobalIndexMap const& dof_table,
+        NumLib::LocalToGlobalIndexMap const& dof_table_single_component,
+        std::vector<std::reference_wrapper<ProcessVariable>> const&
+        process_variables,
+        SecondaryVariableCollection const& secondary_variables,
+        ProcessOutput const& process_output);
+
 //! Writes output to the given \c file_name using the VTU file format.
 void doProcessOutput(
         std::string const& file_name,
         GlobalVector const& x,
         MeshLib::Mesh& mesh,
         NumLib::LocalToGlobalIndexMap const& dof_table,
+        NumLib::LocalToGlobalIndexMap const& dof_table_single_component,
         std::vector<std::reference_wrapper<ProcessVariable>> const&
         process_variables,
         SecondaryVariableCollection secondary_variables,
@@ -138,7 +138,7 @@ MeshLib::PropertyVector<double>& ProcessVariable::getOrCreateMeshProperty()
     if (_mesh.getProperties().hasPropertyVector(_name))
     {
         auto result =
-            _mesh.getProperties().template getPropertyVector<double>(_name);
+            _mesh.getProperties().template getMutablePropertyVector<double>(_name);
         assert(result);
         assert(result->size() == _mesh.getNumberOfNodes() * _n_components);
         return *result;
@@ -32,6 +32,11 @@ struct SecondaryVariableFunctions final
      * \note The argument \c dof_table is the d.o.f. table of the process, i.e.
      * it possibly contains information about several process variables.
      *
+     * \note Nodal values must be stored at the global indices of the
+     * single-component d.o.f. table, and the returned vector must be
+     * assembled. Under PETSc each rank sets only the values of the nodes it
+     * owns; the ghost values are fetched from the owners on output.
+     *
      * \remark The \c result_cache can be used to store the \c GlobalVector if it
      * is computed on-the-fly. Then a reference to the result cache can be returned.
      * Otherwise the \c Function must return a reference to a \c GlobalVector that
@@ -9,6 +9,7 @@
 #ifndef PROCESS_LIB_TES_FEM_IMPL_H_
 #define PROCESS_LIB_TES_FEM_IMPL_H_
 
+#include "BaseLib/MemoryAccounting.h"
 #include "MaterialLib/Adsorption/Adsorption.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
@@ -190,6 +191,26 @@ void TESLocalAssembler<ShapeFunction_, IntegrationMethod_, GlobalDim>::
     b.add(indices.rows, _local_b);
 }
 
+template <typename ShapeFunction_, typename IntegrationMethod_,
+          unsigned GlobalDim>
+LocalAssemblerMemoryUsage TESLocalAssembler<
+    ShapeFunction_, IntegrationMethod_, GlobalDim>::getMemoryUsage() const
+{
+    auto const& data = _d.getData();
+
+    LocalAssemblerMemoryUsage usage;
+    usage.shape_matrices = getShapeMatricesMemoryUsage(_shape_matrices);
+    usage.integration_point_data =
+        BaseLib::getMemoryUsage(data.solid_density) +
+        BaseLib::getMemoryUsage(data.reaction_rate) +
+        BaseLib::getMemoryUsage(data.velocity) +
+        BaseLib::getMemoryUsage(data.solid_density_prev_ts) +
+        BaseLib::getMemoryUsage(data.reaction_rate_prev_ts);
+    for (auto const& v : data.velocity)
+        usage.integration_point_data += BaseLib::getMemoryUsage(v);
+    return usage;
+}
+
 template <typename ShapeFunction_, typename IntegrationMethod_,
           unsigned GlobalDim>
 std::vector<double> const& TESLocalAssembler<
@@ -86,6 +86,8 @@ public:
     bool checkBounds(std::vector<double> const& local_x,
                      std::vector<double> const& local_x_prev_ts) override;
 
+    LocalAssemblerMemoryUsage getMemoryUsage() const override;
+
     std::vector<double> const& getIntPtSolidDensity(
         std::vector<double>& /*cache*/) const override;
 
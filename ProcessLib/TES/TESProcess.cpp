@@ -9,6 +9,7 @@
 
 #include "TESProcess.h"
 
+#include "MathLib/LinAlg/LinAlg.h"
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
 
 // TODO Copied from VectorMatrixAssembler. Could be provided by the DOF table.
@@ -57,12 +58,28 @@ double getNodalValue(GlobalVector const& x, MeshLib::Mesh const& mesh,
     MeshLib::Location const l{mesh.getID(), MeshLib::MeshItemType::Node,
                               node_id};
 
-    auto const index = dof_table.getLocalIndex(
-        l, global_component_id, x.getRangeBegin(), x.getRangeEnd());
+    // Each TES process variable has a single component, i.e., the global
+    // component id equals the variable id. GlobalVector::get() takes global
+    // indices, hence this function must only be called for nodes owned by the
+    // present rank.
+    auto const index = dof_table.getGlobalIndex(l, global_component_id, 0);
+    assert(index >= 0);
 
     return x.get(index);
 }
 
+//! Returns the index of a node in a single-component vector. Under PETSc the
+//! index of a ghost node is negative; its value is computed by the rank owning
+//! the node and fetched together with the ghost entries of the vector.
+GlobalIndexType getNodeIndex(MeshLib::Mesh const& mesh,
+                             NumLib::LocalToGlobalIndexMap const& dof_table,
+                             std::size_t const node_id)
+{
+    MeshLib::Location const l{mesh.getID(), MeshLib::MeshItemType::Node,
+                              node_id};
+    return dof_table.getGlobalIndex(l, 0, 0);
+}
+
 namespace ProcessLib
 {
 namespace TES
@@ -174,6 +191,8 @@ void TESProcess::initializeConcreteProcess(
     ProcessLib::createLocalAssemblers<TESLocalAssembler>(
         mesh.getDimension(), mesh.getElements(), dof_table, integration_order,
         _local_assemblers, _assembly_params);
+    ProcessLib::accountLocalAssemblerMemory(_local_assemblers,
+                                            _accounted_memory);
 
     // secondary variables
     auto add2nd = [&](std::string const& var_name, unsigned const n_components,
@@ -271,7 +290,7 @@ NumLib::IterationResult TESProcess::postIteration(
             "_" + std::to_string(_assembly_params.number_of_try_of_iteration) +
             ".vtu";
 
-        this->output(fn, 0, x);
+        this->output(fn, 0, _assembly_params.current_time, x);
     }
 
     bool check_passed = true;
@@ -333,6 +352,11 @@ TESProcess::computeVapourPartialPressure(
 
     for (GlobalIndexType node_id = 0; node_id < nnodes; ++node_id)
     {
+        auto const result_index =
+            getNodeIndex(this->_mesh, dof_table_single, node_id);
+        if (result_index < 0)  // ghost node
+            continue;
+
         auto const p = getNodalValue(x, this->_mesh, dof_table, node_id,
                                      COMPONENT_ID_PRESSURE);
         auto const x_mV = getNodalValue(x, this->_mesh, dof_table, node_id,
@@ -341,10 +365,10 @@ TESProcess::computeVapourPartialPressure(
         auto const x_nV = Adsorption::AdsorptionReaction::getMolarFraction(
             x_mV, _assembly_params.M_react, _assembly_params.M_inert);
 
-        // TODO Problems with PETSc? (local vs. global index)
-        result_cache->set(node_id, p * x_nV);
+        result_cache->set(result_index, p * x_nV);
     }
 
+    MathLib::LinAlg::finalizeAssembly(*result_cache);
     return *result_cache;
 }
 
@@ -366,6 +390,11 @@ TESProcess::computeRelativeHumidity(
 
     for (GlobalIndexType node_id = 0; node_id < nnodes; ++node_id)
     {
+        auto const result_index =
+            getNodeIndex(this->_mesh, dof_table_single, node_id);
+        if (result_index < 0)  // ghost node
+            continue;
+
         auto const p = getNodalValue(x, this->_mesh, dof_table, node_id,
                                      COMPONENT_ID_PRESSURE);
         auto const T = getNodalValue(x, this->_mesh, dof_table, node_id,
@@ -379,10 +408,10 @@ TESProcess::computeRelativeHumidity(
         auto const p_S =
             Adsorption::AdsorptionReaction::getEquilibriumVapourPressure(T);
 
-        // TODO Problems with PETSc? (local vs. global index)
-        result_cache->set(node_id, p * x_nV / p_S);
+        result_cache->set(result_index, p * x_nV / p_S);
     }
 
+    MathLib::LinAlg::finalizeAssembly(*result_cache);
     return *result_cache;
 }
 
@@ -404,6 +433,11 @@ TESProcess::computeEquilibriumLoading(
 
     for (GlobalIndexType node_id = 0; node_id < nnodes; ++node_id)
     {
+        auto const result_index =
+            getNodeIndex(this->_mesh, dof_table_single, node_id);
+        if (result_index < 0)  // ghost node
+            continue;
+
         auto const p = getNodalValue(x, this->_mesh, dof_table, node_id,
                                      COMPONENT_ID_PRESSURE);
         auto const T = getNodalValue(x, this->_mesh, dof_table, node_id,
@@ -420,10 +454,10 @@ TESProcess::computeEquilibriumLoading(
                          : _assembly_params.react_sys->getEquilibriumLoading(
                                p_V, T, _assembly_params.M_react);
 
-        // TODO Problems with PETSc? (local vs. global index)
-        result_cache->set(node_id, C_eq);
+        result_cache->set(result_index, C_eq);
     }
 
+    MathLib::LinAlg::finalizeAssembly(*result_cache);
     return *result_cache;
 }
 
@@ -12,6 +12,7 @@
 #include <vector>
 #include <logog/include/logog.hpp>
 
+#include "BaseLib/MemoryAccounting.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 
 #include "LocalDataInitializer.h"
@@ -115,6 +116,26 @@ void createLocalAssemblers(
     }
 }
 
+/// Attributes the memory held by the local assemblers to the categories
+/// "shape matrices" and "integration point data" of \c accounted_memory.
+template <typename LocalAssemblerInterface>
+void accountLocalAssemblerMemory(
+    std::vector<std::unique_ptr<LocalAssemblerInterface>> const&
+        local_assemblers,
+    BaseLib::AccountedMemory& accounted_memory)
+{
+    std::size_t shape_matrices = 0;
+    std::size_t integration_point_data = 0;
+    for (auto const& local_assembler : local_assemblers)
+    {
+        auto const usage = local_assembler->getMemoryUsage();
+        shape_matrices += usage.shape_matrices;
+        integration_point_data += usage.integration_point_data;
+    }
+    accounted_memory.add("shape matrices", shape_matrices);
+    accounted_memory.add("integration point data", integration_point_data);
+}
+
 } // ProcessLib
 
 
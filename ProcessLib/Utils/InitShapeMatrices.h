@@ -11,6 +11,8 @@
 
 #include <vector>
 
+#include <Eigen/Core>
+
 #include "MeshLib/Elements/Element.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
 
@@ -46,6 +48,34 @@ initShapeMatrices(MeshLib::Element const& e, unsigned integration_order)
     return shape_matrices;
 }
 
+namespace detail
+{
+template <typename Derived>
+std::size_t getHeapMemoryUsage(Eigen::MatrixBase<Derived> const& m)
+{
+    return Derived::SizeAtCompileTime == Eigen::Dynamic
+               ? m.size() * sizeof(typename Derived::Scalar)
+               : 0;
+}
+}  // namespace detail
+
+/// Returns the memory in bytes held by the given shape matrices.
+template <typename ShapeMatrices>
+std::size_t getShapeMatricesMemoryUsage(
+    std::vector<ShapeMatrices> const& shape_matrices)
+{
+    std::size_t bytes = shape_matrices.capacity() * sizeof(ShapeMatrices);
+    for (auto const& sm : shape_matrices)
+    {
+        bytes += detail::getHeapMemoryUsage(sm.N) +
+                 detail::getHeapMemoryUsage(sm.dNdr) +
+                 detail::getHeapMemoryUsage(sm.J) +
+                 detail::getHeapMemoryUsage(sm.invJ) +
+                 detail::getHeapMemoryUsage(sm.dNdx);
+    }
+    return bytes;
+}
+
 } // ProcessLib
 
 
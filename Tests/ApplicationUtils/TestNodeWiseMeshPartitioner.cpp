@@ -0,0 +1,349 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Applications/Utils/ModelPreparation/PartitionMesh/NodeWiseMeshPartitioner.h"
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+#ifdef USE_PETSC
+#include <mpi.h>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/MPI_IO/NodePartitionedMeshReader.h"
+#include "MeshLib/NodePartitionedMesh.h"
+#endif
+
+namespace
+{
+/// Returns the number of nodes of each partition and checks that all
+/// partition IDs are valid.
+std::vector<std::size_t> getPartitionSizes(
+    std::vector<std::size_t> const& nodes_partition_ids,
+    std::size_t const n_partitions)
+{
+    std::vector<std::size_t> sizes(n_partitions, 0);
+    for (auto const part_id : nodes_partition_ids)
+    {
+        EXPECT_GT(n_partitions, part_id);
+        if (part_id < n_partitions)
+            ++sizes[part_id];
+    }
+    return sizes;
+}
+
+std::string readFile(std::string const& file_name)
+{
+    std::ifstream is(file_name, std::ios::binary);
+    EXPECT_TRUE(is.good()) << file_name;
+    return std::string(std::istreambuf_iterator<char>(is),
+                       std::istreambuf_iterator<char>());
+}
+
+/// Reads a binary file of the integer type of the partitioner.
+std::vector<ApplicationUtils::NodeWiseMeshPartitioner::IntegerType>
+readIntegers(std::string const& file_name)
+{
+    std::string const data = readFile(file_name);
+    using IntegerType = ApplicationUtils::NodeWiseMeshPartitioner::IntegerType;
+    std::vector<IntegerType> values(data.size() / sizeof(IntegerType));
+    std::copy(data.begin(), data.begin() + values.size() * sizeof(IntegerType),
+              reinterpret_cast<char*>(values.data()));
+    return values;
+}
+}  // anonymous namespace
+
+TEST(ApplicationUtilsNodeWiseMeshPartitioner, CoordinateBisection)
+{
+    for (std::size_t const n_partitions : {1, 2, 3, 4, 7})
+    {
+        std::unique_ptr<MeshLib::Mesh> mesh(
+            MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 4));
+        std::size_t const n_nodes = mesh->getNumberOfNodes();
+        ApplicationUtils::NodeWiseMeshPartitioner partitioner(n_partitions,
+                                                              std::move(mesh));
+        partitioner.partitionNodesByCoordinateBisection();
+
+        auto const& partition_ids = partitioner.getNodesPartitionIDs();
+        ASSERT_EQ(n_nodes, partition_ids.size());
+        auto const sizes = getPartitionSizes(partition_ids, n_partitions);
+        // Every split is at the median, hence the sizes differ by at most
+        // the depth of the recursion.
+        auto const minmax = std::minmax_element(sizes.begin(), sizes.end());
+        EXPECT_LT(0u, *minmax.first);
+        EXPECT_GE(3u, *minmax.second - *minmax.first);
+    }
+}
+
+TEST(ApplicationUtilsNodeWiseMeshPartitioner, CoordinateBisectionOfLine)
+{
+    // On a line the parts are consecutive intervals with increasing IDs.
+    std::size_t const n_partitions = 5;
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateLineMesh(1.0, 99));
+    std::vector<double> x;
+    for (auto const* node : mesh->getNodes())
+        x.push_back((*node)[0]);
+    ApplicationUtils::NodeWiseMeshPartitioner partitioner(n_partitions,
+                                                          std::move(mesh));
+    partitioner.partitionNodesByCoordinateBisection();
+
+    auto const& partition_ids = partitioner.getNodesPartitionIDs();
+    auto const sizes = getPartitionSizes(partition_ids, n_partitions);
+    for (auto const size : sizes)
+        EXPECT_EQ(20u, size);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        for (std::size_t j = 0; j < x.size(); ++j)
+            if (x[i] < x[j])
+                EXPECT_LE(partition_ids[i], partition_ids[j]);
+}
+
+TEST(ApplicationUtilsNodeWiseMeshPartitioner, METIS)
+{
+    for (std::size_t const n_partitions : {1, 2, 5})
+    {
+        std::unique_ptr<MeshLib::Mesh> mesh(
+            MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 10));
+        std::size_t const n_nodes = mesh->getNumberOfNodes();
+        ApplicationUtils::NodeWiseMeshPartitioner partitioner(n_partitions,
+                                                              std::move(mesh));
+        partitioner.partitionNodesByMETIS();
+
+        auto const& partition_ids = partitioner.getNodesPartitionIDs();
+        ASSERT_EQ(n_nodes, partition_ids.size());
+        auto const sizes = getPartitionSizes(partition_ids, n_partitions);
+        // METIS balances the parts up to a small imbalance.
+        for (auto const size : sizes)
+        {
+            EXPECT_LT(0u, size);
+            EXPECT_GE(1.3 * n_nodes / n_partitions, size);
+        }
+    }
+}
+
+// The partition files of a 3x3 quad mesh split into two partitions along the
+// x-axis as written by the partitioner that extracted one partition after the
+// other, i.e. before the extraction of all partitions in one sweep.
+TEST(ApplicationUtilsNodeWiseMeshPartitioner, SameOutputAsPartitionWise)
+{
+    std::string const file_name_base =
+        BaseLib::BuildInfo::tests_tmp_path + "/NodeWiseMeshPartitioner";
+    {
+        std::unique_ptr<MeshLib::Mesh> mesh(
+            MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 3));
+        ApplicationUtils::NodeWiseMeshPartitioner partitioner(2,
+                                                              std::move(mesh));
+        partitioner.partitionNodesByCoordinateBisection();
+        partitioner.partitionByMETIS(false);
+        partitioner.writeASCII(file_name_base);
+        partitioner.writeBinary(file_name_base);
+    }
+
+    std::string const expected_cfg =
+        "Subdomain mesh (Number of nodes; Number of base nodes; Number of "
+        "regular elements; Number of ghost elements; Number of non-ghost base "
+        "nodes; Number of non-ghost nodes Number of base nodes of the global "
+        "mesh; Number of nodes of the global mesh; Number of integer variables "
+        "to define non-ghost elements; Number of integer variables to define "
+        "ghost elements.)\n"
+        "2\n"
+        "12 12 3 3 8 8 16 16 21 21 0\n"
+        "12 12 3 3 8 8 16 16 21 21 0\n";
+    std::string const expected_elems =
+        "0 6 4  0 1 3 2\n"
+        "0 6 4  2 3 5 4\n"
+        "0 6 4  4 5 7 6\n"
+        "0 6 4  1 8 9 3\n"
+        "0 6 4  3 9 10 5\n"
+        "0 6 4  5 10 11 7\n"
+        "\n"
+        "0 6 4  0 1 3 2\n"
+        "0 6 4  2 3 5 4\n"
+        "0 6 4  4 5 7 6\n"
+        "0 6 4  8 0 2 9\n"
+        "0 6 4  9 2 4 10\n"
+        "0 6 4  10 4 6 11\n"
+        "\n";
+    std::string const expected_nodes =
+        "0 0.000000000000000e+00 0.000000000000000e+00 0.000000000000000e+00\n"
+        "1 3.333333333333333e-01 0.000000000000000e+00 0.000000000000000e+00\n"
+        "2 0.000000000000000e+00 3.333333333333333e-01 0.000000000000000e+00\n"
+        "3 3.333333333333333e-01 3.333333333333333e-01 0.000000000000000e+00\n"
+        "4 0.000000000000000e+00 6.666666666666666e-01 0.000000000000000e+00\n"
+        "5 3.333333333333333e-01 6.666666666666666e-01 0.000000000000000e+00\n"
+        "6 0.000000000000000e+00 1.000000000000000e+00 0.000000000000000e+00\n"
+        "7 3.333333333333333e-01 1.000000000000000e+00 0.000000000000000e+00\n"
+        "8 6.666666666666666e-01 0.000000000000000e+00 0.000000000000000e+00\n"
+        "10 6.666666666666666e-01 3.333333333333333e-01 0.000000000000000e+00\n"
+        "12 6.666666666666666e-01 6.666666666666666e-01 0.000000000000000e+00\n"
+        "14 6.666666666666666e-01 1.000000000000000e+00 0.000000000000000e+00\n"
+        "\n"
+        "8 6.666666666666666e-01 0.000000000000000e+00 0.000000000000000e+00\n"
+        "9 1.000000000000000e+00 0.000000000000000e+00 0.000000000000000e+00\n"
+        "10 6.666666666666666e-01 3.333333333333333e-01 0.000000000000000e+00\n"
+        "11 1.000000000000000e+00 3.333333333333333e-01 0.000000000000000e+00\n"
+        "12 6.666666666666666e-01 6.666666666666666e-01 0.000000000000000e+00\n"
+        "13 1.000000000000000e+00 6.666666666666666e-01 0.000000000000000e+00\n"
+        "14 6.666666666666666e-01 1.000000000000000e+00 0.000000000000000e+00\n"
+        "15 1.000000000000000e+00 1.000000000000000e+00 0.000000000000000e+00\n"
+        "1 3.333333333333333e-01 0.000000000000000e+00 0.000000000000000e+00\n"
+        "3 3.333333333333333e-01 3.333333333333333e-01 0.000000000000000e+00\n"
+        "5 3.333333333333333e-01 6.666666666666666e-01 0.000000000000000e+00\n"
+        "7 3.333333333333333e-01 1.000000000000000e+00 0.000000000000000e+00\n"
+        "\n";
+    EXPECT_EQ(expected_cfg, readFile(file_name_base + "_partitioned_cfg2.msh"));
+    EXPECT_EQ(expected_elems,
+              readFile(file_name_base + "_partitioned_elems_2.msh"));
+    EXPECT_EQ(expected_nodes,
+              readFile(file_name_base + "_partitioned_nodes_2.msh"));
+
+    using IntegerType = ApplicationUtils::NodeWiseMeshPartitioner::IntegerType;
+    std::vector<IntegerType> const expected_cfg_bin = {
+        12, 12, 3, 3, 8, 8, 16, 16, 21, 21, 0,   0,   0,   0,
+        12, 12, 3, 3, 8, 8, 16, 16, 21, 21, 384, 192, 192, 0};
+    EXPECT_EQ(expected_cfg_bin,
+              readIntegers(file_name_base + "_partitioned_msh_cfg2.bin"));
+    std::vector<IntegerType> const expected_elems_bin = {
+        3, 10, 17, 0, 6, 4, 0, 1, 3, 2, 0, 6, 4, 2, 3, 5, 4, 0, 6, 4, 4, 5, 7, 6,
+        3, 10, 17, 0, 6, 4, 0, 1, 3, 2, 0, 6, 4, 2, 3, 5, 4, 0, 6, 4, 4, 5, 7, 6};
+    EXPECT_EQ(expected_elems_bin,
+              readIntegers(file_name_base + "_partitioned_msh_ele2.bin"));
+    std::vector<IntegerType> const expected_ghost_elems_bin = {
+        3, 10, 17, 0, 6, 4, 1, 8, 9, 3, 0, 6, 4, 3, 9, 10, 5, 0, 6, 4, 5, 10,
+        11, 7, 3, 10, 17, 0, 6, 4, 8, 0, 2, 9, 0, 6, 4, 9, 2, 4, 10, 0, 6, 4,
+        10, 4, 6, 11};
+    EXPECT_EQ(expected_ghost_elems_bin,
+              readIntegers(file_name_base + "_partitioned_msh_ele_g2.bin"));
+
+    // The binary node records are the global node ID followed by the
+    // coordinates, i.e. the same data as in the ASCII file.
+    std::string const nodes_bin =
+        readFile(file_name_base + "_partitioned_msh_nod2.bin");
+    std::size_t const record_size = sizeof(IntegerType) + 3 * sizeof(double);
+    std::istringstream expected_nodes_stream(expected_nodes);
+    std::size_t n_records = 0;
+    IntegerType expected_id;
+    double expected_x[3];
+    while (expected_nodes_stream >> expected_id >> expected_x[0] >>
+           expected_x[1] >> expected_x[2])
+    {
+        ASSERT_LE((n_records + 1) * record_size, nodes_bin.size());
+        char const* const record = nodes_bin.data() + n_records * record_size;
+        IntegerType id;
+        double x[3];
+        std::copy_n(record, sizeof(IntegerType), reinterpret_cast<char*>(&id));
+        std::copy_n(record + sizeof(IntegerType), 3 * sizeof(double),
+                    reinterpret_cast<char*>(x));
+        EXPECT_EQ(expected_id, id);
+        for (int d = 0; d < 3; ++d)
+            EXPECT_DOUBLE_EQ(expected_x[d], x[d]);
+        ++n_records;
+    }
+    EXPECT_EQ(24u, n_records);
+    EXPECT_EQ(n_records * record_size, nodes_bin.size());
+
+    for (auto const suffix :
+         {"_partitioned_cfg2.msh", "_partitioned_elems_2.msh",
+          "_partitioned_nodes_2.msh", "_partitioned_msh_cfg2.bin",
+          "_partitioned_msh_ele2.bin", "_partitioned_msh_ele_g2.bin",
+          "_partitioned_msh_nod2.bin"})
+        std::remove((file_name_base + suffix).c_str());
+}
+
+#ifdef USE_PETSC
+// Rank 0 writes the partitions of a mesh with a node and a cell property and
+// every rank reads its partition back with MPI_File_read_all.
+TEST(MPITest_ApplicationUtilsNodeWiseMeshPartitioner, PropertiesRoundTrip)
+{
+    int rank;
+    int n_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &n_ranks);
+
+    std::string const file_name_base =
+        BaseLib::BuildInfo::tests_tmp_path + "/PartitionedProperties";
+    if (rank == 0)
+    {
+        std::unique_ptr<MeshLib::Mesh> mesh(
+            MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+        auto& node_values =
+            *mesh->getProperties().createNewPropertyVector<double>(
+                "node_values", MeshLib::MeshItemType::Node, 1);
+        for (auto const* node : mesh->getNodes())
+            node_values.push_back((*node)[0] + 2 * (*node)[1]);
+        // The element centers are at odd multiples of 1/8.
+        auto& cell_values = *mesh->getProperties().createNewPropertyVector<int>(
+            "cell_values", MeshLib::MeshItemType::Cell, 2);
+        for (auto const* element : mesh->getElements())
+        {
+            MeshLib::Node const center(element->getCenterOfGravity());
+            cell_values.push_back(static_cast<int>(8 * center[0]));
+            cell_values.push_back(static_cast<int>(8 * center[1]));
+        }
+
+        ApplicationUtils::NodeWiseMeshPartitioner partitioner(n_ranks,
+                                                              std::move(mesh));
+        partitioner.partitionNodesByCoordinateBisection();
+        partitioner.partitionByMETIS(false);
+        partitioner.writeBinary(file_name_base);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    MeshLib::IO::NodePartitionedMeshReader reader(MPI_COMM_WORLD);
+    std::unique_ptr<MeshLib::NodePartitionedMesh> const mesh(
+        reader.read(file_name_base));
+    ASSERT_TRUE(mesh != nullptr);
+
+    auto const node_values =
+        mesh->getProperties().getPropertyVector<double>("node_values");
+    ASSERT_TRUE(node_values.is_initialized());
+    EXPECT_EQ(MeshLib::MeshItemType::Node, node_values->getMeshItemType());
+    ASSERT_EQ(mesh->getNumberOfNodes(), node_values->size());
+    for (auto const* node : mesh->getNodes())
+        EXPECT_DOUBLE_EQ((*node)[0] + 2 * (*node)[1],
+                         (*node_values)[node->getID()]);
+
+    auto const cell_values =
+        mesh->getProperties().getPropertyVector<int>("cell_values");
+    ASSERT_TRUE(cell_values.is_initialized());
+    EXPECT_EQ(MeshLib::MeshItemType::Cell, cell_values->getMeshItemType());
+    ASSERT_EQ(2u, cell_values->getNumberOfComponents());
+    ASSERT_EQ(mesh->getNumberOfElements(), cell_values->getNumberOfTuples());
+    for (auto const* element : mesh->getElements())
+    {
+        MeshLib::Node const center(element->getCenterOfGravity());
+        EXPECT_EQ(static_cast<int>(8 * center[0]),
+                  (*cell_values)[2 * element->getID()]);
+        EXPECT_EQ(static_cast<int>(8 * center[1]),
+                  (*cell_values)[2 * element->getID() + 1]);
+    }
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (rank == 0)
+    {
+        std::string const n_ranks_str = std::to_string(n_ranks);
+        for (auto const part :
+             {"cfg", "ele", "ele_g", "nod", "props_cfg", "props_val"})
+            std::remove((file_name_base + "_partitioned_msh_" + part +
+                         n_ranks_str + ".bin").c_str());
+    }
+}
+#endif  // USE_PETSC
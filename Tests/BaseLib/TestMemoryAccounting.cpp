@@ -0,0 +1,79 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/MemoryAccounting.h"
+
+TEST(BaseLibMemoryAccounting, CategoriesAndPhases)
+{
+    auto& accounting = BaseLib::MemoryAccounting::instance();
+    accounting.reset();
+
+    accounting.beginPhase("first");
+    accounting.add("mesh/nodes", 100);
+    accounting.add("global vectors", 50);
+    accounting.subtract("global vectors", 20);
+    accounting.add("global vectors", 10);
+    accounting.beginPhase("second");
+    accounting.subtract("mesh/nodes", 100);
+    accounting.endPhase();
+
+    auto const records = accounting.getRecords();
+    ASSERT_EQ(2u, records.size());
+    EXPECT_EQ(0u, records.at("mesh/nodes").current);
+    EXPECT_EQ(100u, records.at("mesh/nodes").peak);
+    EXPECT_EQ(40u, records.at("global vectors").current);
+    EXPECT_EQ(50u, records.at("global vectors").peak);
+    EXPECT_EQ(40u, accounting.getTotal());
+
+    auto const phases = accounting.getPhases();
+    ASSERT_EQ(2u, phases.size());
+    EXPECT_EQ("first", phases[0].name);
+    EXPECT_EQ(150u, phases[0].peak_accounted);
+    EXPECT_EQ("second", phases[1].name);
+    EXPECT_EQ(140u, phases[1].peak_accounted);
+
+    std::ostringstream csv;
+    accounting.writeCSV(csv);
+    EXPECT_NE(std::string::npos, csv.str().find("category,mesh/nodes,0,100,"));
+    EXPECT_NE(std::string::npos, csv.str().find("phase,first,,150,"));
+
+    EXPECT_ANY_THROW(accounting.subtract("global vectors", 41));
+    EXPECT_ANY_THROW(accounting.subtract("unknown", 1));
+
+    accounting.reset();
+}
+
+TEST(BaseLibMemoryAccounting, AccountedMemory)
+{
+    auto& accounting = BaseLib::MemoryAccounting::instance();
+    accounting.reset();
+
+    {
+        BaseLib::AccountedMemory outer;
+        outer.add("matrices", 100);
+        {
+            BaseLib::AccountedMemory inner;
+            inner.add("matrices", 20);
+            inner.add("vectors", 5);
+            EXPECT_EQ(125u, accounting.getTotal());
+
+            BaseLib::AccountedMemory moved(std::move(inner));
+            EXPECT_EQ(125u, accounting.getTotal());
+        }
+        EXPECT_EQ(100u, accounting.getTotal());
+        EXPECT_EQ(120u, accounting.getRecords().at("matrices").peak);
+    }
+    EXPECT_EQ(0u, accounting.getTotal());
+
+    accounting.reset();
+}
@@ -0,0 +1,186 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <sstream>
+#include <thread>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/Profiler.h"
+#include "BaseLib/Report.h"
+
+TEST(BaseLibProfiler, NestedScopes)
+{
+    auto& profiler = BaseLib::Profiler::instance();
+    profiler.reset();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        BaseLib::ScopedTimer outer("outer");
+        {
+            BaseLib::ScopedTimer inner("inner");
+        }
+        {
+            BaseLib::ScopedTimer inner("inner");
+        }
+    }
+
+    auto const records = profiler.getRecords();
+    ASSERT_EQ(1u, records.count("outer"));
+    ASSERT_EQ(1u, records.count("outer/inner"));
+    EXPECT_EQ(0u, records.count("inner"));
+
+    auto const& outer = records.at("outer");
+    auto const& inner = records.at("outer/inner");
+    EXPECT_EQ(3u, outer.count);
+    EXPECT_EQ(6u, inner.count);
+    EXPECT_LE(outer.min, outer.max);
+    EXPECT_LE(inner.total, outer.total);
+}
+
+TEST(BaseLibProfiler, MergeThreads)
+{
+    auto& profiler = BaseLib::Profiler::instance();
+    profiler.reset();
+
+    auto work = []()
+    {
+        BaseLib::ScopedTimer timer("thread work");
+    };
+    std::thread t1(work);
+    std::thread t2(work);
+    t1.join();
+    t2.join();
+
+    auto const records = profiler.getRecords();
+    ASSERT_EQ(1u, records.count("thread work"));
+    EXPECT_EQ(2u, records.at("thread work").count);
+    EXPECT_EQ(2u, records.at("thread work").threads);
+
+    std::ostringstream csv;
+    profiler.writeCSV(csv);
+    EXPECT_NE(std::string::npos, csv.str().find("thread work,2,"));
+}
+
+TEST(BaseLibProfiler, ScopeIds)
+{
+    auto& profiler = BaseLib::Profiler::instance();
+    profiler.reset();
+
+    auto const id = profiler.getScopeId("interned");
+    EXPECT_EQ(id, profiler.getScopeId("interned"));
+    EXPECT_NE(id, profiler.getScopeId("other"));
+
+    for (int i = 0; i < 2; ++i)
+    {
+        BaseLib::ScopedTimer by_id(id);
+        BaseLib::ScopedTimer by_name("interned");
+    }
+
+    auto const records = profiler.getRecords();
+    EXPECT_EQ(2u, records.at("interned").count);
+    EXPECT_EQ(2u, records.at("interned/interned").count);
+}
+
+TEST(BaseLibProfiler, ProfileScopeMacro)
+{
+    auto& profiler = BaseLib::Profiler::instance();
+    profiler.reset();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        OGS_PROFILE_SCOPE("macro outer");
+        {
+            OGS_PROFILE_SCOPE("macro inner");
+            OGS_PROFILE_SCOPE("macro innermost");
+        }
+    }
+
+    auto const records = profiler.getRecords();
+    EXPECT_EQ(3u, records.at("macro outer").count);
+    EXPECT_EQ(3u, records.at("macro outer/macro inner").count);
+    EXPECT_EQ(3u,
+              records.at("macro outer/macro inner/macro innermost").count);
+}
+
+#ifdef _OPENMP
+TEST(BaseLibProfiler, OpenMPWorkersAttachToEnclosingScope)
+{
+    auto& profiler = BaseLib::Profiler::instance();
+    profiler.reset();
+
+    int const n_threads = 4;
+    {
+        BaseLib::ScopedTimer outer("outer");
+        #pragma omp parallel for num_threads(n_threads) schedule(static, 1)
+        for (int i = 0; i < 4 * n_threads; ++i)
+        {
+            BaseLib::ScopedTimer work("work");
+        }
+    }
+    int team_size = 0;
+    {
+        BaseLib::ScopedTimer other("other");
+        #pragma omp parallel num_threads(n_threads)
+        {
+            BaseLib::ScopedTimer work("work");
+            #pragma omp single
+            team_size = omp_get_num_threads();
+        }
+    }
+
+    auto const records = profiler.getRecords();
+    EXPECT_EQ(0u, records.count("work"));
+    ASSERT_EQ(1u, records.count("outer/work"));
+    ASSERT_EQ(1u, records.count("other/work"));
+    EXPECT_EQ(4u * n_threads, records.at("outer/work").count);
+    EXPECT_EQ(static_cast<std::size_t>(team_size),
+              records.at("other/work").threads);
+}
+#endif  // _OPENMP
+
+TEST(BaseLibProfiler, RecordsWhileThreadsAreRunning)
+{
+    auto& profiler = BaseLib::Profiler::instance();
+    profiler.reset();
+
+    auto const id = profiler.getScopeId("concurrent");
+    auto work = [id]()
+    {
+        for (int i = 0; i < 10000; ++i)
+            BaseLib::ScopedTimer timer(id);
+    };
+    std::thread t1(work);
+    std::thread t2(work);
+    for (int i = 0; i < 100; ++i)
+        profiler.getRecords();
+    t1.join();
+    t2.join();
+
+    EXPECT_EQ(20000u, profiler.getRecords().at("concurrent").count);
+}
+
+TEST(BaseLibReport, RankFileName)
+{
+    EXPECT_EQ("profile_3.json", BaseLib::getRankFileName("profile.json", 3));
+    EXPECT_EQ("out/profile_0.csv",
+              BaseLib::getRankFileName("out/profile.csv", 0));
+    EXPECT_EQ("out.d/profile_1", BaseLib::getRankFileName("out.d/profile", 1));
+}
+
+TEST(BaseLibReport, Escaping)
+{
+    EXPECT_EQ("a\\\\\\\"b\\n", BaseLib::escapeJSON("a\\\"b\n"));
+    EXPECT_EQ("plain", BaseLib::escapeCSV("plain"));
+    EXPECT_EQ("\"a,\"\"b\"\"\"", BaseLib::escapeCSV("a,\"b\""));
+}
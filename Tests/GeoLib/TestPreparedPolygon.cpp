@@ -0,0 +1,116 @@
+/**
+ * @brief Tests of class PreparedPolygon.
+ *
+ * @copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/LICENSE.txt
+ */
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "GeoLib/Point.h"
+#include "GeoLib/Polygon.h"
+#include "GeoLib/PreparedPolygon.h"
+
+namespace
+{
+/// Checks that the prepared polygon classifies the points in the same way
+/// as the polygon itself.
+void compareWithPolygon(GeoLib::Polygon const& polygon,
+                        std::vector<GeoLib::Point*> const& pnts)
+{
+    GeoLib::PreparedPolygon const prepared(polygon);
+    std::vector<std::size_t> expected_indices;
+    for (std::size_t k = 0; k < pnts.size(); ++k)
+    {
+        bool const inside(polygon.isPntInPolygon(*pnts[k]));
+        EXPECT_EQ(inside, prepared.isPntInPolygon(*pnts[k]))
+            << "point " << k << ": " << *pnts[k];
+        if (inside)
+            expected_indices.push_back(k);
+    }
+    EXPECT_EQ(expected_indices, prepared.getIndicesOfPointsInPolygon(pnts));
+}
+}  // anonymous namespace
+
+TEST(GeoLibPreparedPolygon, ZigZagPolygonOnGrid)
+{
+    // the polygon of the PolygonTest fixture
+    std::vector<GeoLib::Point*> polygon_pnts = {
+        new GeoLib::Point(0.0, 0.0, 0.0),  new GeoLib::Point(-2.0, 2.0, 0.0),
+        new GeoLib::Point(-2.0, 4.0, 0.0), new GeoLib::Point(-1.0, 2.0, 0.0),
+        new GeoLib::Point(0.0, 4.0, 0.0),  new GeoLib::Point(1.0, 2.0, 0.0),
+        new GeoLib::Point(2.0, 4.0, 0.0),  new GeoLib::Point(2.0, 2.0, 0.0)};
+    GeoLib::Polyline ply(polygon_pnts);
+    for (std::size_t k = 0; k < polygon_pnts.size(); ++k)
+        ply.addPoint(k);
+    ply.addPoint(0);
+    GeoLib::Polygon const polygon(ply);
+
+    // grid points including the vertices, points on the edges and points on
+    // horizontal lines through the vertices
+    std::vector<std::unique_ptr<GeoLib::Point>> pnt_storage;
+    std::vector<GeoLib::Point*> pnts;
+    for (int i = -12; i <= 12; ++i)
+        for (int j = -4; j <= 20; ++j)
+        {
+            pnt_storage.emplace_back(
+                new GeoLib::Point(0.25 * i, 0.25 * j, 0.0));
+            pnts.push_back(pnt_storage.back().get());
+        }
+    compareWithPolygon(polygon, pnts);
+
+    for (auto* p : polygon_pnts)
+        delete p;
+}
+
+TEST(GeoLibPreparedPolygon, RandomStarPolygon)
+{
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> radius(0.5, 1.5);
+    std::size_t const n_vertices(500);
+    std::vector<GeoLib::Point*> polygon_pnts;
+    GeoLib::Polyline ply(polygon_pnts);
+    for (std::size_t k = 0; k < n_vertices; ++k)
+    {
+        double const phi(2 * M_PI * k / n_vertices);
+        double const r(radius(generator));
+        polygon_pnts.push_back(
+            new GeoLib::Point(r * std::cos(phi), r * std::sin(phi), 0.0));
+        ply.addPoint(k);
+    }
+    ply.addPoint(0);
+    GeoLib::Polygon const polygon(ply);
+
+    std::uniform_real_distribution<double> coordinate(-1.6, 1.6);
+    std::vector<std::unique_ptr<GeoLib::Point>> pnt_storage;
+    std::vector<GeoLib::Point*> pnts;
+    for (std::size_t k = 0; k < 20000; ++k)
+    {
+        pnt_storage.emplace_back(new GeoLib::Point(
+            coordinate(generator), coordinate(generator), 0.0));
+        pnts.push_back(pnt_storage.back().get());
+    }
+    // the vertices and the midpoints of the edges are on the boundary
+    for (std::size_t k = 0; k < n_vertices; ++k)
+    {
+        GeoLib::Point const& a(*polygon_pnts[k]);
+        GeoLib::Point const& b(*polygon_pnts[(k + 1) % n_vertices]);
+        pnt_storage.emplace_back(new GeoLib::Point(a));
+        pnts.push_back(pnt_storage.back().get());
+        pnt_storage.emplace_back(new GeoLib::Point(
+            0.5 * (a[0] + b[0]), 0.5 * (a[1] + b[1]), 0.0));
+        pnts.push_back(pnt_storage.back().get());
+    }
+    compareWithPolygon(polygon, pnts);
+
+    for (auto* p : polygon_pnts)
+        delete p;
+}
@@ -492,3 +492,68 @@ TEST_F(MeshLibProperties, AddDoublePropertiesTupleSize2)
 }
 
 
+
+TEST_F(MeshLibProperties, CopyOnWrite)
+{
+    ASSERT_TRUE(mesh != nullptr);
+    std::string const prop_name("TestProperty");
+    auto p = mesh->getProperties().createNewPropertyVector<double>(
+        prop_name, MeshLib::MeshItemType::Cell);
+    p->resize(mesh->getNumberOfElements());
+    std::iota(p->begin(), p->end(), 0);
+
+    // a copy shares the property vector, read-only access does not copy it
+    MeshLib::Properties properties_copy(mesh->getProperties());
+    ASSERT_TRUE(properties_copy.isSharedPropertyVector(prop_name));
+    EXPECT_EQ(&(*p), &(*properties_copy.getPropertyVector<double>(prop_name)));
+    EXPECT_EQ(&(*p),
+              &(*mesh->getProperties().getPropertyVector<double>(prop_name)));
+    ASSERT_TRUE(properties_copy.isSharedPropertyVector(prop_name));
+
+    // requesting the vector for modification detaches it
+    auto p_copy = properties_copy.getMutablePropertyVector<double>(prop_name);
+    EXPECT_FALSE(properties_copy.isSharedPropertyVector(prop_name));
+    EXPECT_FALSE(mesh->getProperties().isSharedPropertyVector(prop_name));
+    EXPECT_NE(&(*p), &(*p_copy));
+    (*p_copy)[0] = -1;
+    EXPECT_EQ(0, (*p)[0]);
+    for (std::size_t k(1); k < p->size(); k++)
+        EXPECT_EQ((*p)[k], (*p_copy)[k]);
+
+    // the detached vector is not copied again
+    EXPECT_EQ(&(*p_copy),
+              &(*properties_copy.getMutablePropertyVector<double>(prop_name)));
+    EXPECT_EQ(&(*p_copy),
+              &(*properties_copy.getPropertyVector<double>(prop_name)));
+
+    // nothing excluded for cells: the cell property is shared
+    MeshLib::Properties const exclude_nodes_copy(
+        mesh->getProperties().excludeCopyProperties({}, {0, 1}));
+    EXPECT_TRUE(exclude_nodes_copy.isSharedPropertyVector(prop_name));
+    MeshLib::Properties const exclude_elements_copy(
+        mesh->getProperties().excludeCopyProperties({0, 1}, {}));
+    EXPECT_FALSE(exclude_elements_copy.isSharedPropertyVector(prop_name));
+    EXPECT_EQ(p->size() - 2,
+              exclude_elements_copy.getPropertyVector<double>(prop_name)->size());
+}
+
+TEST_F(MeshLibProperties, ReferencesTakenBeforeCopyAreShared)
+{
+    ASSERT_TRUE(mesh != nullptr);
+    std::string const prop_name("TestProperty");
+    auto p = mesh->getProperties().createNewPropertyVector<double>(
+        prop_name, MeshLib::MeshItemType::Node);
+    p->resize(mesh->getNumberOfNodes(), 0.0);
+
+    // writing through a reference taken before the copy modifies both
+    MeshLib::Properties const properties_copy(mesh->getProperties());
+    (*p)[0] = 1;
+    EXPECT_EQ(1, (*properties_copy.getPropertyVector<double>(prop_name))[0]);
+
+    // a reference requested after the copy modifies the original only
+    auto p_mutable =
+        mesh->getProperties().getMutablePropertyVector<double>(prop_name);
+    (*p_mutable)[0] = 2;
+    EXPECT_EQ(1, (*properties_copy.getPropertyVector<double>(prop_name))[0]);
+    EXPECT_EQ(1, (*p)[0]);
+}
@@ -0,0 +1,62 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef TESTS_MESHLIB_REGULARQUAD8MESH_H_
+#define TESTS_MESHLIB_REGULARQUAD8MESH_H_
+
+#include <array>
+#include <vector>
+
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace MeshLib
+{
+/// Creates a square mesh of n x n quadratic quadrilaterals. As in meshes read
+/// from files, the corner (base) nodes are followed by the mid-edge nodes.
+inline Mesh* createRegularQuad8Mesh(std::size_t const n, double const length)
+{
+    // Nodes on a lattice of (2n+1) x (2n+1) points without the cell centres.
+    std::size_t const n_lattice = 2 * n + 1;
+    double const h = length / (2 * n);
+    std::vector<Node*> lattice(n_lattice * n_lattice, nullptr);
+    std::vector<Node*> nodes;
+    for (int pass = 0; pass < 2; ++pass)
+        for (std::size_t j = 0; j < n_lattice; ++j)
+            for (std::size_t i = 0; i < n_lattice; ++i)
+            {
+                bool const is_corner = i % 2 == 0 && j % 2 == 0;
+                bool const is_centre = i % 2 == 1 && j % 2 == 1;
+                if (is_centre || is_corner != (pass == 0))
+                    continue;
+                nodes.push_back(new Node(i * h, j * h, 0.0, nodes.size()));
+                lattice[j * n_lattice + i] = nodes.back();
+            }
+    std::size_t const n_base_nodes = (n + 1) * (n + 1);
+
+    std::vector<Element*> elements;
+    for (std::size_t j = 0; j < n_lattice - 1; j += 2)
+        for (std::size_t i = 0; i < n_lattice - 1; i += 2)
+        {
+            auto const node = [&](std::size_t const di, std::size_t const dj)
+            {
+                return lattice[(j + dj) * n_lattice + i + di];
+            };
+            std::array<Node*, 8> const quad_nodes = {
+                {node(0, 0), node(2, 0), node(2, 2), node(0, 2), node(1, 0),
+                 node(2, 1), node(1, 2), node(0, 1)}};
+            elements.push_back(new Quad8(quad_nodes));
+        }
+
+    return new Mesh("Quad8Mesh", nodes, elements, Properties(), n_base_nodes);
+}
+}  // namespace MeshLib
+
+#endif  // TESTS_MESHLIB_REGULARQUAD8MESH_H_
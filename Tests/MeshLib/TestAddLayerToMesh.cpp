@@ -118,7 +118,7 @@ TEST(MeshLib, AddTopLayerToTriMesh)
     ASSERT_EQ(mesh->getNumberOfElements(), n_elems[6]); // tests if 50 prisms are present
 
     ASSERT_EQ(1, result->getProperties().getPropertyVectorNames().size());
-    boost::optional<MeshLib::PropertyVector<int>&> new_mats =
+    boost::optional<MeshLib::PropertyVector<int> const&> new_mats =
         result->getProperties().getPropertyVector<int>(mat_name);
     ASSERT_EQ(result->getNumberOfElements(), new_mats->size());
     ASSERT_EQ(mesh->getNumberOfElements(), std::count(new_mats->cbegin(), new_mats->cend(), 0));
@@ -265,7 +265,7 @@ TEST(MeshLib, AddBottomLayerToPrismMesh)
     ASSERT_EQ(mesh->getNumberOfElements(), n_elems[1]); // tests if 50 tris are present
     ASSERT_EQ(2 * mesh->getNumberOfElements(), n_elems[6]); // tests if 50 prisms are present
     ASSERT_EQ(1, result->getProperties().getPropertyVectorNames().size());
-    boost::optional<MeshLib::PropertyVector<int>&> new_mats =
+    boost::optional<MeshLib::PropertyVector<int> const&> new_mats =
         result->getProperties().getPropertyVector<int>(mat_name);
     ASSERT_EQ(result->getNumberOfElements(), new_mats->size());
     ASSERT_EQ(mesh2->getNumberOfElements(), std::count(new_mats->cbegin(), new_mats->cend(), 0));
@@ -0,0 +1,175 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/BuildInfo.h"
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/BinaryIO/BinaryMeshIO.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+TEST(MeshLibBinaryMeshIO, RoundTrip)
+{
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "/BinaryMeshIORoundTrip.bmsh";
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 4));
+    auto material_ids = mesh->getProperties().createNewPropertyVector<int>(
+        "MaterialIDs", MeshLib::MeshItemType::Cell);
+    for (std::size_t i = 0; i < mesh->getNumberOfElements(); ++i)
+        material_ids->push_back(i % 3);
+    auto velocity = mesh->getProperties().createNewPropertyVector<double>(
+        "velocity", MeshLib::MeshItemType::Node, 3);
+    for (std::size_t i = 0; i < 3 * mesh->getNumberOfNodes(); ++i)
+        velocity->push_back(0.5 * i);
+
+    MeshLib::IO::writeBinaryMesh(*mesh, file_name);
+
+    {
+        MeshLib::IO::BinaryMeshView const view(file_name);
+        EXPECT_EQ(mesh->getName(), view.getName());
+        ASSERT_EQ(mesh->getNumberOfNodes(), view.getNumberOfNodes());
+        ASSERT_EQ(mesh->getNumberOfElements(), view.getNumberOfElements());
+        EXPECT_EQ((*mesh->getNode(7))[1], view.getCoordinates()[3 * 7 + 1]);
+        EXPECT_EQ(MeshLib::CellType::HEX8, view.getCellType(0));
+        ASSERT_EQ(2u, view.getProperties().size());
+    }
+
+    std::unique_ptr<MeshLib::Mesh> read(
+        MeshLib::IO::readBinaryMesh(file_name));
+    std::remove(file_name.c_str());
+
+    ASSERT_EQ(mesh->getNumberOfNodes(), read->getNumberOfNodes());
+    ASSERT_EQ(mesh->getNumberOfElements(), read->getNumberOfElements());
+    for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+        for (unsigned c = 0; c < 3; ++c)
+            EXPECT_EQ((*mesh->getNode(i))[c], (*read->getNode(i))[c]);
+    for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+    {
+        auto const& expected = *mesh->getElement(e);
+        auto const& actual = *read->getElement(e);
+        ASSERT_EQ(expected.getCellType(), actual.getCellType());
+        for (unsigned n = 0; n < expected.getNumberOfNodes(); ++n)
+            EXPECT_EQ(expected.getNodeIndex(n), actual.getNodeIndex(n));
+    }
+
+    auto const read_material_ids =
+        read->getProperties().getPropertyVector<int>("MaterialIDs");
+    ASSERT_TRUE(!!read_material_ids);
+    EXPECT_EQ(MeshLib::MeshItemType::Cell,
+              read_material_ids->getMeshItemType());
+    EXPECT_TRUE(std::equal(material_ids->begin(), material_ids->end(),
+                           read_material_ids->begin()));
+
+    auto const read_velocity =
+        read->getProperties().getPropertyVector<double>("velocity");
+    ASSERT_TRUE(!!read_velocity);
+    EXPECT_EQ(3u, read_velocity->getNumberOfComponents());
+    EXPECT_TRUE(std::equal(velocity->begin(), velocity->end(),
+                           read_velocity->begin()));
+}
+
+TEST(MeshLibBinaryMeshIO, InvalidFile)
+{
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "/BinaryMeshIOInvalid.bmsh";
+    {
+        std::ofstream os(file_name, std::ios::binary);
+        os << "OGSBMESH";
+    }
+    EXPECT_ANY_THROW(MeshLib::IO::BinaryMeshView const view(file_name));
+
+    {
+        std::ofstream os(file_name, std::ios::binary);
+        os << "NOTAMESH12345678";
+    }
+    EXPECT_ANY_THROW(MeshLib::IO::BinaryMeshView const view(file_name));
+    std::remove(file_name.c_str());
+}
+
+namespace
+{
+/// Overwrites the bytes at the given position of the file.
+void patchFile(std::string const& file_name, std::size_t const position,
+               void const* data, std::size_t const n_bytes)
+{
+    std::fstream fs(file_name,
+                    std::ios::binary | std::ios::in | std::ios::out);
+    fs.seekp(position);
+    fs.write(static_cast<char const*>(data), n_bytes);
+}
+}  // anonymous namespace
+
+TEST(MeshLibBinaryMeshIO, InvalidContents)
+{
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "/BinaryMeshIOContents.bmsh";
+
+    // 9 nodes, 4 quads with 16 element nodes, and one cell property
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 2));
+    auto material_ids = mesh->getProperties().createNewPropertyVector<int>(
+        "MaterialIDs", MeshLib::MeshItemType::Cell);
+    material_ids->resize(mesh->getNumberOfElements(), 1);
+
+    auto const padded = [](std::size_t n) { return (n + 7) / 8 * 8; };
+    std::size_t const cell_types_position =
+        8 + 7 * 8 + padded(mesh->getName().size()) + 9 * 3 * 8 + 5 * 8 +
+        16 * 8;
+    std::size_t const property_position = cell_types_position + 8;
+
+    auto const write_patched_mesh = [&](std::size_t const position,
+                                        std::uint64_t const value,
+                                        std::size_t const n_bytes)
+    {
+        MeshLib::IO::writeBinaryMesh(*mesh, file_name);
+        patchFile(file_name, position, &value, n_bytes);
+    };
+
+    // unchanged cell type
+    write_patched_mesh(cell_types_position,
+                       static_cast<std::uint8_t>(MeshLib::CellType::QUAD4), 1);
+    EXPECT_NO_THROW(MeshLib::IO::BinaryMeshView const view(file_name));
+
+    // unknown and unsupported cell types
+    write_patched_mesh(cell_types_position, 200, 1);
+    EXPECT_ANY_THROW(MeshLib::IO::BinaryMeshView const view(file_name));
+    write_patched_mesh(cell_types_position,
+                       static_cast<std::uint8_t>(MeshLib::CellType::HEX27), 1);
+    EXPECT_ANY_THROW(MeshLib::IO::readBinaryMesh(file_name));
+    // cell type with a different number of nodes
+    write_patched_mesh(cell_types_position,
+                       static_cast<std::uint8_t>(MeshLib::CellType::TRI3), 1);
+    EXPECT_ANY_THROW(MeshLib::IO::readBinaryMesh(file_name));
+
+    // unknown mesh item type
+    write_patched_mesh(property_position + 8, 7, 8);
+    EXPECT_ANY_THROW(MeshLib::IO::BinaryMeshView const view(file_name));
+    // node property with the number of values of a cell property
+    write_patched_mesh(property_position + 8,
+                       static_cast<std::uint64_t>(MeshLib::MeshItemType::Node),
+                       8);
+    EXPECT_ANY_THROW(MeshLib::IO::BinaryMeshView const view(file_name));
+    // no components
+    write_patched_mesh(property_position + 3 * 8, 0, 8);
+    EXPECT_ANY_THROW(MeshLib::IO::BinaryMeshView const view(file_name));
+    // fewer values than elements
+    write_patched_mesh(property_position + 4 * 8, 3, 8);
+    EXPECT_ANY_THROW(MeshLib::IO::BinaryMeshView const view(file_name));
+
+    std::remove(file_name.c_str());
+}
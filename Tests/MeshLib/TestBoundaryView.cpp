@@ -0,0 +1,92 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MeshLib/Elements/Elements.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+void compareBoundaryView(MeshLib::BoundaryView const& view,
+                         MeshLib::Element const& boundary)
+{
+    ASSERT_EQ(boundary.getNumberOfNodes(), view.getNumberOfNodes());
+    EXPECT_EQ(boundary.getNumberOfBaseNodes(), view.getNumberOfBaseNodes());
+    EXPECT_EQ(boundary.getCellType(), view.getCellType());
+    EXPECT_EQ(boundary.getGeomType(), view.getGeomType());
+    EXPECT_EQ(boundary.getDimension(), view.getDimension());
+    for (unsigned i = 0; i < boundary.getNumberOfNodes(); ++i)
+        EXPECT_EQ(boundary.getNode(i), view.getNode(i));
+
+    std::unique_ptr<MeshLib::Element const> const created(
+        view.createElement());
+    EXPECT_EQ(boundary.getCellType(), created->getCellType());
+    for (unsigned i = 0; i < boundary.getNumberOfNodes(); ++i)
+        EXPECT_EQ(boundary.getNode(i), created->getNode(i));
+}
+
+template <typename ElementType>
+void compareWithGetFaceAndGetEdge()
+{
+    std::vector<MeshLib::Node> nodes;
+    for (unsigned i = 0; i < ElementType::n_all_nodes; ++i)
+        nodes.emplace_back(i, 2.0 * i, 3.0 * i, i);
+    std::array<MeshLib::Node*, ElementType::n_all_nodes> element_nodes;
+    for (unsigned i = 0; i < ElementType::n_all_nodes; ++i)
+        element_nodes[i] = &nodes[i];
+    ElementType const element(element_nodes);
+
+    for (unsigned i = 0; i < element.getNumberOfEdges(); ++i)
+    {
+        std::unique_ptr<MeshLib::Element const> const edge(
+            element.getEdge(i));
+        compareBoundaryView(element.getEdgeView(i), *edge);
+    }
+    if (element.getDimension() < 2)
+        return;
+    for (unsigned i = 0; i < element.getNumberOfFaces(); ++i)
+    {
+        std::unique_ptr<MeshLib::Element const> const face(
+            element.getFace(i));
+        compareBoundaryView(element.getFaceView(i), *face);
+    }
+}
+}  // anonymous namespace
+
+TEST(MeshLibBoundaryView, FacesAndEdgesOfAllElementTypes)
+{
+    compareWithGetFaceAndGetEdge<MeshLib::Tri>();
+    compareWithGetFaceAndGetEdge<MeshLib::Tri6>();
+    compareWithGetFaceAndGetEdge<MeshLib::Quad>();
+    compareWithGetFaceAndGetEdge<MeshLib::Quad8>();
+    compareWithGetFaceAndGetEdge<MeshLib::Quad9>();
+    compareWithGetFaceAndGetEdge<MeshLib::Tet>();
+    compareWithGetFaceAndGetEdge<MeshLib::Tet10>();
+    compareWithGetFaceAndGetEdge<MeshLib::Hex>();
+    compareWithGetFaceAndGetEdge<MeshLib::Hex20>();
+    compareWithGetFaceAndGetEdge<MeshLib::Prism>();
+    compareWithGetFaceAndGetEdge<MeshLib::Prism15>();
+    compareWithGetFaceAndGetEdge<MeshLib::Pyramid>();
+    compareWithGetFaceAndGetEdge<MeshLib::Pyramid13>();
+}
+
+TEST(MeshLibBoundaryView, EmptyView)
+{
+    MeshLib::Node n0(0, 0, 0, 0);
+    MeshLib::Node n1(1, 0, 0, 1);
+    std::array<MeshLib::Node*, 2> line_nodes = {{&n0, &n1}};
+    MeshLib::Line const line(line_nodes);
+    EXPECT_EQ(0u, line.getFaceView(0).getNumberOfNodes());
+    EXPECT_EQ(MeshLib::CellType::INVALID, line.getFaceView(0).getCellType());
+}
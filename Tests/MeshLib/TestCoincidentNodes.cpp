@@ -0,0 +1,107 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MathLib/MathTools.h"
+#include "MeshLib/MeshSearch/CoincidentNodes.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+/// Reference implementation comparing all pairs of nodes.
+std::vector<std::size_t> findCoincidentNodesBruteForce(
+    std::vector<MeshLib::Node*> const& nodes, double const eps)
+{
+    std::vector<std::size_t> id_map(nodes.size());
+    std::iota(id_map.begin(), id_map.end(), 0);
+    // repeat until the smallest index is propagated through all chains
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+            for (std::size_t j = 0; j < nodes.size(); ++j)
+                if (id_map[j] < id_map[i] &&
+                    MathLib::sqrDist(nodes[i]->getCoords(),
+                                     nodes[j]->getCoords()) < eps * eps)
+                {
+                    id_map[i] = id_map[j];
+                    changed = true;
+                }
+    }
+    return id_map;
+}
+}  // anonymous namespace
+
+TEST(MeshLibCoincidentNodes, SeparatedPairs)
+{
+    std::vector<MeshLib::Node> node_storage = {
+        MeshLib::Node(0, 0, 0),   MeshLib::Node(1, 0, 0),
+        MeshLib::Node(0, 0, 1e-4), MeshLib::Node(1 + 1e-4, 1e-4, 0),
+        MeshLib::Node(0.5, 0, 0)};
+    std::vector<MeshLib::Node*> nodes;
+    for (auto& n : node_storage)
+        nodes.push_back(&n);
+
+    std::vector<std::size_t> const expected = {0, 1, 0, 1, 4};
+    EXPECT_EQ(expected, MeshLib::findCoincidentNodes(nodes, 1e-3));
+
+    // nothing is merged for a non-positive distance
+    std::vector<std::size_t> identity(nodes.size());
+    std::iota(identity.begin(), identity.end(), 0);
+    EXPECT_EQ(identity, MeshLib::findCoincidentNodes(nodes, 0));
+}
+
+TEST(MeshLibCoincidentNodes, Chain)
+{
+    // node 1 is close to nodes 0 and 2, but nodes 0 and 2 are far apart.
+    std::vector<MeshLib::Node> node_storage = {MeshLib::Node(2, 0, 0),
+                                               MeshLib::Node(1, 0, 0),
+                                               MeshLib::Node(0, 0, 0)};
+    std::vector<MeshLib::Node*> nodes;
+    for (auto& n : node_storage)
+        nodes.push_back(&n);
+
+    std::vector<std::size_t> const expected = {0, 0, 0};
+    EXPECT_EQ(expected, MeshLib::findCoincidentNodes(nodes, 1.5));
+}
+
+TEST(MeshLibCoincidentNodes, CompareWithBruteForce)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> coordinate(-1.0, 1.0);
+
+    std::vector<std::unique_ptr<MeshLib::Node>> node_storage;
+    std::vector<MeshLib::Node*> nodes;
+    for (std::size_t k = 0; k < 1000; ++k)
+    {
+        node_storage.emplace_back(new MeshLib::Node(
+            coordinate(generator), coordinate(generator),
+            coordinate(generator), k));
+        nodes.push_back(node_storage.back().get());
+    }
+    // some exact duplicates
+    for (std::size_t k = 0; k < 100; ++k)
+    {
+        node_storage.emplace_back(
+            new MeshLib::Node(*nodes[(k * 7) % 1000]));
+        nodes.push_back(node_storage.back().get());
+    }
+
+    for (double const eps : {1e-10, 0.05, 0.1, 0.3})
+        EXPECT_EQ(findCoincidentNodesBruteForce(nodes, eps),
+                  MeshLib::findCoincidentNodes(nodes, eps))
+            << "eps = " << eps;
+}
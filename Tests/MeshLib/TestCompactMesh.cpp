@@ -0,0 +1,151 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <algorithm>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "MeshLib/CompactMesh.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+#include "Tests/MeshLib/RegularQuad8Mesh.h"
+
+namespace
+{
+void compareWithMesh(MeshLib::CompactMesh const& compact,
+                     MeshLib::Mesh const& mesh)
+{
+    ASSERT_EQ(mesh.getNumberOfNodes(), compact.getNumberOfNodes());
+    ASSERT_EQ(mesh.getNumberOfElements(), compact.getNumberOfElements());
+    EXPECT_EQ(mesh.getDimension(), compact.getDimension());
+
+    for (std::size_t i = 0; i < mesh.getNumberOfNodes(); ++i)
+        for (unsigned c = 0; c < 3; ++c)
+            EXPECT_EQ((*mesh.getNode(i))[c], compact.getNodeCoordinates(i)[c]);
+
+    for (std::size_t e = 0; e < mesh.getNumberOfElements(); ++e)
+    {
+        auto const& element = *mesh.getElement(e);
+        auto const node_ids = compact.getElementNodeIDs(e);
+        EXPECT_EQ(element.getCellType(), compact.getCellType(e));
+        ASSERT_EQ(element.getNumberOfNodes(), node_ids.size());
+        for (unsigned n = 0; n < element.getNumberOfNodes(); ++n)
+            EXPECT_EQ(element.getNode(n)->getID(), node_ids[n]);
+
+        // neighbours as a set
+        std::vector<std::size_t> expected_neighbors;
+        for (unsigned n = 0; n < element.getNumberOfNeighbors(); ++n)
+            if (element.getNeighbor(n))
+                expected_neighbors.push_back(element.getNeighbor(n)->getID());
+        auto const neighbors = compact.getElementNeighbors(e);
+        std::vector<std::size_t> actual_neighbors(neighbors.begin(),
+                                                  neighbors.end());
+        std::sort(expected_neighbors.begin(), expected_neighbors.end());
+        std::sort(actual_neighbors.begin(), actual_neighbors.end());
+        EXPECT_EQ(expected_neighbors, actual_neighbors);
+    }
+
+    for (std::size_t i = 0; i < mesh.getNumberOfNodes(); ++i)
+    {
+        auto const& elements = mesh.getNode(i)->getElements();
+        auto const connected = compact.getElementsConnectedToNode(i);
+        ASSERT_EQ(elements.size(), connected.size());
+        for (std::size_t k = 0; k < elements.size(); ++k)
+            EXPECT_EQ(elements[k]->getID(), connected[k]);
+    }
+}
+}  // anonymous namespace
+
+TEST(MeshLibCompactMesh, FromQuadMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(3, 4, 1.0));
+    MeshLib::CompactMesh const compact(*mesh);
+    compareWithMesh(compact, *mesh);
+}
+
+TEST(MeshLibCompactMesh, FromHexMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 3));
+    MeshLib::CompactMesh const compact(*mesh);
+    compareWithMesh(compact, *mesh);
+
+    std::size_t n_elements = 0;
+    for (auto const element : compact)
+    {
+        EXPECT_EQ(n_elements, element.getID());
+        EXPECT_EQ(8u, element.getNumberOfNodes());
+        ++n_elements;
+    }
+    EXPECT_EQ(compact.getNumberOfElements(), n_elements);
+}
+
+TEST(MeshLibCompactMesh, RoundTrip)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularTriMesh(4, 3, 1.0));
+    MeshLib::CompactMesh const compact(*mesh);
+    std::unique_ptr<MeshLib::Mesh> converted(compact.toMesh());
+    compareWithMesh(compact, *converted);
+}
+
+TEST(MeshLibCompactMesh, InvalidConnectivity)
+{
+    EXPECT_ANY_THROW(MeshLib::CompactMesh(
+        "invalid", {0, 0, 0, 1, 0, 0}, {0, 2}, {0, 2},
+        {MeshLib::CellType::LINE2}));
+    EXPECT_ANY_THROW(MeshLib::CompactMesh(
+        "invalid", {0, 0, 0, 1, 0, 0}, {0, 3}, {0, 1, 1},
+        {MeshLib::CellType::LINE2}));
+}
+
+TEST(MeshLibCompactMesh, NodeElementTable)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(MeshLib::createRegularQuad8Mesh(3, 1.0));
+    MeshLib::CompactMesh const compact(*mesh);
+
+    // Base nodes only, as the compact mesh and the nodes of the mesh.
+    auto const base_table = MeshLib::createNodeElementTable(*mesh, false);
+    ASSERT_EQ(mesh->getNumberOfNodes() + 1, base_table.offsets.size());
+    for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+    {
+        auto const expected = compact.getElementsConnectedToNode(i);
+        auto const connected = base_table.getElements(i);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+                               connected.begin()) &&
+                    expected.size() == connected.size());
+        if (i >= mesh->getNumberOfBaseNodes())
+        {
+            EXPECT_TRUE(connected.empty());
+        }
+    }
+
+    // All nodes, i.e. also the mid-edge nodes are connected to elements.
+    auto const table = MeshLib::createNodeElementTable(*mesh, true);
+    std::vector<std::vector<std::size_t>> expected(mesh->getNumberOfNodes());
+    for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+    {
+        auto const& element = *mesh->getElement(e);
+        ASSERT_EQ(8u, element.getNumberOfNodes());
+        for (unsigned n = 0; n < element.getNumberOfNodes(); ++n)
+            expected[element.getNodeIndex(n)].push_back(e);
+    }
+    for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+    {
+        auto const connected = table.getElements(i);
+        ASSERT_FALSE(connected.empty());
+        EXPECT_EQ(expected[i],
+                  std::vector<std::size_t>(connected.begin(), connected.end()));
+    }
+}
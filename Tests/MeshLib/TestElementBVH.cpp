@@ -0,0 +1,241 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Elements/Hex.h"
+#include "MeshLib/Elements/Line.h"
+#include "MeshLib/Elements/Prism.h"
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Elements/Tet.h"
+#include "MeshLib/Elements/Tri.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSearch/ElementBVH.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+std::vector<MathLib::Point3d> generateRandomPoints(std::size_t const n,
+                                                   double const min,
+                                                   double const max)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> coordinate(min, max);
+    std::vector<MathLib::Point3d> pnts;
+    for (std::size_t k = 0; k < n; ++k)
+        pnts.push_back(MathLib::Point3d{{{coordinate(generator),
+                                          coordinate(generator),
+                                          coordinate(generator)}}});
+    return pnts;
+}
+
+/// Reference implementation testing all elements.
+MeshLib::Element const* locatePointBruteForce(MeshLib::Mesh const& mesh,
+                                              MathLib::Point3d const& pnt,
+                                              double const eps)
+{
+    for (auto const* e : mesh.getElements())
+        if (e->isPntInElement(pnt, eps))
+            return e;
+    return nullptr;
+}
+
+/// Reference implementation testing all elements.
+MeshLib::Element const* findNearestElementBruteForce(
+    MeshLib::Mesh const& mesh, MathLib::Point3d const& pnt)
+{
+    MeshLib::Element const* nearest = nullptr;
+    double min_distance = std::numeric_limits<double>::max();
+    for (auto const* e : mesh.getElements())
+    {
+        double const d = MeshLib::computeDistance(*e, pnt);
+        if (d < min_distance)
+        {
+            min_distance = d;
+            nearest = e;
+        }
+    }
+    return nearest;
+}
+
+/// Creates an element whose nodes are the images of the reference element
+/// nodes under an affine map and checks the natural coordinates of the
+/// images of some points of the reference element.
+template <typename ElementType>
+void checkNaturalCoordinatesOfAffineElement(
+    std::vector<std::array<double, 3>> const& reference_nodes, unsigned dim)
+{
+    double const A[3][3] = {{2.0, 0.3, -0.2}, {0.1, 1.5, 0.4}, {-0.3, 0.2, 3.0}};
+    double const b[3] = {10.0, -5.0, 2.0};
+    auto const map = [&A, &b](std::array<double, 3> const& r)
+                         -> MathLib::Point3d
+    {
+        MathLib::Point3d x;
+        for (unsigned i = 0; i < 3; ++i)
+            x[i] = b[i] + A[i][0] * r[0] + A[i][1] * r[1] + A[i][2] * r[2];
+        return x;
+    };
+
+    std::vector<std::unique_ptr<MeshLib::Node>> node_storage;
+    std::array<MeshLib::Node*, ElementType::n_all_nodes> nodes;
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        node_storage.emplace_back(
+            new MeshLib::Node(map(reference_nodes[i]).getCoords(), i));
+        nodes[i] = node_storage.back().get();
+    }
+    ElementType const element(nodes);
+
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> coordinate(0.0, 0.3);
+    for (unsigned k = 0; k < 20; ++k)
+    {
+        std::array<double, 3> r = {{0, 0, 0}};
+        for (unsigned d = 0; d < dim; ++d)
+            r[d] = coordinate(generator);
+        auto const natural_coordinates =
+            MeshLib::computeNaturalCoordinates(element, map(r));
+        for (unsigned d = 0; d < 3; ++d)
+            EXPECT_NEAR(r[d], natural_coordinates[d], 1e-12);
+    }
+}
+}  // anonymous namespace
+
+TEST(MeshLibElementBVH, LocatePointsInHexMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 7));
+    MeshLib::ElementBVH const bvh(*mesh);
+    ASSERT_EQ(mesh->getNumberOfElements(), bvh.size());
+
+    auto const pnts = generateRandomPoints(2000, -0.1, 1.1);
+    double const eps = 1e-10;
+    auto const locations = bvh.locatePoints(pnts, eps);
+    ASSERT_EQ(pnts.size(), locations.size());
+    for (std::size_t k = 0; k < pnts.size(); ++k)
+    {
+        auto const& location = locations[k];
+        ASSERT_EQ(locatePointBruteForce(*mesh, pnts[k], eps),
+                  location.element);
+        if (!location.element)
+            continue;
+        EXPECT_EQ(0.0, location.distance);
+        // the hexahedra are axis aligned cubes, i.e. the natural coordinates
+        // are the scaled local coordinates
+        MeshLib::Node const& min_node(*location.element->getNode(0));
+        MeshLib::Node const& max_node(*location.element->getNode(6));
+        for (unsigned d = 0; d < 3; ++d)
+            EXPECT_NEAR(2 * (pnts[k][d] - min_node[d]) /
+                                (max_node[d] - min_node[d]) -
+                            1,
+                        location.natural_coordinates[d], 1e-10);
+    }
+}
+
+TEST(MeshLibElementBVH, LocatePointsInPrismMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularPrismMesh(1.0, 1.0, 1.0, 6, 5,
+                                                         4));
+    MeshLib::ElementBVH const bvh(*mesh);
+    auto const pnts = generateRandomPoints(1000, -0.1, 1.1);
+    for (auto const& p : pnts)
+        ASSERT_EQ(locatePointBruteForce(*mesh, p, 1e-10),
+                  bvh.locatePoint(p, 1e-10).element);
+}
+
+TEST(MeshLibElementBVH, NearestElementsInTriMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularTriMesh(9, 6, 0.25));
+    MeshLib::ElementBVH const bvh(*mesh);
+
+    // points above, below and beside the surface
+    auto const pnts = generateRandomPoints(1000, -0.5, 2.5);
+    auto const locations = bvh.findNearestElements(pnts);
+    for (std::size_t k = 0; k < pnts.size(); ++k)
+    {
+        auto const& location = locations[k];
+        ASSERT_TRUE(location.element != nullptr);
+        // Outside of the surface the closest point is often a common node or
+        // edge of several triangles, whose distances differ by round-off.
+        auto const* expected = findNearestElementBruteForce(*mesh, pnts[k]);
+        EXPECT_NEAR(MeshLib::computeDistance(*expected, pnts[k]),
+                    location.distance, 1e-14);
+        EXPECT_EQ(MeshLib::computeDistance(*location.element, pnts[k]),
+                  location.distance);
+
+        // the natural coordinates of the (possibly extrapolated) projection
+        // onto the plane of the triangle
+        auto const& r = location.natural_coordinates;
+        MeshLib::Element const& e(*location.element);
+        for (unsigned d = 0; d < 2; ++d)
+            EXPECT_NEAR(pnts[k][d],
+                        (1 - r[0] - r[1]) * (*e.getNode(0))[d] +
+                            r[0] * (*e.getNode(1))[d] +
+                            r[1] * (*e.getNode(2))[d],
+                        1e-12);
+    }
+}
+
+TEST(MeshLibElementBVH, NearestElementsInHexMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 5));
+    MeshLib::ElementBVH const bvh(*mesh);
+    auto const pnts = generateRandomPoints(1000, -1.0, 2.0);
+    for (auto const& p : pnts)
+    {
+        auto const location = bvh.findNearestElement(p);
+        auto const* expected = findNearestElementBruteForce(*mesh, p);
+        EXPECT_NEAR(MeshLib::computeDistance(*expected, p), location.distance,
+                    1e-14);
+        if (location.distance == 0)  // the point is located in the element
+            EXPECT_EQ(expected, location.element);
+    }
+}
+
+TEST(MeshLibElementBVH, ElementsInVolume)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 10));
+    MeshLib::ElementBVH const bvh(*mesh);
+    auto const elements = bvh.getElementsInVolume(
+        MathLib::Point3d{{{0.25, 0.25, -1}}},
+        MathLib::Point3d{{{0.45, 0.35, 1}}});
+    // cells 2..4 in x-direction and 2..3 in y-direction
+    ASSERT_EQ(6u, elements.size());
+    for (std::size_t k = 1; k < elements.size(); ++k)
+        EXPECT_LT(elements[k - 1]->getID(), elements[k]->getID());
+}
+
+TEST(MeshLibElementBVH, NaturalCoordinatesOfAffineElements)
+{
+    checkNaturalCoordinatesOfAffineElement<MeshLib::Line>(
+        {{{-1, 0, 0}}, {{1, 0, 0}}}, 1);
+    checkNaturalCoordinatesOfAffineElement<MeshLib::Tri>(
+        {{{0, 0, 0}}, {{1, 0, 0}}, {{0, 1, 0}}}, 2);
+    checkNaturalCoordinatesOfAffineElement<MeshLib::Quad>(
+        {{{1, 1, 0}}, {{-1, 1, 0}}, {{-1, -1, 0}}, {{1, -1, 0}}}, 2);
+    checkNaturalCoordinatesOfAffineElement<MeshLib::Tet>(
+        {{{0, 0, 0}}, {{1, 0, 0}}, {{0, 1, 0}}, {{0, 0, 1}}}, 3);
+    checkNaturalCoordinatesOfAffineElement<MeshLib::Prism>(
+        {{{0, 0, -1}}, {{1, 0, -1}}, {{0, 1, -1}},
+         {{0, 0, 1}},  {{1, 0, 1}},  {{0, 1, 1}}}, 3);
+    checkNaturalCoordinatesOfAffineElement<MeshLib::Hex>(
+        {{{-1, -1, -1}}, {{1, -1, -1}}, {{1, 1, -1}}, {{-1, 1, -1}},
+         {{-1, -1, 1}},  {{1, -1, 1}},  {{1, 1, 1}},  {{-1, 1, 1}}}, 3);
+}
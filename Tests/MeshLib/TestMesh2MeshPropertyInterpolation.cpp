@@ -0,0 +1,146 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/Mesh2MeshPropertyInterpolation.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+/// Reference implementation testing all source nodes for each destination
+/// element.
+std::vector<double> interpolateBruteForce(MeshLib::Mesh const& src_mesh,
+                                          std::vector<double> const& src_values,
+                                          MeshLib::Mesh const& dest_mesh)
+{
+    std::vector<double> node_values;
+    for (auto const* node : src_mesh.getNodes())
+    {
+        double value = 0;
+        for (auto const* e : node->getElements())
+            value += src_values[e->getID()];
+        node_values.push_back(value / node->getNumberOfElements());
+    }
+
+    std::vector<double> dest_values;
+    for (auto const* e : dest_mesh.getElements())
+    {
+        double sum = 0;
+        std::size_t cnt = 0;
+        for (auto const* node : src_mesh.getNodes())
+            if (MeshLib::isPointInElementXY(*node, *e))
+            {
+                sum += node_values[node->getID()];
+                cnt++;
+            }
+        dest_values.push_back(sum / cnt);
+    }
+    return dest_values;
+}
+
+class MeshLibMesh2MeshPropertyInterpolation : public ::testing::Test
+{
+public:
+    MeshLibMesh2MeshPropertyInterpolation()
+        : _src_mesh(MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 20)),
+          _dest_mesh(MeshLib::MeshGenerator::generateRegularTriMesh(
+              4, 4, 0.25))
+    {
+        auto const add_property = [this](std::string const& name,
+                                         double (*f)(double, double))
+        {
+            auto& pv(*_src_mesh->getProperties()
+                          .createNewPropertyVector<double>(
+                              name, MeshLib::MeshItemType::Cell, 1));
+            for (auto const* e : _src_mesh->getElements())
+            {
+                MeshLib::Node const c(e->getCenterOfGravity());
+                pv.push_back(f(c[0], c[1]));
+            }
+            _src_values.push_back(pv);
+        };
+        add_property("linear", [](double x, double y) { return 2 * x - y; });
+        add_property("sine", [](double x, double y)
+                     {
+                         return std::sin(5 * x) * std::cos(3 * y);
+                     });
+    }
+
+protected:
+    std::unique_ptr<MeshLib::Mesh> _src_mesh;
+    std::unique_ptr<MeshLib::Mesh> _dest_mesh;
+    std::vector<std::vector<double>> _src_values;
+};
+}  // anonymous namespace
+
+TEST_F(MeshLibMesh2MeshPropertyInterpolation, SeveralProperties)
+{
+    std::vector<std::string> const names = {"linear", "sine"};
+    MeshLib::Mesh2MeshPropertyInterpolation const interpolation(*_src_mesh,
+                                                                names);
+    ASSERT_TRUE(interpolation.setPropertiesForMesh(*_dest_mesh));
+
+    for (std::size_t p = 0; p < names.size(); ++p)
+    {
+        auto const dest_pv =
+            _dest_mesh->getProperties().getPropertyVector<double>(names[p]);
+        ASSERT_TRUE(dest_pv.is_initialized());
+        ASSERT_EQ(_dest_mesh->getNumberOfElements(), dest_pv->size());
+        auto const expected =
+            interpolateBruteForce(*_src_mesh, _src_values[p], *_dest_mesh);
+        for (std::size_t k = 0; k < expected.size(); ++k)
+            EXPECT_NEAR(expected[k], (*dest_pv)[k], 1e-12);
+    }
+}
+
+TEST_F(MeshLibMesh2MeshPropertyInterpolation, CachedWeights)
+{
+    MeshLib::Mesh2MeshPropertyInterpolation const interpolation(*_src_mesh,
+                                                                "linear");
+    ASSERT_TRUE(interpolation.setPropertiesForMesh(*_dest_mesh));
+
+    // transfer other values, e.g. of another time step
+    std::vector<double> dest_values;
+    for (auto const& src_values : _src_values)
+    {
+        ASSERT_TRUE(interpolation.interpolateElementValues(
+            *_dest_mesh, src_values, dest_values));
+        auto const expected =
+            interpolateBruteForce(*_src_mesh, src_values, *_dest_mesh);
+        ASSERT_EQ(expected.size(), dest_values.size());
+        for (std::size_t k = 0; k < expected.size(); ++k)
+            EXPECT_NEAR(expected[k], dest_values[k], 1e-12);
+    }
+
+    // wrong number of source values
+    EXPECT_FALSE(interpolation.interpolateElementValues(
+        *_dest_mesh, std::vector<double>(3, 1.0), dest_values));
+}
+
+TEST_F(MeshLibMesh2MeshPropertyInterpolation, InvalidInput)
+{
+    MeshLib::Mesh2MeshPropertyInterpolation const missing_property(
+        *_src_mesh, "does_not_exist");
+    EXPECT_FALSE(missing_property.setPropertiesForMesh(*_dest_mesh));
+
+    std::unique_ptr<MeshLib::Mesh> hex_mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 2));
+    MeshLib::Mesh2MeshPropertyInterpolation const interpolation(*_src_mesh,
+                                                                "linear");
+    EXPECT_FALSE(interpolation.setPropertiesForMesh(*hex_mesh));
+}
@@ -0,0 +1,115 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSurfaceExtraction.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+/// Checks the bulk id properties of the boundary mesh and compares the
+/// boundary faces with the faces without neighbour in the bulk mesh.
+void checkBoundaryMesh(MeshLib::Mesh const& bulk_mesh,
+                       MeshLib::Mesh const& boundary_mesh)
+{
+    bool const use_edges(bulk_mesh.getDimension() == 2);
+    auto const bulk_node_ids =
+        boundary_mesh.getProperties().getPropertyVector<std::size_t>(
+            "bulk_node_ids");
+    auto const bulk_element_ids =
+        boundary_mesh.getProperties().getPropertyVector<std::size_t>(
+            "bulk_element_ids");
+    auto const bulk_face_ids =
+        boundary_mesh.getProperties().getPropertyVector<std::size_t>(
+            "bulk_face_ids");
+    ASSERT_TRUE(bulk_node_ids && bulk_element_ids && bulk_face_ids);
+    ASSERT_EQ(boundary_mesh.getNumberOfNodes(), bulk_node_ids->size());
+    ASSERT_EQ(boundary_mesh.getNumberOfElements(), bulk_element_ids->size());
+
+    for (std::size_t k = 0; k < boundary_mesh.getNumberOfNodes(); ++k)
+    {
+        MeshLib::Node const& node(*boundary_mesh.getNode(k));
+        MeshLib::Node const& bulk_node(
+            *bulk_mesh.getNode((*bulk_node_ids)[k]));
+        for (unsigned d = 0; d < 3; ++d)
+            EXPECT_EQ(bulk_node[d], node[d]);
+    }
+
+    std::size_t n_faces_without_neighbor = 0;
+    for (auto const* bulk_element : bulk_mesh.getElements())
+        for (unsigned i = 0; i < bulk_element->getNumberOfNeighbors(); ++i)
+            if (bulk_element->getNeighbor(i) == nullptr)
+                ++n_faces_without_neighbor;
+    EXPECT_EQ(n_faces_without_neighbor, boundary_mesh.getNumberOfElements());
+
+    for (std::size_t k = 0; k < boundary_mesh.getNumberOfElements(); ++k)
+    {
+        MeshLib::Element const& bulk_element(
+            *bulk_mesh.getElement((*bulk_element_ids)[k]));
+        unsigned const face_id((*bulk_face_ids)[k]);
+        EXPECT_EQ(nullptr, bulk_element.getNeighbor(face_id));
+        MeshLib::BoundaryView const face(use_edges
+                                             ? bulk_element.getEdgeView(face_id)
+                                             : bulk_element.getFaceView(face_id));
+        MeshLib::Element const& element(*boundary_mesh.getElement(k));
+        ASSERT_EQ(face.getNumberOfNodes(), element.getNumberOfNodes());
+        for (unsigned i = 0; i < face.getNumberOfNodes(); ++i)
+            EXPECT_EQ(face.getNode(i)->getID(),
+                      (*bulk_node_ids)[element.getNodeIndex(i)]);
+    }
+}
+}  // anonymous namespace
+
+TEST(MeshLibMeshBoundary, HexMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 3));
+    std::unique_ptr<MeshLib::Mesh> const boundary(
+        MeshLib::MeshSurfaceExtraction::getMeshBoundary(*mesh));
+    ASSERT_TRUE(boundary != nullptr);
+    EXPECT_EQ(2u, boundary->getDimension());
+    EXPECT_EQ(6u * 3 * 3, boundary->getNumberOfElements());
+    EXPECT_EQ(4u * 4 * 4 - 2 * 2 * 2, boundary->getNumberOfNodes());
+    checkBoundaryMesh(*mesh, *boundary);
+}
+
+TEST(MeshLibMeshBoundary, TriMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularTriMesh(5, 4, 1.0));
+    std::unique_ptr<MeshLib::Mesh> const boundary(
+        MeshLib::MeshSurfaceExtraction::getMeshBoundary(*mesh));
+    ASSERT_TRUE(boundary != nullptr);
+    EXPECT_EQ(1u, boundary->getDimension());
+    EXPECT_EQ(2u * (5 + 4), boundary->getNumberOfElements());
+    EXPECT_EQ(2u * (5 + 4), boundary->getNumberOfNodes());
+    checkBoundaryMesh(*mesh, *boundary);
+}
+
+TEST(MeshLibMeshBoundary, BoundaryFacesOfLargerMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 20));
+    std::vector<MeshLib::BoundaryFace> const faces(
+        MeshLib::getBoundaryFaces(*mesh));
+    ASSERT_EQ(6u * 20 * 20, faces.size());
+    for (std::size_t k = 1; k < faces.size(); ++k)
+        EXPECT_TRUE(faces[k - 1].element_id < faces[k].element_id ||
+                    (faces[k - 1].element_id == faces[k].element_id &&
+                     faces[k - 1].face_id < faces[k].face_id));
+    for (auto const& face : faces)
+        EXPECT_EQ(nullptr,
+                  mesh->getElement(face.element_id)->getNeighbor(face.face_id));
+}
@@ -0,0 +1,38 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshInformation.h"
+
+TEST(MeshLibMeshInformation, MemoryUsage)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+
+    auto const usage = MeshLib::MeshInformation::getMemoryUsage(*mesh);
+
+    auto const& elements = mesh->getElements();
+    EXPECT_EQ(elements.capacity() * sizeof(MeshLib::Element*) +
+                  elements.size() * sizeof(MeshLib::Quad),
+              usage.elements);
+
+    // The connected nodes are computed lazily; the estimate includes them
+    // before and is exact afterwards.
+    mesh->setNodesConnectedByElements();
+    auto const usage_with_adjacency =
+        MeshLib::MeshInformation::getMemoryUsage(*mesh);
+    EXPECT_EQ(usage_with_adjacency.connectivity, usage.connectivity);
+    EXPECT_EQ(usage_with_adjacency.nodes, usage.nodes);
+}
@@ -13,6 +13,7 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "GeoLib/Polyline.h"
@@ -22,6 +23,7 @@
 #include "MeshLib/Node.h"
 #include "MeshLib/MeshGenerators/MeshGenerator.h"
 #include "MeshGeoToolsLib/MeshNodeSearcher.h"
+#include "MeshGeoToolsLib/MeshNodesAlongPolyline.h"
 #include "MeshGeoToolsLib/HeuristicSearchLength.h"
 
 using namespace MeshLib;
@@ -387,3 +389,105 @@ TEST_F(MeshLibMeshNodeSearchInSimpleHexMesh, SurfaceSearch)
     std::for_each(pnts.begin(), pnts.end(), [](GeoLib::Point* pnt) { delete pnt; });
 }
 
+
+TEST_F(MeshLibMeshNodeSearchInSimpleHexMesh, SlantedGeometriesBruteForce)
+{
+    ASSERT_TRUE(_hex_mesh != nullptr);
+    std::vector<GeoLib::Point*> pnts;
+    pnts.push_back(new GeoLib::Point(0.0, 0.0, 0.0));
+    pnts.push_back(new GeoLib::Point(_geometric_size, 0.3 * _geometric_size, _geometric_size));
+    pnts.push_back(new GeoLib::Point(0.2 * _geometric_size, _geometric_size, 0.7 * _geometric_size));
+    pnts.push_back(new GeoLib::Point(_geometric_size, 0.0, 0.0));
+    pnts.push_back(new GeoLib::Point(0.0, _geometric_size, _geometric_size));
+    pnts.push_back(new GeoLib::Point(_geometric_size, _geometric_size, _geometric_size));
+
+    double const eps = 0.35;
+    MeshGeoToolsLib::SearchLength search_length(eps);
+    MeshGeoToolsLib::MeshNodeSearcher mesh_node_searcher(*_hex_mesh,
+        search_length);
+
+    // polyline crossing the cube diagonally
+    GeoLib::Polyline ply(pnts);
+    ply.addPoint(0);
+    ply.addPoint(1);
+    ply.addPoint(2);
+    std::vector<std::size_t> expected_ply_ids;
+    std::vector<double> expected_dists;
+    for (auto const* node : _hex_mesh->getNodes()) {
+        double const dist = ply.getDistanceAlongPolyline(*node, eps);
+        if (dist >= 0.0) {
+            expected_ply_ids.push_back(node->getID());
+            expected_dists.push_back(dist);
+        }
+    }
+    auto const& found_ply =
+        mesh_node_searcher.getMeshNodesAlongPolyline(ply);
+    ASSERT_LT(0u, expected_ply_ids.size());
+    ASSERT_EQ(expected_ply_ids.size(), found_ply.getNodeIDs().size());
+    std::vector<std::size_t> found_ply_ids(found_ply.getNodeIDs());
+    std::sort(found_ply_ids.begin(), found_ply_ids.end());
+    ASSERT_EQ(expected_ply_ids, found_ply_ids);
+    std::sort(expected_dists.begin(), expected_dists.end());
+    ASSERT_EQ(expected_dists, found_ply.getDistOfProjNodeFromPlyStart());
+
+    // slanted plane through the cube
+    GeoLib::Polyline ply_sfc(pnts);
+    ply_sfc.addPoint(0);
+    ply_sfc.addPoint(3);
+    ply_sfc.addPoint(5);
+    ply_sfc.addPoint(4);
+    ply_sfc.addPoint(0);
+    std::unique_ptr<GeoLib::Surface> sfc(GeoLib::Surface::createSurface(ply_sfc));
+    ASSERT_TRUE(sfc != nullptr);
+    std::vector<std::size_t> expected_sfc_ids;
+    for (auto const* node : _hex_mesh->getNodes())
+        if (sfc->isPntInBoundingVolume(*node) && sfc->isPntInSfc(*node, eps))
+            expected_sfc_ids.push_back(node->getID());
+    ASSERT_LT(0u, expected_sfc_ids.size());
+    ASSERT_EQ(expected_sfc_ids,
+              mesh_node_searcher.getMeshNodeIDsAlongSurface(*sfc));
+
+    std::for_each(pnts.begin(), pnts.end(), [](GeoLib::Point* pnt) { delete pnt; });
+}
+
+TEST(MeshLibMeshNodeSearch, SurfaceSmallEpsilonFineGrid)
+{
+    // The grid cells of the fine mesh are smaller than sqrt(eps), the
+    // distance up to which isPntInSfc() finds nodes for eps < 1.
+    std::unique_ptr<Mesh> const hex_mesh(
+        MeshGenerator::generateRegularHexMesh(1.0, 40));
+    std::vector<GeoLib::Point*> pnts;
+    pnts.push_back(new GeoLib::Point(0.0, 0.0, 0.0));
+    pnts.push_back(new GeoLib::Point(0.5, 0.0, 0.0));
+    pnts.push_back(new GeoLib::Point(0.0, 1.0, 0.0));
+    pnts.push_back(new GeoLib::Point(1.0, 0.0, 0.0));
+    pnts.push_back(new GeoLib::Point(1.0, 1.0, 0.0));
+    pnts.push_back(new GeoLib::Point(1.0, 0.0, 1.0));
+
+    // A horizontal and a vertical triangle. The vertical one extends the
+    // bounding volume of the surface, such that nodes above the horizontal
+    // triangle up to a distance of sqrt(eps) are inside it.
+    GeoLib::Surface sfc(pnts);
+    sfc.addTriangle(0, 1, 2);
+    sfc.addTriangle(3, 4, 5);
+
+    double const eps = 0.09;
+    MeshGeoToolsLib::SearchLength search_length(eps);
+    MeshGeoToolsLib::MeshNodeSearcher mesh_node_searcher(*hex_mesh,
+        search_length);
+
+    std::vector<std::size_t> expected_sfc_ids;
+    bool found_beyond_eps = false;
+    for (auto const* node : hex_mesh->getNodes())
+        if (sfc.isPntInBoundingVolume(*node) && sfc.isPntInSfc(*node, eps))
+        {
+            expected_sfc_ids.push_back(node->getID());
+            if ((*node)[0] < 0.5 && (*node)[2] > 2 * eps)
+                found_beyond_eps = true;
+        }
+    ASSERT_TRUE(found_beyond_eps);
+    ASSERT_EQ(expected_sfc_ids,
+              mesh_node_searcher.getMeshNodeIDsAlongSurface(sfc));
+
+    std::for_each(pnts.begin(), pnts.end(), [](GeoLib::Point* pnt) { delete pnt; });
+}
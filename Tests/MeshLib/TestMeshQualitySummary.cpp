@@ -0,0 +1,72 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshQuality/ElementQualityInterface.h"
+#include "MeshLib/MeshQuality/MeshQualitySummary.h"
+#include "MeshLib/MeshQuality/MeshValidation.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+void compareWithSingleMetrics(MeshLib::Mesh const& mesh)
+{
+    MeshLib::MeshQualitySummary const summary(mesh);
+
+    EXPECT_EQ(MeshLib::MeshValidation::testElementGeometry(mesh),
+              summary.getElementErrorCodes());
+
+    for (auto const t : {MeshLib::MeshQualityType::ELEMENTSIZE,
+                         MeshLib::MeshQualityType::SIZEDIFFERENCE,
+                         MeshLib::MeshQualityType::EDGERATIO,
+                         MeshLib::MeshQualityType::EQUIANGLESKEW,
+                         MeshLib::MeshQualityType::RADIUSEDGERATIO})
+    {
+        MeshLib::ElementQualityInterface const single(mesh, t);
+        EXPECT_EQ(single.getQualityVector(), summary.getElementQuality(t))
+            << MeshLib::MeshQualityType2String(t);
+
+        auto const histogram = summary.getHistogram(t, 4);
+        EXPECT_EQ(4u, histogram.getNumberOfBins());
+        std::size_t n_values = 0;
+        for (auto const count : histogram.getBinCounts())
+            n_values += count;
+        EXPECT_EQ(mesh.getNumberOfElements(), n_values);
+    }
+}
+}  // anonymous namespace
+
+TEST(MeshLibMeshQualitySummary, TriMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularTriMesh(5, 4, 1.0));
+    // distort the mesh
+    (*const_cast<MeshLib::Node*>(mesh->getNode(7)))[0] += 0.3;
+    compareWithSingleMetrics(*mesh);
+}
+
+TEST(MeshLibMeshQualitySummary, HexMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 4));
+    compareWithSingleMetrics(*mesh);
+
+    MeshLib::MeshQualitySummary const summary(*mesh);
+    for (double const q :
+         summary.getElementQuality(MeshLib::MeshQualityType::ELEMENTSIZE))
+        EXPECT_NEAR(1.0 / 64, q, 1e-15);
+    for (double const q :
+         summary.getElementQuality(MeshLib::MeshQualityType::EDGERATIO))
+        EXPECT_NEAR(1.0, q, 1e-15);
+}
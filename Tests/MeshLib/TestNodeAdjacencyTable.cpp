@@ -130,3 +130,26 @@ TEST(MeshLib, CreateNodeAdjacencyTable3D)
         }
     }
 }
+
+TEST(MeshLib, NodeAdjacencyTableOfCopiedMesh)
+{
+    using namespace MeshLib;
+
+    std::unique_ptr<Mesh> mesh(
+        MeshGenerator::generateRegularHexMesh(1.0, std::size_t(5)));
+    // The connected nodes of the copy are computed lazily, those of the
+    // original mesh in parallel.
+    std::unique_ptr<Mesh> copy(new Mesh(*mesh));
+    mesh->setNodesConnectedByElements();
+
+    NodeAdjacencyTable table(mesh->getNodes());
+    NodeAdjacencyTable copy_table(copy->getNodes());
+    ASSERT_EQ(table.size(), copy_table.size());
+    for (std::size_t i = 0; i < table.size(); ++i)
+    {
+        ASSERT_EQ(table.getAdjacentNodes(i), copy_table.getAdjacentNodes(i));
+        // The connected nodes must belong to the respective mesh.
+        for (auto const* node : copy->getNode(i)->getConnectedNodes())
+            ASSERT_EQ(copy->getNode(node->getID()), node);
+    }
+}
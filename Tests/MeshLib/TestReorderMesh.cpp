@@ -0,0 +1,194 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MathLib/MathTools.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/ReorderMesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+#include "Tests/MeshLib/RegularQuad8Mesh.h"
+
+namespace
+{
+/// Creates a regular hex mesh with properties storing the node coordinates
+/// and the element ids.
+std::unique_ptr<MeshLib::Mesh> createHexMeshWithProperties(std::size_t const n)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, n));
+
+    auto coordinates =
+        mesh->getProperties().createNewPropertyVector<double>(
+            "coordinates", MeshLib::MeshItemType::Node, 3);
+    for (auto const* node : mesh->getNodes())
+        coordinates->insert(coordinates->end(), node->getCoords(),
+                            node->getCoords() + 3);
+    auto element_ids = mesh->getProperties().createNewPropertyVector<int>(
+        "element_ids", MeshLib::MeshItemType::Cell, 1);
+    element_ids->resize(mesh->getNumberOfElements());
+    std::iota(element_ids->begin(), element_ids->end(), 0);
+    return mesh;
+}
+
+/// Numbers the nodes of the mesh randomly.
+std::unique_ptr<MeshLib::Mesh> shuffleNodes(MeshLib::Mesh const& mesh)
+{
+    std::vector<std::size_t> order(mesh.getNumberOfNodes());
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(1));
+    return std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::reorderMesh(mesh, order, "shuffled"));
+}
+
+void checkReorderedMesh(MeshLib::Mesh const& original,
+                        MeshLib::Mesh const& reordered)
+{
+    ASSERT_EQ(original.getNumberOfNodes(), reordered.getNumberOfNodes());
+    ASSERT_EQ(original.getNumberOfElements(),
+              reordered.getNumberOfElements());
+
+    // the node properties moved with the nodes
+    auto const coordinates =
+        reordered.getProperties().getPropertyVector<double>("coordinates");
+    ASSERT_TRUE(coordinates.is_initialized());
+    for (auto const* node : reordered.getNodes())
+        for (unsigned d = 0; d < 3; ++d)
+            EXPECT_EQ((*node)[d], (*coordinates)[node->getID() * 3 + d]);
+
+    // each element is still present and its cell property moved with it
+    auto const element_ids =
+        reordered.getProperties().getPropertyVector<int>("element_ids");
+    ASSERT_TRUE(element_ids.is_initialized());
+    std::vector<bool> found(original.getNumberOfElements(), false);
+    for (auto const* element : reordered.getElements())
+    {
+        int const id = (*element_ids)[element->getID()];
+        ASSERT_FALSE(found[id]);
+        found[id] = true;
+        auto const& original_element = *original.getElement(id);
+        ASSERT_EQ(original_element.getNumberOfNodes(),
+                  element->getNumberOfNodes());
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+            EXPECT_EQ(0, MathLib::sqrDist(*element->getNode(i),
+                                          *original_element.getNode(i)));
+    }
+}
+
+/// Returns the largest difference of the positions of two nodes of an element
+/// in the given node order. Unlike computeNodeBandwidth() of the reordered
+/// mesh, this is not affected by reorderMesh() keeping the base nodes in
+/// front.
+std::size_t computeOrderBandwidth(MeshLib::Mesh const& mesh,
+                                  std::vector<std::size_t> const& order)
+{
+    std::vector<std::size_t> position(order.size());
+    for (std::size_t i = 0; i < order.size(); ++i)
+        position[order[i]] = i;
+
+    std::size_t bandwidth = 0;
+    for (auto const* element : mesh.getElements())
+    {
+        std::size_t min_position = order.size();
+        std::size_t max_position = 0;
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+        {
+            std::size_t const p = position[element->getNodeIndex(i)];
+            min_position = std::min(min_position, p);
+            max_position = std::max(max_position, p);
+        }
+        bandwidth = std::max(bandwidth, max_position - min_position);
+    }
+    return bandwidth;
+}
+}  // anonymous namespace
+
+TEST(MeshLibReorderMesh, ReverseCuthillMcKee)
+{
+    std::size_t const n = 8;
+    auto const regular_mesh = createHexMeshWithProperties(n);
+    auto const mesh = shuffleNodes(*regular_mesh);
+    ASSERT_TRUE(mesh != nullptr);
+    checkReorderedMesh(*regular_mesh, *mesh);
+    EXPECT_LT(mesh->getNumberOfNodes() / 2,
+              MeshLib::computeNodeBandwidth(*mesh));
+
+    auto const order = MeshLib::computeReverseCuthillMcKeeOrder(*mesh);
+    std::unique_ptr<MeshLib::Mesh> const reordered(
+        MeshLib::reorderMesh(*mesh, order, "rcm"));
+    ASSERT_TRUE(reordered != nullptr);
+    checkReorderedMesh(*regular_mesh, *reordered);
+
+    // Starting at a corner, the level sets of the breadth first search are
+    // the cube shells of the grid; the bandwidth is about the size of the
+    // largest shell.
+    EXPECT_GE(3 * (n + 1) * (n + 1),
+              MeshLib::computeNodeBandwidth(*reordered));
+}
+
+TEST(MeshLibReorderMesh, ReverseCuthillMcKeeQuadratic)
+{
+    std::size_t const n = 8;
+    std::unique_ptr<MeshLib::Mesh> const regular_mesh(
+        MeshLib::createRegularQuad8Mesh(n, 1.0));
+    auto const mesh = shuffleNodes(*regular_mesh);
+    ASSERT_TRUE(mesh != nullptr);
+    EXPECT_LT(mesh->getNumberOfNodes() / 2,
+              MeshLib::computeNodeBandwidth(*mesh));
+
+    auto const order = MeshLib::computeReverseCuthillMcKeeOrder(*mesh);
+    ASSERT_EQ(mesh->getNumberOfNodes(), order.size());
+
+    // The mid-edge nodes are numbered next to the other nodes of their
+    // elements, i.e. the bandwidth is about the number of nodes on two
+    // diagonals of the lattice.
+    EXPECT_GE(4 * (2 * n + 1), computeOrderBandwidth(*mesh, order));
+}
+
+TEST(MeshLibReorderMesh, HilbertCurve)
+{
+    // 8 nodes in each direction, i.e. the nodes lie in distinct cells of the
+    // Hilbert curve of order 3
+    std::size_t const n = 7;
+    auto const regular_mesh = createHexMeshWithProperties(n);
+    auto const mesh = shuffleNodes(*regular_mesh);
+    ASSERT_TRUE(mesh != nullptr);
+
+    auto const order = MeshLib::computeHilbertCurveOrder(mesh->getNodes());
+    std::unique_ptr<MeshLib::Mesh> const reordered(
+        MeshLib::reorderMesh(*mesh, order, "hilbert"));
+    ASSERT_TRUE(reordered != nullptr);
+    checkReorderedMesh(*regular_mesh, *reordered);
+
+    // consecutive nodes are neighbours in the grid
+    double const h = 1.0 / n;
+    for (std::size_t i = 1; i < reordered->getNumberOfNodes(); ++i)
+        EXPECT_NEAR(h * h, MathLib::sqrDist(*reordered->getNode(i - 1),
+                                            *reordered->getNode(i)),
+                    1e-12);
+}
+
+TEST(MeshLibReorderMesh, InvalidOrder)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 2));
+    std::vector<std::size_t> order(mesh->getNumberOfNodes(), 0);
+    EXPECT_EQ(nullptr, MeshLib::reorderMesh(*mesh, order, "invalid"));
+    order.resize(2);
+    EXPECT_EQ(nullptr, MeshLib::reorderMesh(*mesh, order, "invalid"));
+}
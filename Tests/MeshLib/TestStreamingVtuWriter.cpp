@@ -0,0 +1,199 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdint>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <vtk_zlib.h>
+
+#include "BaseLib/BuildInfo.h"
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/VtkIO/StreamingVtuWriter.h"
+#include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+// Writes the mesh in all data modes, reads it back with VTK and compares.
+#ifndef USE_PETSC
+TEST(MeshLibStreamingVtuWriter, Roundtrip)
+#else
+TEST(MeshLibStreamingVtuWriter, DISABLED_Roundtrip)
+#endif
+{
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "/StreamingVtuWriter.vtu";
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 10));
+    auto material_ids = mesh->getProperties().createNewPropertyVector<int>(
+        "MaterialIDs", MeshLib::MeshItemType::Cell);
+    for (std::size_t i = 0; i < mesh->getNumberOfElements(); ++i)
+        material_ids->push_back(i % 3);
+    auto velocity = mesh->getProperties().createNewPropertyVector<double>(
+        "velocity", MeshLib::MeshItemType::Node, 3);
+    for (std::size_t i = 0; i < 3 * mesh->getNumberOfNodes(); ++i)
+        velocity->push_back(0.25 * i);
+
+    using MeshLib::IO::VtuDataMode;
+    for (auto data_mode :
+         {VtuDataMode::Ascii, VtuDataMode::Binary, VtuDataMode::Appended})
+    {
+        for (bool compress : {false, true})
+        {
+            if (data_mode == VtuDataMode::Ascii && compress)
+                continue;
+            MeshLib::IO::StreamingVtuWriter writer(*mesh, data_mode, compress);
+            ASSERT_TRUE(writer.writeToFile(file_name));
+
+            std::unique_ptr<MeshLib::Mesh> read(
+                MeshLib::IO::VtuInterface::readVTUFile(file_name));
+            ASSERT_TRUE(read != nullptr);
+            ASSERT_EQ(mesh->getNumberOfNodes(), read->getNumberOfNodes());
+            ASSERT_EQ(mesh->getNumberOfElements(),
+                      read->getNumberOfElements());
+
+            for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+                for (unsigned c = 0; c < 3; ++c)
+                    ASSERT_EQ((*mesh->getNode(i))[c], (*read->getNode(i))[c]);
+            for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+            {
+                auto const& expected = *mesh->getElement(e);
+                auto const& actual = *read->getElement(e);
+                ASSERT_EQ(expected.getCellType(), actual.getCellType());
+                for (unsigned n = 0; n < expected.getNumberOfNodes(); ++n)
+                    ASSERT_EQ(expected.getNodeIndex(n), actual.getNodeIndex(n));
+            }
+
+            auto const read_material_ids =
+                read->getProperties().getPropertyVector<int>("MaterialIDs");
+            ASSERT_TRUE(!!read_material_ids);
+            EXPECT_TRUE(std::equal(material_ids->begin(), material_ids->end(),
+                                   read_material_ids->begin()));
+
+            auto const read_velocity =
+                read->getProperties().getPropertyVector<double>("velocity");
+            ASSERT_TRUE(!!read_velocity);
+            EXPECT_EQ(3u, read_velocity->getNumberOfComponents());
+            EXPECT_TRUE(std::equal(velocity->begin(), velocity->end(),
+                                   read_velocity->begin()));
+        }
+    }
+    std::remove(file_name.c_str());
+}
+
+namespace
+{
+/// Extracts the data of the named array from the appended data section of
+/// a vtu document and decompresses it if necessary.
+std::vector<char> readAppendedArray(std::string const& vtu,
+                                    std::string const& name,
+                                    bool const compressed)
+{
+    auto const name_position = vtu.find("Name=\"" + name + "\"");
+    auto const offset_position =
+        vtu.find("offset=\"", name_position) + std::strlen("offset=\"");
+    std::size_t const offset = std::stoul(vtu.substr(offset_position));
+    auto const data_begin = vtu.find("<AppendedData encoding=\"raw\">\n   _");
+    char const* data = vtu.data() + vtu.find('_', data_begin) + 1 + offset;
+
+    auto const read_header = [&data]() -> std::uint64_t
+    {
+        std::uint64_t value;
+        std::memcpy(&value, data, sizeof(value));
+        data += sizeof(value);
+        return value;
+    };
+
+    if (!compressed)
+    {
+        auto const n_bytes = read_header();
+        return std::vector<char>(data, data + n_bytes);
+    }
+
+    auto const n_blocks = read_header();
+    auto const block_size = read_header();
+    auto const last_block_size = read_header();
+    EXPECT_EQ(MeshLib::IO::StreamingVtuWriter::block_size, block_size);
+    std::vector<std::uint64_t> compressed_sizes;
+    for (std::uint64_t b = 0; b < n_blocks; ++b)
+        compressed_sizes.push_back(read_header());
+
+    std::vector<char> values;
+    for (std::uint64_t b = 0; b < n_blocks; ++b)
+    {
+        // A last block size of zero denotes a full last block.
+        uLongf size = (b + 1 == n_blocks && last_block_size != 0)
+                          ? last_block_size
+                          : block_size;
+        std::vector<char> block(size);
+        EXPECT_EQ(Z_OK, uncompress(reinterpret_cast<Bytef*>(block.data()),
+                                   &size,
+                                   reinterpret_cast<Bytef const*>(data),
+                                   compressed_sizes[b]));
+        block.resize(size);
+        values.insert(values.end(), block.begin(), block.end());
+        data += compressed_sizes[b];
+    }
+    return values;
+}
+
+template <typename T>
+void expectEqualBytes(std::vector<T> const& expected,
+                      std::vector<char> const& actual)
+{
+    ASSERT_EQ(expected.size() * sizeof(T), actual.size());
+    EXPECT_EQ(0, std::memcmp(expected.data(), actual.data(), actual.size()));
+}
+}  // anonymous namespace
+
+// Checks the block structure of the appended data of arrays spanning
+// several compression blocks, including an array whose size is an exact
+// multiple of the block size.
+TEST(MeshLibStreamingVtuWriter, AppendedDataBlocks)
+{
+    // 129 * 65 nodes, i.e. 201240 bytes of coordinates, and 128 * 64 cells,
+    // i.e. exactly two blocks of doubles per cell.
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(128, 64, 0.5));
+    auto pressure = mesh->getProperties().createNewPropertyVector<double>(
+        "pressure", MeshLib::MeshItemType::Cell);
+    for (std::size_t i = 0; i < mesh->getNumberOfElements(); ++i)
+        pressure->push_back(std::sin(0.01 * i));
+    ASSERT_EQ(2 * MeshLib::IO::StreamingVtuWriter::block_size,
+              pressure->size() * sizeof(double));
+
+    std::vector<double> coordinates;
+    for (auto const* node : mesh->getNodes())
+        coordinates.insert(coordinates.end(), node->getCoords(),
+                           node->getCoords() + 3);
+    std::vector<double> const pressure_values(pressure->begin(),
+                                              pressure->end());
+
+    for (bool compress : {false, true})
+    {
+        std::ostringstream os;
+        MeshLib::IO::StreamingVtuWriter const writer(
+            *mesh, MeshLib::IO::VtuDataMode::Appended, compress);
+        writer.write(os);
+        std::string const vtu = os.str();
+
+        expectEqualBytes(coordinates,
+                         readAppendedArray(vtu, "Points", compress));
+        expectEqualBytes(pressure_values,
+                         readAppendedArray(vtu, "pressure", compress));
+    }
+}
@@ -0,0 +1,139 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/BuildInfo.h"
+
+#include "MeshLib/IO/XDMF/XdmfTimeSeriesWriter.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+
+namespace
+{
+std::string readFile(std::string const& file_name)
+{
+    std::ifstream is(file_name, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(is),
+                       std::istreambuf_iterator<char>());
+}
+
+std::size_t countOccurrences(std::string const& text, std::string const& word)
+{
+    std::size_t count = 0;
+    for (auto pos = text.find(word); pos != std::string::npos;
+         pos = text.find(word, pos + 1))
+        ++count;
+    return count;
+}
+}  // anonymous namespace
+
+TEST(MeshLibXdmfTimeSeriesWriter, WriteOnlyChangedArrays)
+{
+    std::string const prefix =
+        BaseLib::BuildInfo::tests_tmp_path + "/XdmfTimeSeries";
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(3, 2, 1.0));
+    auto material_ids = mesh->getProperties().createNewPropertyVector<int>(
+        "MaterialIDs", MeshLib::MeshItemType::Cell);
+    for (std::size_t i = 0; i < mesh->getNumberOfElements(); ++i)
+        material_ids->push_back(i % 2);
+    auto pressure = mesh->getProperties().createNewPropertyVector<double>(
+        "pressure", MeshLib::MeshItemType::Node);
+    pressure->resize(mesh->getNumberOfNodes(), 1.0);
+
+    MeshLib::IO::XdmfTimeSeriesWriter writer(prefix + ".xdmf");
+    writer.addTimeStep(*mesh, 0.0);
+    // geometry, topology, MaterialIDs and pressure
+    EXPECT_EQ(4u, writer.getNumberOfWrittenDataFiles());
+
+    (*pressure)[2] = 2.0;
+    writer.addTimeStep(*mesh, 0.5);
+    EXPECT_EQ(5u, writer.getNumberOfWrittenDataFiles());
+
+    writer.addTimeStep(*mesh, 1.0);
+    EXPECT_EQ(5u, writer.getNumberOfWrittenDataFiles());
+
+    std::string const xdmf = readFile(prefix + ".xdmf");
+    EXPECT_EQ(3u, countOccurrences(xdmf, "<Time Value="));
+    // The arrays are numbered in the order they are written first.
+    EXPECT_EQ(3u, countOccurrences(xdmf, "XdmfTimeSeries_topology_0_0.bin"));
+    EXPECT_EQ(3u, countOccurrences(xdmf, "XdmfTimeSeries_geometry_1_0.bin"));
+    EXPECT_EQ(3u,
+              countOccurrences(
+                  xdmf, "XdmfTimeSeries_attribute_Cell_MaterialIDs_2_0.bin"));
+    EXPECT_EQ(1u, countOccurrences(
+                      xdmf, "XdmfTimeSeries_attribute_Node_pressure_3_0.bin"));
+    EXPECT_EQ(2u, countOccurrences(
+                      xdmf, "XdmfTimeSeries_attribute_Node_pressure_3_1.bin"));
+
+    // 6 quads: type id and 4 node ids each
+    std::string const topology = readFile(prefix + "_topology_0_0.bin");
+    EXPECT_EQ(6 * 5 * sizeof(std::int64_t), topology.size());
+    std::string const pressure_data =
+        readFile(prefix + "_attribute_Node_pressure_3_1.bin");
+    ASSERT_EQ(mesh->getNumberOfNodes() * sizeof(double), pressure_data.size());
+    EXPECT_EQ(2.0, reinterpret_cast<double const*>(pressure_data.data())[2]);
+
+    for (auto const* suffix :
+         {".xdmf", "_topology_0_0.bin", "_geometry_1_0.bin",
+          "_attribute_Cell_MaterialIDs_2_0.bin",
+          "_attribute_Node_pressure_3_0.bin",
+          "_attribute_Node_pressure_3_1.bin"})
+        std::remove((prefix + suffix).c_str());
+}
+
+TEST(MeshLibXdmfTimeSeriesWriter, NamesAndTimes)
+{
+    std::string const prefix =
+        BaseLib::BuildInfo::tests_tmp_path + "/XdmfNames";
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1, 1, 1.0));
+    // Both names are mapped to the same file name part.
+    mesh->getProperties()
+        .createNewPropertyVector<double>("a.b", MeshLib::MeshItemType::Node)
+        ->resize(mesh->getNumberOfNodes(), 1.0);
+    mesh->getProperties()
+        .createNewPropertyVector<double>("a_b", MeshLib::MeshItemType::Node)
+        ->resize(mesh->getNumberOfNodes(), 2.0);
+    mesh->getProperties()
+        .createNewPropertyVector<int>("<\"T&C\">", MeshLib::MeshItemType::Cell)
+        ->resize(mesh->getNumberOfElements(), 3);
+
+    MeshLib::IO::XdmfTimeSeriesWriter writer(prefix + ".xdmf");
+    writer.addTimeStep(*mesh, 0.1);
+
+    std::string const xdmf = readFile(prefix + ".xdmf");
+    EXPECT_EQ(1u, countOccurrences(xdmf, "<Time Value=\"0.10000000000000001\""));
+    EXPECT_EQ(1u, countOccurrences(
+                      xdmf, "Name=\"&lt;&quot;T&amp;C&quot;&gt;\""));
+
+    // topology 0, geometry 1, then the properties in alphabetical order
+    std::string const cell_file = prefix + "_attribute_Cell___T_C___2_0.bin";
+    std::string const a_dot_b_file = prefix + "_attribute_Node_a_b_3_0.bin";
+    std::string const a_b_file = prefix + "_attribute_Node_a_b_4_0.bin";
+    EXPECT_EQ(1.0, reinterpret_cast<double const*>(
+                       readFile(a_dot_b_file).data())[0]);
+    EXPECT_EQ(2.0,
+              reinterpret_cast<double const*>(readFile(a_b_file).data())[0]);
+    EXPECT_EQ(sizeof(int), readFile(cell_file).size());
+
+    for (auto const& file_name :
+         {prefix + ".xdmf", prefix + "_topology_0_0.bin",
+          prefix + "_geometry_1_0.bin", cell_file, a_dot_b_file, a_b_file})
+        std::remove(file_name.c_str());
+}
@@ -0,0 +1,34 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <clocale>
+
+#include <benchmark/benchmark.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+#include "Applications/ApplicationsLib/LinearSolverLibrarySetup.h"
+
+/// Runs the google-benchmark micro-benchmarks. All benchmark arguments, e.g.,
+/// --benchmark_filter or --benchmark_out, are passed through.
+int main(int argc, char* argv[])
+{
+    setlocale(LC_ALL, "C");
+
+    // See testrunner.cpp for the order of the setup objects.
+    ApplicationsLib::LogogSetup logog_setup;
+    ApplicationsLib::LinearSolverLibrarySetup linear_solver_library_setup(
+        argc, argv);
+    logog_setup.setLevel("warn");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -0,0 +1,107 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef TESTS_MICROBENCHMARKS_BENCHMARKTOOLS_H_
+#define TESTS_MICROBENCHMARKS_BENCHMARKTOOLS_H_
+
+#include <memory>
+#include <vector>
+
+#include "MeshLib/Elements/Elements.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshSubset.h"
+#include "MeshLib/MeshSubsets.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+
+namespace MicroBenchmarks
+{
+
+/// Generated mesh of a given element type.
+///
+/// The meshes are kept small in the per-element benchmarks; for the global
+/// benchmarks the number of cells per direction is a benchmark argument.
+template <typename MeshElement>
+struct GeneratedMesh;
+
+template <>
+struct GeneratedMesh<MeshLib::Line>
+{
+    static MeshLib::Mesh* generate(unsigned const n)
+    {
+        return MeshLib::MeshGenerator::generateLineMesh(n, 1.0);
+    }
+};
+
+template <>
+struct GeneratedMesh<MeshLib::Tri>
+{
+    static MeshLib::Mesh* generate(unsigned const n)
+    {
+        return MeshLib::MeshGenerator::generateRegularTriMesh(n, n, 1.0);
+    }
+};
+
+template <>
+struct GeneratedMesh<MeshLib::Quad>
+{
+    static MeshLib::Mesh* generate(unsigned const n)
+    {
+        return MeshLib::MeshGenerator::generateRegularQuadMesh(n, n, 1.0);
+    }
+};
+
+template <>
+struct GeneratedMesh<MeshLib::Prism>
+{
+    static MeshLib::Mesh* generate(unsigned const n)
+    {
+        return MeshLib::MeshGenerator::generateRegularPrismMesh(n, n, n, 1.0);
+    }
+};
+
+template <>
+struct GeneratedMesh<MeshLib::Hex>
+{
+    static MeshLib::Mesh* generate(unsigned const n)
+    {
+        return MeshLib::MeshGenerator::generateRegularHexMesh(n, n, n, 1.0);
+    }
+};
+
+/// A mesh together with a d.o.f. table having \c n_components components on
+/// all nodes, ordered by location as in ProcessLib::Process.
+struct MeshWithDOFTable
+{
+    MeshWithDOFTable(MeshLib::Mesh* mesh_, unsigned const n_components)
+        : mesh(mesh_), all_nodes(new MeshLib::MeshSubset(*mesh, &mesh->getNodes()))
+    {
+        dof_table.reset(new NumLib::LocalToGlobalIndexMap(
+            createMeshSubsets(n_components),
+            NumLib::ComponentOrder::BY_LOCATION));
+    }
+
+    std::vector<std::unique_ptr<MeshLib::MeshSubsets>> createMeshSubsets(
+        unsigned const n_components) const
+    {
+        std::vector<std::unique_ptr<MeshLib::MeshSubsets>> mesh_subsets;
+        for (unsigned c = 0; c < n_components; ++c)
+            mesh_subsets.emplace_back(
+                new MeshLib::MeshSubsets{all_nodes.get()});
+        return mesh_subsets;
+    }
+
+    std::unique_ptr<MeshLib::Mesh> mesh;
+    std::unique_ptr<MeshLib::MeshSubset const> all_nodes;
+    std::unique_ptr<NumLib::LocalToGlobalIndexMap> dof_table;
+};
+
+}  // namespace MicroBenchmarks
+
+#endif  // TESTS_MICROBENCHMARKS_BENCHMARKTOOLS_H_
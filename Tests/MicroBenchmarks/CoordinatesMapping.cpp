@@ -0,0 +1,86 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <array>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "NumLib/Fem/CoordinatesMapping/NaturalCoordinatesMapping.h"
+#include "NumLib/Fem/FiniteElement/C0IsoparametricElements.h"
+#include "NumLib/Fem/Integration/GaussIntegrationPolicy.h"
+#include "NumLib/Fem/ShapeMatrixPolicy.h"
+#include "ProcessLib/Utils/InitShapeMatrices.h"
+
+#include "BenchmarkTools.h"
+
+namespace
+{
+std::array<double, 3> const natural_point{{0.2, 0.15, 0.1}};
+}
+
+template <typename ShapeFunction, unsigned GlobalDim>
+static void NaturalCoordinatesMapping(benchmark::State& state)
+{
+    using MeshElement = typename ShapeFunction::MeshElement;
+    using ShapeMatricesType = ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
+    using ShapeMatrices = typename ShapeMatricesType::ShapeMatrices;
+    using Mapping = NumLib::NaturalCoordinatesMapping<MeshElement, ShapeFunction,
+                                                      ShapeMatrices>;
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MicroBenchmarks::GeneratedMesh<MeshElement>::generate(1));
+    auto const& element =
+        *static_cast<MeshElement const*>(mesh->getElement(0));
+
+    ShapeMatrices shape_matrices(ShapeFunction::DIM, GlobalDim,
+                                 ShapeFunction::NPOINTS);
+    for (auto _ : state)
+    {
+        Mapping::computeShapeMatrices(element, natural_point.data(),
+                                      shape_matrices, GlobalDim);
+        benchmark::DoNotOptimize(shape_matrices.dNdx.data());
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename ShapeFunction, unsigned GlobalDim>
+static void InitShapeMatrices(benchmark::State& state)
+{
+    using MeshElement = typename ShapeFunction::MeshElement;
+    using ShapeMatricesType = ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
+    using IntegrationMethod = typename NumLib::GaussIntegrationPolicy<
+        MeshElement>::IntegrationMethod;
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MicroBenchmarks::GeneratedMesh<MeshElement>::generate(1));
+    auto const& element = *mesh->getElement(0);
+    unsigned const integration_order = state.range(0);
+
+    for (auto _ : state)
+    {
+        auto const shape_matrices =
+            ProcessLib::initShapeMatrices<ShapeFunction, ShapeMatricesType,
+                                          IntegrationMethod, GlobalDim>(
+                element, integration_order);
+        benchmark::DoNotOptimize(shape_matrices.data());
+    }
+}
+
+BENCHMARK_TEMPLATE(NaturalCoordinatesMapping, NumLib::ShapeLine2, 1);
+BENCHMARK_TEMPLATE(NaturalCoordinatesMapping, NumLib::ShapeTri3, 2);
+BENCHMARK_TEMPLATE(NaturalCoordinatesMapping, NumLib::ShapeQuad4, 2);
+BENCHMARK_TEMPLATE(NaturalCoordinatesMapping, NumLib::ShapePrism6, 3);
+BENCHMARK_TEMPLATE(NaturalCoordinatesMapping, NumLib::ShapeHex8, 3);
+
+BENCHMARK_TEMPLATE(InitShapeMatrices, NumLib::ShapeLine2, 1)->DenseRange(1, 3);
+BENCHMARK_TEMPLATE(InitShapeMatrices, NumLib::ShapeTri3, 2)->DenseRange(1, 3);
+BENCHMARK_TEMPLATE(InitShapeMatrices, NumLib::ShapeQuad4, 2)->DenseRange(1, 3);
+BENCHMARK_TEMPLATE(InitShapeMatrices, NumLib::ShapePrism6, 3)->DenseRange(1, 3);
+BENCHMARK_TEMPLATE(InitShapeMatrices, NumLib::ShapeHex8, 3)->DenseRange(1, 3);
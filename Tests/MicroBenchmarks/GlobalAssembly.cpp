@@ -0,0 +1,105 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+#include <Eigen/Dense>
+
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/DOF/DOFTableUtil.h"
+
+#include "BenchmarkTools.h"
+
+// The benchmark argument is the number of cells in each direction.
+
+template <typename MeshElement>
+static void LocalToGlobalIndexMapConstruction(benchmark::State& state)
+{
+    MicroBenchmarks::MeshWithDOFTable mesh_with_dofs(
+        MicroBenchmarks::GeneratedMesh<MeshElement>::generate(state.range(0)),
+        1);
+
+    for (auto _ : state)
+    {
+        NumLib::LocalToGlobalIndexMap dof_table(
+            mesh_with_dofs.createMeshSubsets(1),
+            NumLib::ComponentOrder::BY_LOCATION);
+        benchmark::DoNotOptimize(dof_table.size());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            mesh_with_dofs.mesh->getNumberOfElements());
+}
+
+template <typename MeshElement>
+static void ComputeSparsityPattern(benchmark::State& state)
+{
+    MicroBenchmarks::MeshWithDOFTable mesh_with_dofs(
+        MicroBenchmarks::GeneratedMesh<MeshElement>::generate(state.range(0)),
+        1);
+
+    for (auto _ : state)
+    {
+        auto const sparsity_pattern = NumLib::computeSparsityPattern(
+            *mesh_with_dofs.dof_table, *mesh_with_dofs.mesh);
+        benchmark::DoNotOptimize(sparsity_pattern.data());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            mesh_with_dofs.mesh->getNumberOfNodes());
+}
+
+/// Scatters a dense local matrix of every element into the global matrix.
+template <typename MeshElement>
+static void GlobalMatrixAdd(benchmark::State& state)
+{
+    MicroBenchmarks::MeshWithDOFTable mesh_with_dofs(
+        MicroBenchmarks::GeneratedMesh<MeshElement>::generate(state.range(0)),
+        1);
+    auto const& dof_table = *mesh_with_dofs.dof_table;
+    auto const sparsity_pattern =
+        NumLib::computeSparsityPattern(dof_table, *mesh_with_dofs.mesh);
+    MathLib::MatrixSpecifications const spec{
+        dof_table.dofSizeWithoutGhosts(), dof_table.dofSizeWithoutGhosts(),
+        &dof_table.getGhostIndices(), &sparsity_pattern};
+    auto K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(spec);
+
+    std::size_t const n_elements = mesh_with_dofs.mesh->getNumberOfElements();
+    std::vector<std::vector<GlobalIndexType>> indices(n_elements);
+    for (std::size_t e = 0; e < n_elements; ++e)
+        indices[e] = NumLib::getIndices(e, dof_table);
+
+    Eigen::MatrixXd const local_matrix = Eigen::MatrixXd::Ones(
+        MeshElement::n_all_nodes, MeshElement::n_all_nodes);
+
+    for (auto _ : state)
+    {
+        for (auto const& element_indices : indices)
+            K->add(NumLib::LocalToGlobalIndexMap::RowColumnIndices(
+                       element_indices, element_indices),
+                   local_matrix);
+    }
+    state.SetItemsProcessed(state.iterations() * n_elements);
+}
+
+BENCHMARK_TEMPLATE(LocalToGlobalIndexMapConstruction, MeshLib::Quad)
+    ->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK_TEMPLATE(LocalToGlobalIndexMapConstruction, MeshLib::Hex)
+    ->RangeMultiplier(2)->Range(8, 64);
+
+BENCHMARK_TEMPLATE(ComputeSparsityPattern, MeshLib::Quad)
+    ->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK_TEMPLATE(ComputeSparsityPattern, MeshLib::Hex)
+    ->RangeMultiplier(2)->Range(8, 64);
+
+BENCHMARK_TEMPLATE(GlobalMatrixAdd, MeshLib::Quad)
+    ->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK_TEMPLATE(GlobalMatrixAdd, MeshLib::Hex)
+    ->RangeMultiplier(2)->Range(8, 64);
@@ -0,0 +1,167 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "MaterialLib/Adsorption/DensityLegacy.h"
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/Fem/FiniteElement/C0IsoparametricElements.h"
+#include "NumLib/Fem/Integration/GaussIntegrationPolicy.h"
+#include "ProcessLib/GroundwaterFlow/GroundwaterFlowFEM.h"
+#include "ProcessLib/TES/TESLocalAssembler-impl.h"
+
+#include "BenchmarkTools.h"
+
+namespace
+{
+/// Global matrices and vectors for a mesh with d.o.f. table, into which the
+/// local assembly of the first element is added.
+struct GlobalSystem
+{
+    GlobalSystem(MeshLib::Mesh* mesh, unsigned const n_components)
+        : mesh_with_dofs(mesh, n_components),
+          sparsity_pattern(NumLib::computeSparsityPattern(
+              *mesh_with_dofs.dof_table, *mesh_with_dofs.mesh))
+    {
+        auto const& dof_table = *mesh_with_dofs.dof_table;
+        MathLib::MatrixSpecifications const spec{
+            dof_table.dofSizeWithoutGhosts(), dof_table.dofSizeWithoutGhosts(),
+            &dof_table.getGhostIndices(), &sparsity_pattern};
+
+        M = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(spec);
+        K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(spec);
+        b = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+        x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+    }
+
+    /// Resets the global matrices and the right-hand side every
+    /// reset_interval iterations. The assembly adds into the same nonzero
+    /// entries in every iteration, so its cost does not depend on the
+    /// accumulated values; the periodic reset only keeps them bounded. Its
+    /// cost is amortized over the batch, hence the timing does not have to
+    /// be paused, which would dominate the measurement of the short kernels.
+    void resetPeriodically(std::size_t const iteration)
+    {
+        std::size_t const reset_interval = 1024;
+        if (iteration % reset_interval != 0)
+            return;
+        M->setZero();
+        K->setZero();
+        b->setZero();
+    }
+
+    MicroBenchmarks::MeshWithDOFTable mesh_with_dofs;
+    GlobalSparsityPattern sparsity_pattern;
+    std::unique_ptr<GlobalMatrix> M;
+    std::unique_ptr<GlobalMatrix> K;
+    std::unique_ptr<GlobalVector> b;
+    std::unique_ptr<GlobalVector> x;
+};
+}  // namespace
+
+template <typename ShapeFunction, unsigned GlobalDim>
+static void GroundwaterFlowLocalAssembly(benchmark::State& state)
+{
+    using MeshElement = typename ShapeFunction::MeshElement;
+    using IntegrationMethod = typename NumLib::GaussIntegrationPolicy<
+        MeshElement>::IntegrationMethod;
+    using LocalAssembler =
+        ProcessLib::GroundwaterFlow::LocalAssemblerData<
+            ShapeFunction, IntegrationMethod, GlobalDim>;
+
+    GlobalSystem system(
+        MicroBenchmarks::GeneratedMesh<MeshElement>::generate(2),
+        ProcessLib::GroundwaterFlow::NUM_NODAL_DOF);
+    auto const& dof_table = *system.mesh_with_dofs.dof_table;
+    auto const& element = *system.mesh_with_dofs.mesh->getElement(0);
+
+    ProcessLib::ConstParameter<double> const hydraulic_conductivity(1e-4);
+    ProcessLib::GroundwaterFlow::GroundwaterFlowProcessData const process_data{
+        hydraulic_conductivity};
+    unsigned const integration_order = 2;
+    LocalAssembler local_assembler(element, ShapeFunction::NPOINTS,
+                                   integration_order, process_data);
+
+    std::size_t iteration = 0;
+    for (auto _ : state)
+    {
+        system.resetPeriodically(iteration++);
+        local_assembler.assemble(0, dof_table, 0.0, *system.x, *system.M,
+                                 *system.K, *system.b);
+    }
+}
+
+template <typename ShapeFunction, unsigned GlobalDim>
+static void TESLocalAssembly(benchmark::State& state)
+{
+    using MeshElement = typename ShapeFunction::MeshElement;
+    using IntegrationMethod = typename NumLib::GaussIntegrationPolicy<
+        MeshElement>::IntegrationMethod;
+    using LocalAssembler =
+        ProcessLib::TES::TESLocalAssembler<ShapeFunction, IntegrationMethod,
+                                           GlobalDim>;
+
+    GlobalSystem system(
+        MicroBenchmarks::GeneratedMesh<MeshElement>::generate(2),
+        ProcessLib::TES::NODAL_DOF);
+    auto const& dof_table = *system.mesh_with_dofs.dof_table;
+    auto const& element = *system.mesh_with_dofs.mesh->getElement(0);
+
+    // Parameters of a zeolite adsorption setup.
+    ProcessLib::TES::AssemblyParams ap;
+    ap.react_sys.reset(new Adsorption::DensityLegacy);
+    ap.fluid_specific_heat_source = 0.0;
+    ap.cpG = 1012.0;
+    ap.solid_specific_heat_source = 0.0;
+    ap.solid_heat_cond = 0.4;
+    ap.cpS = 880.0;
+    ap.tortuosity = 1.0;
+    ap.diffusion_coefficient_component = 9.65e-5;
+    ap.poro = 0.7;
+    ap.rho_SR_dry = 1150.0;
+    ap.initial_solid_density = 1150.0;
+    ap.solid_perm_tensor =
+        Eigen::MatrixXd::Identity(GlobalDim, GlobalDim) * 1e-10;
+    ap.delta_t = 1.0;
+
+    // Pressure, temperature and vapour mass fraction at every node.
+    for (std::size_t n = 0; n < system.mesh_with_dofs.mesh->getNumberOfNodes();
+         ++n)
+    {
+        system.x->set(n * ProcessLib::TES::NODAL_DOF, 1e5);
+        system.x->set(n * ProcessLib::TES::NODAL_DOF + 1, 573.0);
+        system.x->set(n * ProcessLib::TES::NODAL_DOF + 2, 0.01);
+    }
+
+    unsigned const integration_order = 2;
+    LocalAssembler local_assembler(
+        element, ShapeFunction::NPOINTS * ProcessLib::TES::NODAL_DOF,
+        integration_order, ap);
+
+    std::size_t iteration = 0;
+    for (auto _ : state)
+    {
+        system.resetPeriodically(iteration++);
+        local_assembler.assemble(0, dof_table, 0.0, *system.x, *system.M,
+                                 *system.K, *system.b);
+    }
+}
+
+BENCHMARK_TEMPLATE(GroundwaterFlowLocalAssembly, NumLib::ShapeLine2, 1);
+BENCHMARK_TEMPLATE(GroundwaterFlowLocalAssembly, NumLib::ShapeTri3, 2);
+BENCHMARK_TEMPLATE(GroundwaterFlowLocalAssembly, NumLib::ShapeQuad4, 2);
+BENCHMARK_TEMPLATE(GroundwaterFlowLocalAssembly, NumLib::ShapePrism6, 3);
+BENCHMARK_TEMPLATE(GroundwaterFlowLocalAssembly, NumLib::ShapeHex8, 3);
+
+BENCHMARK_TEMPLATE(TESLocalAssembly, NumLib::ShapeQuad4, 2);
+BENCHMARK_TEMPLATE(TESLocalAssembly, NumLib::ShapeHex8, 3);
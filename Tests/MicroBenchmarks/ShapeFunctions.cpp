@@ -0,0 +1,93 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <array>
+
+#include <benchmark/benchmark.h>
+
+#include "NumLib/Fem/ShapeFunction/ShapeHex20.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex8.h"
+#include "NumLib/Fem/ShapeFunction/ShapeLine2.h"
+#include "NumLib/Fem/ShapeFunction/ShapeLine3.h"
+#include "NumLib/Fem/ShapeFunction/ShapePoint1.h"
+#include "NumLib/Fem/ShapeFunction/ShapePrism15.h"
+#include "NumLib/Fem/ShapeFunction/ShapePrism6.h"
+#include "NumLib/Fem/ShapeFunction/ShapePyra13.h"
+#include "NumLib/Fem/ShapeFunction/ShapePyra5.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad4.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad8.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad9.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTet10.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTet4.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTri3.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTri6.h"
+
+namespace
+{
+// An arbitrary point inside of all reference elements.
+std::array<double, 3> const natural_point{{0.2, 0.15, 0.1}};
+}
+
+template <typename ShapeFunction>
+static void ShapeFunctionN(benchmark::State& state)
+{
+    std::array<double, ShapeFunction::NPOINTS> N;
+    for (auto _ : state)
+    {
+        ShapeFunction::computeShapeFunction(natural_point, N);
+        benchmark::DoNotOptimize(N.data());
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename ShapeFunction>
+static void ShapeFunctionDN(benchmark::State& state)
+{
+    std::array<double, ShapeFunction::DIM * ShapeFunction::NPOINTS> dN;
+    for (auto _ : state)
+    {
+        ShapeFunction::computeGradShapeFunction(natural_point, dN);
+        benchmark::DoNotOptimize(dN.data());
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapePoint1);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapeLine2);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapeLine3);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapeTri3);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapeTri6);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapeQuad4);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapeQuad8);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapeQuad9);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapeTet4);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapeTet10);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapePrism6);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapePrism15);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapePyra5);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapePyra13);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapeHex8);
+BENCHMARK_TEMPLATE(ShapeFunctionN, NumLib::ShapeHex20);
+
+// ShapePoint1 has no gradient.
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapeLine2);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapeLine3);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapeTri3);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapeTri6);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapeQuad4);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapeQuad8);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapeQuad9);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapeTet4);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapeTet10);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapePrism6);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapePrism15);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapePyra5);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapePyra13);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapeHex8);
+BENCHMARK_TEMPLATE(ShapeFunctionDN, NumLib::ShapeHex20);
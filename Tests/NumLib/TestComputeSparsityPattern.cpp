@@ -0,0 +1,297 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2016, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MeshLib/CompactMesh.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubsets.h"
+#include "MeshLib/NodeAdjacencyTable.h"
+#include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+
+#ifdef USE_PETSC
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+#include <petscmat.h>
+
+#include "MathLib/LinAlg/Dense/DenseMatrix.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/NodePartitionedMesh.h"
+#include "NumLib/DOF/DOFTableUtil.h"
+#include "NumLib/NumericsConfig.h"
+#endif
+
+#ifndef USE_PETSC
+namespace
+{
+/// Reference implementation using the node adjacency table of the mesh.
+GlobalSparsityPattern computeSparsityPatternWithAdjacencyTable(
+    NumLib::LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh)
+{
+    mesh.setNodesConnectedByElements();
+    MeshLib::NodeAdjacencyTable node_adjacency_table;
+    node_adjacency_table.createTable(mesh.getNodes());
+
+    GlobalSparsityPattern sparsity_pattern(dof_table.dofSizeWithGhosts());
+    for (std::size_t n = 0; n < mesh.getNumberOfNodes(); ++n)
+    {
+        for (auto an : node_adjacency_table.getAdjacentNodes(n))
+        {
+            auto const row_ids = dof_table.getGlobalIndices(
+                {mesh.getID(), MeshLib::MeshItemType::Node, an});
+            for (auto r : row_ids)
+                sparsity_pattern[r] += row_ids.size();
+        }
+    }
+    return sparsity_pattern;
+}
+
+void checkSparsityPattern(MeshLib::Mesh const& mesh, std::size_t n_components)
+{
+    MeshLib::MeshSubset const mesh_subset(mesh, &mesh.getNodes());
+    std::vector<std::unique_ptr<MeshLib::MeshSubsets>> components;
+    for (std::size_t c = 0; c < n_components; ++c)
+        components.emplace_back(new MeshLib::MeshSubsets{&mesh_subset});
+    NumLib::LocalToGlobalIndexMap const dof_table(
+        std::move(components), NumLib::ComponentOrder::BY_LOCATION);
+
+    auto const expected =
+        computeSparsityPatternWithAdjacencyTable(dof_table, mesh);
+    EXPECT_EQ(expected, NumLib::computeSparsityPattern(dof_table, mesh));
+
+    MeshLib::CompactMesh const compact_mesh(mesh);
+    EXPECT_EQ(expected, NumLib::computeSparsityPattern(dof_table, compact_mesh,
+                                                       mesh.getID()));
+}
+}  // anonymous namespace
+
+TEST(NumLibComputeSparsityPattern, QuadMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+    checkSparsityPattern(*mesh, 1);
+    checkSparsityPattern(*mesh, 2);
+}
+
+TEST(NumLibComputeSparsityPattern, InteriorQuadNode)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 2));
+    MeshLib::MeshSubset const mesh_subset(*mesh, &mesh->getNodes());
+    std::vector<std::unique_ptr<MeshLib::MeshSubsets>> components;
+    components.emplace_back(new MeshLib::MeshSubsets{&mesh_subset});
+    NumLib::LocalToGlobalIndexMap const dof_table(
+        std::move(components), NumLib::ComponentOrder::BY_LOCATION);
+
+    MeshLib::CompactMesh const compact_mesh(*mesh);
+    auto const sparsity_pattern =
+        NumLib::computeSparsityPattern(dof_table, compact_mesh, mesh->getID());
+    // corner, edge and interior nodes of the 3x3 node grid
+    EXPECT_EQ(4u, sparsity_pattern[0]);
+    EXPECT_EQ(6u, sparsity_pattern[1]);
+    EXPECT_EQ(9u, sparsity_pattern[4]);
+}
+
+TEST(NumLibComputeSparsityPattern, HexAndTriMeshes)
+{
+    std::unique_ptr<MeshLib::Mesh> const hex_mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 3));
+    checkSparsityPattern(*hex_mesh, 3);
+
+    std::unique_ptr<MeshLib::Mesh> const tri_mesh(
+        MeshLib::MeshGenerator::generateRegularTriMesh(1.0, 5));
+    checkSparsityPattern(*tri_mesh, 1);
+}
+#else   // USE_PETSC
+namespace
+{
+/// Creates the partition of the given rank of a unit square mesh of
+/// 2 * n_ranks times 3 linear (Quad) or quadratic (Quad8) elements. The nodes
+/// lie in columns, which are distributed over the ranks, and the global node
+/// IDs are numbered column by column, i.e. the nodes owned by a rank have
+/// consecutive global IDs. The partition contains all elements connected to
+/// an owned node. As in the partitioned mesh files, the owned base nodes are
+/// followed by the ghost base nodes, the owned mid-edge nodes and the ghost
+/// mid-edge nodes.
+std::unique_ptr<MeshLib::NodePartitionedMesh> createQuadMeshPartition(
+    std::size_t const rank, std::size_t const n_ranks, bool const quadratic)
+{
+    std::size_t const n_x = 2 * n_ranks;
+    std::size_t const n_y = 3;
+    // Node columns and rows per element.
+    std::size_t const q = quadratic ? 2 : 1;
+    std::size_t const n_columns = q * n_x + 1;
+    std::size_t const n_rows = q * n_y + 1;
+    // There are no nodes in the element centres of the Quad8 elements.
+    auto const is_node = [q](std::size_t const i, std::size_t const j)
+    {
+        return q == 1 || i % 2 == 0 || j % 2 == 0;
+    };
+    auto const is_base_node = [q](std::size_t const i, std::size_t const j)
+    {
+        return i % q == 0 && j % q == 0;
+    };
+
+    std::vector<std::size_t> global_ids(n_columns * n_rows);
+    std::size_t n_global_nodes = 0;
+    std::size_t n_global_base_nodes = 0;
+    for (std::size_t i = 0; i < n_columns; ++i)
+        for (std::size_t j = 0; j < n_rows; ++j)
+            if (is_node(i, j))
+            {
+                global_ids[i * n_rows + j] = n_global_nodes++;
+                if (is_base_node(i, j))
+                    ++n_global_base_nodes;
+            }
+
+    std::size_t const owned_begin = 2 * q * rank;
+    std::size_t const owned_end =
+        (rank + 1 == n_ranks) ? n_columns : owned_begin + 2 * q;
+    std::size_t const elements_begin = (rank == 0) ? 0 : 2 * rank - 1;
+    std::size_t const elements_end = std::min(2 * rank + 2, n_x);
+
+    // Owned base, ghost base, owned mid-edge and ghost mid-edge nodes.
+    std::array<std::vector<std::size_t>, 4> node_groups;
+    for (std::size_t i = q * elements_begin; i <= q * elements_end; ++i)
+        for (std::size_t j = 0; j < n_rows; ++j)
+        {
+            if (!is_node(i, j))
+                continue;
+            bool const is_ghost = i < owned_begin || owned_end <= i;
+            node_groups[(is_base_node(i, j) ? 0 : 2) + (is_ghost ? 1 : 0)]
+                .push_back(i * n_rows + j);
+        }
+
+    std::vector<MeshLib::Node*> nodes;
+    std::vector<std::size_t> global_node_ids;
+    std::vector<MeshLib::Node*> local_nodes(n_columns * n_rows);
+    for (auto const& group : node_groups)
+        for (auto const k : group)
+        {
+            nodes.push_back(new MeshLib::Node(
+                static_cast<double>(k / n_rows) / (n_columns - 1),
+                static_cast<double>(k % n_rows) / (n_rows - 1), 0.0,
+                nodes.size()));
+            global_node_ids.push_back(global_ids[k]);
+            local_nodes[k] = nodes.back();
+        }
+
+    // The regular elements are followed by the ghost elements.
+    std::vector<MeshLib::Element*> elements;
+    std::vector<MeshLib::Element*> ghost_elements;
+    for (std::size_t i = elements_begin; i < elements_end; ++i)
+        for (std::size_t j = 0; j < n_y; ++j)
+        {
+            auto const node = [&](std::size_t const di, std::size_t const dj)
+            {
+                return local_nodes[(q * i + di) * n_rows + q * j + dj];
+            };
+            MeshLib::Element* element;
+            if (quadratic)
+                element = new MeshLib::Quad8(std::array<MeshLib::Node*, 8>{
+                    {node(0, 0), node(2, 0), node(2, 2), node(0, 2),
+                     node(1, 0), node(2, 1), node(1, 2), node(0, 1)}});
+            else
+                element = new MeshLib::Quad(std::array<MeshLib::Node*, 4>{
+                    {node(0, 0), node(1, 0), node(1, 1), node(0, 1)}});
+            if (q * i < owned_begin || owned_end <= q * (i + 1))
+                ghost_elements.push_back(element);
+            else
+                elements.push_back(element);
+        }
+    elements.insert(elements.end(), ghost_elements.begin(),
+                    ghost_elements.end());
+
+    return std::unique_ptr<MeshLib::NodePartitionedMesh>(
+        new MeshLib::NodePartitionedMesh(
+            "partition", nodes, global_node_ids, elements,
+            MeshLib::Properties(), n_global_base_nodes, n_global_nodes,
+            node_groups[0].size() + node_groups[1].size(),
+            node_groups[0].size(),
+            node_groups[0].size() + node_groups[2].size()));
+}
+
+/// Assembles a matrix of ones for every element and checks that the
+/// computed sparsity pattern is exactly the preallocation needed.
+void checkPETScPreallocation(MeshLib::NodePartitionedMesh const& mesh)
+{
+    MeshLib::MeshSubset const mesh_subset(mesh, &mesh.getNodes());
+    std::vector<std::unique_ptr<MeshLib::MeshSubsets>> components;
+    for (std::size_t c = 0; c < 2; ++c)
+        components.emplace_back(new MeshLib::MeshSubsets{&mesh_subset});
+    NumLib::LocalToGlobalIndexMap const dof_table(
+        std::move(components), NumLib::ComponentOrder::BY_LOCATION);
+
+    auto const sparsity_pattern =
+        NumLib::computeSparsityPattern(dof_table, mesh);
+    std::size_t const n_rows = dof_table.dofSizeWithoutGhosts();
+    ASSERT_EQ(2 * n_rows, sparsity_pattern.size());
+    for (std::size_t r = 0; r < n_rows; ++r)
+        ASSERT_LT(0u, sparsity_pattern[r]);
+
+    MathLib::MatrixSpecifications const spec(n_rows, n_rows,
+                                             &dof_table.getGhostIndices(),
+                                             &sparsity_pattern);
+    auto A = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(spec);
+    // The local rows are complete, since the partition contains all elements
+    // of the owned nodes.
+    for (std::size_t e = 0; e < mesh.getNumberOfElements(); ++e)
+    {
+        auto const indices = NumLib::getIndices(e, dof_table);
+        MathLib::DenseMatrix<double> const local_matrix(
+            indices.size(), indices.size(), 1.0);
+        A->add(MathLib::RowColumnIndices<GlobalIndexType>(indices, indices),
+               local_matrix);
+    }
+    MathLib::LinAlg::finalizeAssembly(*A);
+
+    // The preallocation is exact: no mallocs during the assembly and all
+    // preallocated entries are used.
+    MatInfo info;
+    MatGetInfo(A->getRawMatrix(), MAT_LOCAL, &info);
+    EXPECT_EQ(0, info.mallocs);
+    double const n_preallocated = std::accumulate(
+        sparsity_pattern.begin(), sparsity_pattern.end(), 0.0);
+    EXPECT_EQ(n_preallocated, info.nz_allocated);
+    EXPECT_EQ(n_preallocated, info.nz_used);
+}
+}  // anonymous namespace
+
+TEST(MPITest_NumLibComputeSparsityPattern, PETScPreallocation)
+{
+    int rank;
+    int n_ranks;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    MPI_Comm_size(PETSC_COMM_WORLD, &n_ranks);
+    auto const mesh = createQuadMeshPartition(rank, n_ranks, false);
+    checkPETScPreallocation(*mesh);
+}
+
+// The mid-edge nodes are not base nodes of any element. Their rows have to
+// be preallocated nevertheless.
+TEST(MPITest_NumLibComputeSparsityPattern, PETScPreallocationQuadratic)
+{
+    int rank;
+    int n_ranks;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    MPI_Comm_size(PETSC_COMM_WORLD, &n_ranks);
+    auto const mesh = createQuadMeshPartition(rank, n_ranks, true);
+    checkPETScPreallocation(*mesh);
+}
+#endif  // USE_PETSC
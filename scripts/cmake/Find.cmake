@@ -149,6 +149,11 @@ elseif(OGS_BUILD_GUI)
     message(FATAL_ERROR "Shapelib not found but it is required for OGS_BUILD_GUI!")
 endif()
 
+## Google benchmark library for the micro-benchmarks
+if(OGS_BUILD_BENCHMARKS)
+    find_package(benchmark REQUIRED)
+endif()
+
 ## Sundials cvode ode-solver library
 find_package(CVODE)
 if(CVODE_FOUND)